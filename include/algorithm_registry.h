@@ -7,6 +7,19 @@
 // Algorithm function pointer type for unified interface
 typedef uint64_t (*algorithm_func_t)(uint64_t a, uint64_t b, uint64_t constant);
 
+// Inverse (preimage) function: solve func(a, b, constant) & mask == result for a.
+// Returns false when the preimage is not unique at this checksum width.
+typedef bool (*algorithm_inverse_func_t)(uint64_t result, uint64_t b, uint64_t constant,
+                                         uint64_t mask, uint64_t* a);
+
+// Compiled packet loops (--jit). advance sets out[p] = func(in[p], operand[p], constant);
+// match is true when every (func(in[p], operand[p], constant) ^ expected[p]) & mask is 0.
+// operand is only read by ops that take a field.
+typedef void (*jit_advance_func_t)(uint64_t* out, const uint64_t* in, const uint64_t* operand,
+                                   size_t count, uint64_t constant);
+typedef bool (*jit_match_func_t)(const uint64_t* expected, const uint64_t* in, const uint64_t* operand,
+                                 size_t count, uint64_t constant, uint64_t mask);
+
 // Extended algorithm info with function pointer
 typedef struct {
     operation_t op;
@@ -16,6 +29,9 @@ typedef struct {
     bool requires_constant;
     algorithm_func_t func;             // Function pointer for execution
     int computational_weight;          // CPU cycles (based on x86 instruction timing)
+    algorithm_inverse_func_t inverse;  // NULL when the operation cannot be undone in one step
+    jit_advance_func_t jit_advance;    // NULL unless compiled for this search
+    jit_match_func_t jit_match;
 } algorithm_registry_entry_t;
 
 // Registry management functions
@@ -4,6 +4,22 @@
 #include "cads_types.h"
 #include "../src/core/packet_data.h"
 
+// Search strategy selected with `strategy = ...` in .cads files
+typedef enum {
+    STRATEGY_EXHAUSTIVE = 0,           // Weighted recursive search over every chain
+    STRATEGY_MITM,                     // Meet-in-the-middle over fixed-depth chains
+    STRATEGY_CRC,                      // Whole-frame CRC parameter recovery
+    STRATEGY_BYTES,                    // Each checksum byte solved as its own 1-byte search
+    STRATEGY_RANGE                     // Sums, XORs, Fletcher and Adler over contiguous byte ranges
+} search_strategy_t;
+
+// Chain-step kernel of the exhaustive search, selected with --kernel
+typedef enum {
+    KERNEL_AUTO = 0,                   // Time both on the dataset and keep the faster
+    KERNEL_BYTEWISE,                   // One packet per word
+    KERNEL_BITSLICED                   // 64 packets per word, one word per bit (1-byte T-function op sets)
+} evaluation_kernel_t;
+
 typedef struct {
     char* name;
     char* description;
@@ -19,6 +35,17 @@ typedef struct {
     int custom_operation_count;
     packet_dataset_t* dataset;
     int threads;
+    int state_cache_mb;                // Prefix-state dedup table budget across all threads (0 = off)
+    search_strategy_t strategy;
+    int mitm_depth;                    // Chain length searched by STRATEGY_MITM
+    int chain_constants;               // Independent constants per chain (1 = all constant ops share one)
+    bool algebraic_prephase;           // Run closed-form solvers before the search
+    bool jit;                          // Compile per-op packet loops to native code
+    evaluation_kernel_t kernel;        // Chain-step kernel (--kernel)
+    bool escalate;                     // Walk basic -> intermediate -> advanced up to complexity (--escalate)
+    uint32_t covered_operations;       // Ops (bit i = operation i) a finished lower level searched; chains
+                                       // made only of them are skipped. Set by the escalation ladder.
+    bool memo;                         // Reuse and record searched regions in the on-disk memo store
 } config_t;
 
 // Core configuration functions
@@ -14,6 +14,8 @@
 #define CADS_MAX_CONSTANTS 256        // All possible byte values
 #define CADS_DEFAULT_CHECKSUM_SIZE 1  // Default checksum size in bytes
 #define CADS_MAX_CHECKSUM_SIZE 8      // Maximum checksum size (uint64_t)
+#define CADS_MAX_SOLUTION_OPS (CADS_MAX_FIELDS + 1) // Longest operation chain a solution can hold
+#define CADS_MAX_CHAIN_CONSTANTS 4    // Independent constants one chain can carry
 
 // Test packet structure for validation - now variable length
 typedef struct {
@@ -82,13 +84,57 @@ typedef struct {
 typedef struct {
     uint8_t field_indices[CADS_MAX_FIELDS];
     int field_count;
-    operation_t operations[4];         // Up to 4 operations in sequence
+    operation_t operations[CADS_MAX_SOLUTION_OPS];
     int operation_count;
     uint64_t constant;                 // Support larger constants for multi-byte checksums
+    uint8_t extra_constants[CADS_MAX_CHAIN_CONSTANTS - 1]; // Own constants of the 2nd, 3rd... constant op
+    int extra_constant_count;          // 0 unless the chain reads more than one independent constant
     size_t checksum_size;              // Size of the checksum this solution produces
+    uint8_t checksum_bytes;            // Checksum bytes it covers (bit i = byte i, LSB first); 0 = all
     bool validated;
 } checksum_solution_t;
 
+// Whole-frame CRC in the Rocksoft model, covering data[data_start, length - data_end_trim)
+typedef struct {
+    int width;                         // 8, 16 or 32 bits
+    uint64_t poly;                     // Generator without the x^width term, unreflected
+    uint64_t init;                     // Register before the first byte, unreflected
+    uint64_t xorout;                   // Applied to the (possibly reflected) register
+    bool refin;                        // Input bytes processed LSB first
+    bool refout;                       // Register reflected before xorout
+    size_t data_start;
+    size_t data_end_trim;
+    bool init_ambiguous;               // Frame lengths do not pin init down; init and xorout trade off
+    const char* name;                  // Catalogue entry it matches, NULL when recovered algebraically
+} crc_model_t;
+
+// Reduction over a contiguous byte range, searched by the range strategy
+typedef enum {
+    RANGE_BYTE_SUM = 0,                // Sum of bytes modulo the checksum width
+    RANGE_BYTE_XOR,                    // XOR of bytes
+    RANGE_WORD_SUM,                    // Sum of big-endian 16-bit words (odd tail padded with zero)
+    RANGE_INTERNET,                    // Ones'-complement sum of big-endian 16-bit words (RFC 1071)
+    RANGE_FLETCHER16,                  // (sum2 << 8) | sum1, both modulo 255
+    RANGE_ADLER32,                     // (b << 16) | a, both modulo 65521, a starting at 1
+    NUM_RANGE_REDUCTIONS
+} range_reduction_t;
+
+// How the reduced value r becomes the checksum
+typedef enum {
+    RANGE_FINAL_ADD = 0,               // r + constant (constant 0: r itself)
+    RANGE_FINAL_XOR,                   // r ^ constant (all ones: NOT r)
+    RANGE_FINAL_NEG_ADD                // constant - r (constant 0: NEG r)
+} range_finaliser_t;
+
+// Reduction of data[data_start, length - data_end_trim) followed by a finaliser
+typedef struct {
+    range_reduction_t reduction;
+    range_finaliser_t finaliser;
+    uint64_t constant;                 // Masked to the checksum size
+    size_t data_start;
+    size_t data_end_trim;
+} range_model_t;
+
 // Search results container
 typedef struct {
     checksum_solution_t* solutions;    // Array of solutions found
@@ -97,6 +143,17 @@ typedef struct {
     uint64_t tests_performed;          // Total tests performed during search
     bool search_completed;             // Whether search finished normally
     bool early_exit_triggered;        // Whether early exit was triggered
+    uint64_t prefixes_pruned;          // Subtrees skipped by prefix-state deduplication
+    uint64_t equivalent_prefixes;      // Prefixes sharing a state with a solution-bearing prefix
+    uint64_t unary_runs_collapsed;     // Unary op runs skipped for an explored run with the same mapping
+    uint64_t conflicts_pruned[CADS_MAX_SOLUTION_OPS];  // Subtrees pruned by injectivity conflicts, by prefix length
+    size_t memo_solutions_replayed;    // Solutions taken from the memo store instead of searched
+    size_t memo_solutions_dropped;     // Remembered solutions contradicted by packets appended since
+    size_t mitm_table_bytes;           // Peak meet-in-the-middle table memory across threads
+    crc_model_t* crc_models;           // Found by the CRC recovery strategy
+    size_t crc_model_count;
+    range_model_t* range_models;       // Found by the range reduction strategy
+    size_t range_model_count;
 } search_results_t;
 
 // Expression tree node for complex operations (future use)
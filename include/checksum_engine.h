@@ -12,6 +12,15 @@
 search_results_t* create_search_results(size_t initial_capacity);
 void free_search_results(search_results_t* results);
 bool add_solution(search_results_t* results, const checksum_solution_t* solution);
+bool add_unique_solution(search_results_t* results, const checksum_solution_t* solution);  // false if already present
+bool add_crc_model(search_results_t* results, const crc_model_t* model);
+bool add_range_model(search_results_t* results, const range_model_t* model);
+// Add the counters of a sub-search (tests, pruning statistics, completion) to results
+void add_search_statistics(search_results_t* results, const search_results_t* from);
+
+// Operations a search explores: config->custom_operations when set, otherwise the
+// complexity level. algorithms must hold 32 entries; the registry must be initialized.
+bool select_search_algorithms(const config_t* config, algorithm_registry_entry_t* algorithms, int* algorithm_count);
 
 // Early exit logic
 bool should_continue_search(const search_results_t* results, const config_t* config);
@@ -29,6 +38,33 @@ bool execute_weighted_checksum_search(const config_t* config,
                                      search_results_t* results,
                                      const hardware_benchmark_result_t* benchmark);
 
+// Closed-form solvers (GF(2) affine, ...) run before the search. Models that map onto an
+// operation chain are added to results. Returns true when a model fully explains the dataset.
+bool execute_algebraic_prephase(const config_t* config, search_results_t* results);
+
+// Meet-in-the-middle search over chains of exactly config->mitm_depth operations
+// (config->strategy == STRATEGY_MITM)
+bool execute_mitm_checksum_search(const config_t* config, search_results_t* results);
+
+// Whole-frame CRC parameter recovery (config->strategy == STRATEGY_CRC). Models go to
+// results->crc_models rather than the operation-chain solutions.
+bool execute_crc_recovery_search(const config_t* config, search_results_t* results);
+
+// Reductions over contiguous byte ranges (config->strategy == STRATEGY_RANGE). Models go
+// to results->range_models.
+bool execute_range_reduction_search(const config_t* config, search_results_t* results);
+
+// Per-byte decomposition of a multi-byte checksum (config->strategy == STRATEGY_BYTES).
+// Every byte is searched as a 1-byte checksum; bytes that fail are retried jointly at full
+// width. Solutions record the bytes they cover in checksum_bytes.
+bool execute_byte_lane_search(const config_t* config, search_results_t* results);
+
+// --escalate: exhaustive searches at basic, intermediate, then advanced, up to
+// config->complexity, stopping at the first level with a solution. Each level after the
+// first tests only chains holding an op the level adds.
+bool execute_escalating_checksum_search(const config_t* config, search_results_t* results,
+                                        const hardware_benchmark_result_t* benchmark);
+
 // Solution ordering
 void sort_search_solutions(search_results_t* results);
 
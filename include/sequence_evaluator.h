@@ -7,6 +7,27 @@
 #include "algorithm_registry.h"
 #include "../src/core/packet_data.h"
 
+// Longest operation chain the engine builds (max_fields + 1 for a trailing unary op)
+#define CADS_MAX_CHAIN_DEPTH CADS_MAX_SOLUTION_OPS
+
+// Candidate constants are 8-bit, carried as a 256-bit set
+#define CONSTANT_SET_SIZE 256
+#define CONSTANT_SET_WORDS (CONSTANT_SET_SIZE / 64)
+
+// How an operation obtains its second operand inside an evaluated chain
+typedef enum {
+    OPERAND_FIELD = 0,      // Consumes the next field of the permutation
+    OPERAND_CONSTANT,       // Uses the search constant
+    OPERAND_NONE            // Unary on the running value
+} operand_kind_t;
+
+operand_kind_t get_operation_operand_kind(operation_t op);
+
+// True when output bit i depends only on bits 0..i of the running value, operand and
+// constant (a T-function), so a chain of such ops can be checked one low bit at a time.
+// LSH and MUL are excluded: the shift amount and the b == 0 -> 1 rule read high bits.
+bool operation_is_t_function(operation_t op);
+
 // Evaluate an operation sequence over all packets.
 // Returns true if sequence matches all packets' expected checksums.
 bool evaluate_operation_sequence(const packet_dataset_t* dataset,
@@ -17,4 +38,100 @@ bool evaluate_operation_sequence(const packet_dataset_t* dataset,
                                  int operation_count,
                                  uint8_t constant);
 
+// Running per-packet values of a partially applied chain. Lets the recursive search
+// extend a prefix by one operation instead of re-evaluating the whole sequence per leaf.
+typedef struct {
+    uint64_t* values;       // One running value per packet
+    int field_cursor;       // Next permutation slot a field-consuming op will read
+    bool halted;            // A field-consuming op ran out of fields; later ops are skipped
+} chain_state_t;
+
+// field_values is a field_count x packet_count matrix (row per permutation slot)
+void extract_permutation_field_values(const packet_dataset_t* dataset,
+                                      const uint8_t* field_permutation,
+                                      int field_count,
+                                      size_t checksum_size,
+                                      uint64_t* field_values);
+
+void init_chain_state(chain_state_t* state, const uint64_t* field_values, size_t packet_count);
+
+void advance_chain_state(const chain_state_t* from,
+                         chain_state_t* to,
+                         const algorithm_registry_entry_t* algorithm,
+                         const uint64_t* field_values,
+                         int field_count,
+                         size_t packet_count,
+                         uint64_t constant);
+
+// Apply one final operation and compare against the (pre-masked) expected checksums.
+// Stops at the first mismatching packet.
+bool chain_step_matches(const chain_state_t* from,
+                        const algorithm_registry_entry_t* algorithm,
+                        const uint64_t* field_values,
+                        int field_count,
+                        size_t packet_count,
+                        uint64_t constant,
+                        const uint64_t* expected,
+                        size_t checksum_size);
+
+// Layout of the operations left after a prefix state. Which ops run, which permutation
+// slot they read and which constant they use depend only on the op kinds, so the layout
+// is built once per chain and shared by every packet and candidate constant.
+typedef struct {
+    const algorithm_registry_entry_t* const* algorithms;
+    int operation_count;                    // Ops that run; the chain halts after them
+    operand_kind_t kinds[CADS_MAX_CHAIN_DEPTH];
+    int fields[CADS_MAX_CHAIN_DEPTH];       // Permutation slot read by each op, -1 if none
+    int slots[CADS_MAX_CHAIN_DEPTH];        // Constant slot read by each op, -1 if none
+    int slot_count;                         // Independent constants the tail reads
+} chain_tail_t;
+
+// The i-th constant op that runs reads slot min(i, max_slots - 1), so max_slots == 1
+// gives the classic single shared constant
+void build_chain_tail(chain_tail_t* tail,
+                      const chain_state_t* from,
+                      const algorithm_registry_entry_t* const* algorithms,
+                      int operation_count,
+                      int field_count,
+                      int max_slots);
+
+// Apply the tail with one value per constant slot and compare the bits selected by
+// bit_mask. Stops at the first mismatching packet.
+bool chain_tail_matches(const chain_tail_t* tail,
+                        const chain_state_t* from,
+                        const uint64_t* field_values,
+                        size_t packet_count,
+                        const uint64_t* slot_values,
+                        const uint64_t* expected,
+                        uint64_t bit_mask);
+
+// Clear the candidates (bit c of the set) for free_slot under which the tail does not map
+// packet's prefix state to its pre-masked expected checksum; the other slots keep their
+// slot_values. Returns false once no candidate is left.
+bool chain_tail_filter_constants(const chain_tail_t* tail,
+                                 const chain_state_t* from,
+                                 const uint64_t* field_values,
+                                 size_t packet_count,
+                                 size_t packet,
+                                 const uint64_t* slot_values,
+                                 int free_slot,
+                                 uint64_t expected,
+                                 size_t checksum_size,
+                                 uint64_t candidates[CONSTANT_SET_WORDS]);
+
+// True when the last slot is read by a single C+, C- or C^ followed only by ops that can
+// be inverted from the checksum (ADD, SUB, XOR, ID, NOT, NEG, 1COMP, 2COMP)
+bool chain_tail_peelable(const chain_tail_t* tail);
+
+// The only last-slot value that maps packet to expected, given the other slot_values.
+// Requires chain_tail_peelable(); the result is masked to checksum_size.
+uint64_t chain_tail_peel_constant(const chain_tail_t* tail,
+                                  const chain_state_t* from,
+                                  const uint64_t* field_values,
+                                  size_t packet_count,
+                                  size_t packet,
+                                  const uint64_t* slot_values,
+                                  uint64_t expected,
+                                  size_t checksum_size);
+
 #endif // SEQUENCE_EVALUATOR_H
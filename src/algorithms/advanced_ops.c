@@ -1,4 +1,5 @@
 #include "advanced_ops.h"
+#include <stdlib.h>
 
 // CRC-8 lookup tables for various polynomials
 const uint8_t crc8_ccitt_table[256] = {
@@ -141,19 +142,44 @@ uint64_t advanced_lookup_table(uint64_t a, uint64_t b, uint64_t constant) {
     return sample_lookup_table[a & 0xFF];
 }
 
+// Tables for polynomials 0..poly_crc_bank_size-1. The op is one reflected CRC-8 step, which
+// only depends on a ^ b, so each table replaces the eight bit iterations with one lookup.
+static uint8_t (*poly_crc_bank)[256] = NULL;
+static int poly_crc_bank_size = 0;
+
+static uint8_t poly_crc_bitwise(uint8_t value, uint8_t poly) {
+    for (int i = 0; i < 8; i++) {
+        value = (value & 0x01) ? (uint8_t)((value >> 1) ^ poly) : (uint8_t)(value >> 1);
+    }
+    return value;
+}
+
 uint64_t advanced_poly_crc(uint64_t a, uint64_t b, uint64_t constant) {
     // Generic polynomial CRC with constant as polynomial
-    uint8_t crc = a & 0xFF;
-    uint8_t data = b & 0xFF;
-    for (int i = 0; i < 8; i++) {
-        if ((crc ^ data) & 0x01) {
-            crc = (crc >> 1) ^ (constant & 0xFF);
-        } else {
-            crc >>= 1;
+    uint8_t poly = constant & 0xFF;
+    if (poly < poly_crc_bank_size) return poly_crc_bank[poly][(a ^ b) & 0xFF];
+    return poly_crc_bitwise((a ^ b) & 0xFF, poly);
+}
+
+int build_poly_crc_bank(int poly_count) {
+    if (poly_count > 256) poly_count = 256;
+    if (poly_count <= poly_crc_bank_size) return poly_crc_bank_size;
+    uint8_t (*bank)[256] = realloc(poly_crc_bank, (size_t)poly_count * sizeof(*bank));
+    if (!bank) return poly_crc_bank_size;
+    for (int poly = poly_crc_bank_size; poly < poly_count; poly++) {
+        for (int value = 0; value < 256; value++) {
+            bank[poly][value] = poly_crc_bitwise((uint8_t)value, (uint8_t)poly);
         }
-        data >>= 1;
     }
-    return crc;
+    poly_crc_bank = bank;
+    poly_crc_bank_size = poly_count;
+    return poly_crc_bank_size;
+}
+
+void release_poly_crc_bank(void) {
+    free(poly_crc_bank);
+    poly_crc_bank = NULL;
+    poly_crc_bank_size = 0;
 }
 
 uint64_t advanced_checksum_variant(uint64_t a, uint64_t b, uint64_t constant) {
@@ -167,6 +193,34 @@ uint64_t advanced_checksum_variant(uint64_t a, uint64_t b, uint64_t constant) {
     return 0;
 }
 
+// Inverse operations. The forward versions only look at the low byte of a and return
+// a byte, so wider checksums have no unique preimage.
+bool advanced_rotleft_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)constant;
+    if (mask != 0xFF) return false;
+    *a = rotate_right(result, b & 0x3F, 8);
+    return true;
+}
+
+bool advanced_rotright_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)constant;
+    if (mask != 0xFF) return false;
+    *a = rotate_left(result, b & 0x3F, 8);
+    return true;
+}
+
+bool advanced_swap_nibbles_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    if (mask != 0xFF) return false;
+    *a = advanced_swap_nibbles(result, b, constant);
+    return true;
+}
+
+bool advanced_reverse_bits_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    if (mask != 0xFF) return false;
+    *a = advanced_reverse_bits(result, b, constant);
+    return true;
+}
+
 // Algorithm registry for advanced operations
 static const algorithm_info_t advanced_algorithm_registry[] = {
     {OP_ROTLEFT, COMPLEXITY_ADVANCED, "ROTL", "Rotate left", false},
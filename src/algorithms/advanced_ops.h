@@ -16,6 +16,19 @@ uint64_t advanced_lookup_table(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t advanced_poly_crc(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t advanced_checksum_variant(uint64_t a, uint64_t b, uint64_t constant);
 
+// Lookup tables for OP_POLY_CRC. The bank grows to cover polynomials 0..poly_count-1 and
+// returns how many it holds; other polynomials run the bit loop. Build it before worker
+// threads start: the op reads it without locking.
+int build_poly_crc_bank(int poly_count);
+void release_poly_crc_bank(void);
+
+// Inverses (see basic_ops.h for the contract). The byte-wide operations only have a
+// unique preimage when the checksum is a single byte.
+bool advanced_rotleft_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool advanced_rotright_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool advanced_swap_nibbles_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool advanced_reverse_bits_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+
 // Utility functions
 uint64_t rotate_left(uint64_t value, uint8_t positions, uint8_t bit_width);
 uint64_t rotate_right(uint64_t value, uint8_t positions, uint8_t bit_width);
@@ -32,6 +32,32 @@ uint64_t basic_identity(uint64_t a, uint64_t b, uint64_t constant) {
     return a;
 }
 
+// Inverse operations
+bool basic_add_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)constant;
+    *a = (result - b) & mask;
+    return true;
+}
+
+bool basic_sub_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)constant;
+    *a = (result + b) & mask;
+    return true;
+}
+
+bool basic_xor_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)constant;
+    *a = (result ^ b) & mask;
+    return true;
+}
+
+bool basic_identity_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    (void)constant;
+    *a = result & mask;
+    return true;
+}
+
 // Algorithm registry for basic operations
 static const algorithm_info_t basic_algorithm_registry[] = {
     {OP_ADD, COMPLEXITY_BASIC, "ADD", "Simple addition", false},
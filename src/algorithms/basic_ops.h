@@ -12,6 +12,13 @@ uint64_t basic_and(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t basic_or(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t basic_identity(uint64_t a, uint64_t b, uint64_t constant);
 
+// Inverses: solve op(a, b, constant) == result (mod mask + 1) for a.
+// Only defined for operations that are bijective in a; AND/OR have none.
+bool basic_add_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool basic_sub_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool basic_xor_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool basic_identity_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+
 // Registry function for basic algorithms
 const algorithm_info_t* get_basic_algorithms(int* count);
 
@@ -63,6 +63,39 @@ uint64_t intermediate_twos_complement(uint64_t a, uint64_t b, uint64_t constant)
     return (~(a + b)) + 1;
 }
 
+// Inverse operations
+bool intermediate_not_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    (void)constant;
+    *a = ~result & mask;
+    return true;
+}
+
+bool intermediate_negate_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    (void)constant;
+    *a = ((~result) + 1) & mask; // Negation is its own inverse
+    return true;
+}
+
+bool intermediate_const_add_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    *a = (result - constant) & mask;
+    return true;
+}
+
+bool intermediate_const_xor_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    *a = (result ^ constant) & mask;
+    return true;
+}
+
+bool intermediate_const_sub_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a) {
+    (void)b;
+    *a = (result + constant) & mask;
+    return true;
+}
+
 // Algorithm registry for intermediate operations
 static const algorithm_info_t intermediate_algorithm_registry[] = {
     {OP_NOT, COMPLEXITY_INTERMEDIATE, "NOT", "Bitwise NOT", false},
@@ -17,6 +17,13 @@ uint64_t intermediate_const_sub(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t intermediate_ones_complement(uint64_t a, uint64_t b, uint64_t constant);
 uint64_t intermediate_twos_complement(uint64_t a, uint64_t b, uint64_t constant);
 
+// Inverses (see basic_ops.h for the contract)
+bool intermediate_not_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool intermediate_negate_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool intermediate_const_add_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool intermediate_const_xor_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+bool intermediate_const_sub_inverse(uint64_t result, uint64_t b, uint64_t constant, uint64_t mask, uint64_t* a);
+
 // Registry function for intermediate algorithms
 const algorithm_info_t* get_intermediate_algorithms(int* count);
 
@@ -0,0 +1,121 @@
+#include "width_ops.h"
+
+// Bit reversal of a whole word; narrower widths shift the result down
+static inline uint64_t reverse_word(uint64_t v) {
+    v = ((v >> 1) & 0x5555555555555555ULL) | ((v & 0x5555555555555555ULL) << 1);
+    v = ((v >> 2) & 0x3333333333333333ULL) | ((v & 0x3333333333333333ULL) << 2);
+    v = ((v >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((v & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    return __builtin_bswap64(v);
+}
+
+#define WIDTH_MASK(bits) ((bits) >= 64 ? UINT64_MAX : (1ULL << ((bits) & 63)) - 1)
+
+// One instantiation per width. type is the narrowest unsigned type holding bits; values
+// are reduced to bits before and after each op.
+#define DEFINE_WIDTH_OPERATIONS(bits, type)                                                      \
+    static uint64_t rotleft_##bits(uint64_t a, uint64_t b, uint64_t constant) {                  \
+        (void)constant;                                                                          \
+        type v = (type)(a & WIDTH_MASK(bits));                                                   \
+        unsigned s = (unsigned)(b & 0x3F) % (bits);                                              \
+        if (s == 0) return v;                                                                    \
+        return ((uint64_t)(type)(v << s) | (uint64_t)(v >> ((bits) - s))) & WIDTH_MASK(bits);    \
+    }                                                                                            \
+    static uint64_t rotright_##bits(uint64_t a, uint64_t b, uint64_t constant) {                 \
+        (void)constant;                                                                          \
+        type v = (type)(a & WIDTH_MASK(bits));                                                   \
+        unsigned s = (unsigned)(b & 0x3F) % (bits);                                              \
+        if (s == 0) return v;                                                                    \
+        return ((uint64_t)(v >> s) | (uint64_t)(type)(v << ((bits) - s))) & WIDTH_MASK(bits);    \
+    }                                                                                            \
+    static uint64_t swap_halves_##bits(uint64_t a, uint64_t b, uint64_t constant) {              \
+        (void)b;                                                                                 \
+        (void)constant;                                                                          \
+        type v = (type)(a & WIDTH_MASK(bits));                                                   \
+        return ((uint64_t)(type)(v << ((bits) / 2)) | (uint64_t)(v >> ((bits) / 2))) & WIDTH_MASK(bits); \
+    }                                                                                            \
+    static uint64_t reverse_##bits(uint64_t a, uint64_t b, uint64_t constant) {                  \
+        (void)b;                                                                                 \
+        (void)constant;                                                                          \
+        return reverse_word(a) >> (64 - (bits));                                                 \
+    }                                                                                            \
+    static bool rotleft_inverse_##bits(uint64_t result, uint64_t b, uint64_t constant,           \
+                                       uint64_t mask, uint64_t* a) {                             \
+        if (mask != WIDTH_MASK(bits)) return false;                                              \
+        *a = rotright_##bits(result, b, constant);                                               \
+        return true;                                                                             \
+    }                                                                                            \
+    static bool rotright_inverse_##bits(uint64_t result, uint64_t b, uint64_t constant,          \
+                                        uint64_t mask, uint64_t* a) {                            \
+        if (mask != WIDTH_MASK(bits)) return false;                                              \
+        *a = rotleft_##bits(result, b, constant);                                                \
+        return true;                                                                             \
+    }                                                                                            \
+    static bool swap_halves_inverse_##bits(uint64_t result, uint64_t b, uint64_t constant,       \
+                                           uint64_t mask, uint64_t* a) {                         \
+        if (mask != WIDTH_MASK(bits)) return false;                                              \
+        *a = swap_halves_##bits(result, b, constant);                                            \
+        return true;                                                                             \
+    }                                                                                            \
+    static bool reverse_inverse_##bits(uint64_t result, uint64_t b, uint64_t constant,           \
+                                       uint64_t mask, uint64_t* a) {                             \
+        if (mask != WIDTH_MASK(bits)) return false;                                              \
+        *a = reverse_##bits(result, b, constant);                                                \
+        return true;                                                                             \
+    }
+
+DEFINE_WIDTH_OPERATIONS(8, uint8_t)
+DEFINE_WIDTH_OPERATIONS(16, uint16_t)
+DEFINE_WIDTH_OPERATIONS(24, uint32_t)
+DEFINE_WIDTH_OPERATIONS(32, uint32_t)
+DEFINE_WIDTH_OPERATIONS(40, uint64_t)
+DEFINE_WIDTH_OPERATIONS(48, uint64_t)
+DEFINE_WIDTH_OPERATIONS(56, uint64_t)
+DEFINE_WIDTH_OPERATIONS(64, uint64_t)
+
+typedef struct {
+    algorithm_func_t rotleft, rotright, swap_halves, reverse;
+    algorithm_inverse_func_t rotleft_inverse, rotright_inverse, swap_halves_inverse, reverse_inverse;
+} width_operations_t;
+
+#define WIDTH_OPERATIONS(bits)                                                  \
+    {rotleft_##bits, rotright_##bits, swap_halves_##bits, reverse_##bits,       \
+     rotleft_inverse_##bits, rotright_inverse_##bits, swap_halves_inverse_##bits, reverse_inverse_##bits}
+
+// Indexed by checksum size in bytes
+static const width_operations_t width_operations[9] = {
+    [1] = WIDTH_OPERATIONS(8),  [2] = WIDTH_OPERATIONS(16), [3] = WIDTH_OPERATIONS(24),
+    [4] = WIDTH_OPERATIONS(32), [5] = WIDTH_OPERATIONS(40), [6] = WIDTH_OPERATIONS(48),
+    [7] = WIDTH_OPERATIONS(56), [8] = WIDTH_OPERATIONS(64),
+};
+
+bool get_width_operation(operation_t op, size_t checksum_size,
+                         algorithm_func_t* func, algorithm_inverse_func_t* inverse) {
+    if (checksum_size < 1 || checksum_size > 8) return false;
+    const width_operations_t* ops = &width_operations[checksum_size];
+    switch (op) {
+        case OP_ROTLEFT:
+            *func = ops->rotleft;
+            *inverse = ops->rotleft_inverse;
+            return true;
+        case OP_ROTRIGHT:
+            *func = ops->rotright;
+            *inverse = ops->rotright_inverse;
+            return true;
+        case OP_SWAP_NIBBLES:
+            *func = ops->swap_halves;
+            *inverse = ops->swap_halves_inverse;
+            return true;
+        case OP_REVERSE_BITS:
+            *func = ops->reverse;
+            *inverse = ops->reverse_inverse;
+            return true;
+        default:
+            return false;
+    }
+}
+
+void specialise_operations_for_width(algorithm_registry_entry_t* algorithms, int count, size_t checksum_size) {
+    for (int i = 0; i < count; i++) {
+        get_width_operation(algorithms[i].op, checksum_size, &algorithms[i].func, &algorithms[i].inverse);
+    }
+}
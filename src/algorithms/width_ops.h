@@ -0,0 +1,20 @@
+#ifndef WIDTH_OPS_H
+#define WIDTH_OPS_H
+
+#include "../../include/algorithm_registry.h"
+
+// Width-specialised ROTL, ROTR, SWAP and REVB. The registry versions work on one byte;
+// these rotate, swap halves and reverse across the checksum's full width. They are
+// instantiated once per checksum size from one template, so each has its width as a
+// compile-time constant. At 1 byte they equal the registry versions.
+
+// Function and inverse of op for a checksum of checksum_size bytes (1-8). Returns false
+// and leaves the outputs alone for ops that read the same at every width.
+bool get_width_operation(operation_t op, size_t checksum_size,
+                         algorithm_func_t* func, algorithm_inverse_func_t* inverse);
+
+// Swap the width-dependent entries of algorithms[0..count) to their checksum_size
+// instantiation
+void specialise_operations_for_width(algorithm_registry_entry_t* algorithms, int count, size_t checksum_size);
+
+#endif // WIDTH_OPS_H
@@ -7,6 +7,9 @@
 #include "../utils/search_display.h"
 #include "../utils/hardware_benchmark.h"
 #include "../utils/config.h"
+#include "../core/crc_recovery.h"
+#include "../core/range_reduction.h"
+#include "../core/chain_bytecode.h"
 
 void print_usage(const char* program_name) {
     printf("CADS - Checksum Algorithm Discovery System v1-beta\n");
@@ -26,6 +29,16 @@ void print_usage(const char* program_name) {
     printf("  -v, --verbose          Verbose output\n");
     printf("  -t, --threading        Enable multi-threaded search\n");
     printf("  -T, --threads N        Number of threads (default: auto-detect)\n");
+    printf("      --state-cache-mb N Prefix-state dedup budget in MB, 0 disables (default: 64)\n");
+    printf("      --strategy NAME    Search strategy: exhaustive, mitm, crc, bytes, range (default: exhaustive)\n");
+    printf("      --mitm-depth N     Chain length for the mitm strategy (default: 6)\n");
+    printf("      --chain-constants K Independent constants per chain, 1-%d (default: 1)\n", CADS_MAX_CHAIN_CONSTANTS);
+    printf("      --no-prephase      Skip the algebraic (GF(2) affine, weighted sum) pre-phase\n");
+    printf("      --jit              Compile the operations' packet loops to native x86-64 code\n");
+    printf("      --kernel NAME      Chain-step kernel: auto, bytewise, bitsliced (default: auto)\n");
+    printf("      --escalate         Search basic, then intermediate, then advanced up to --complexity,\n");
+    printf("                         testing only chains with an op new at each level\n");
+    printf("      --no-memo          Do not reuse or record searched regions in the on-disk memo store\n");
     printf("  -h, --help             Show this help message\n\n");
     
     printf("Examples:\n");
@@ -81,6 +94,16 @@ int main(int argc, char* argv[]) {
             fprintf(stderr, "❌ Error: max_constants must be >= 1 (got %d)\n", config->max_constants);
             has_errors = true;
         }
+        if (config->strategy == STRATEGY_MITM &&
+            (config->mitm_depth < 2 || config->mitm_depth > CADS_MAX_SOLUTION_OPS)) {
+            fprintf(stderr, "❌ Error: mitm_depth must be between 2 and %d (got %d)\n", CADS_MAX_SOLUTION_OPS, config->mitm_depth);
+            has_errors = true;
+        }
+        if (config->chain_constants < 1 || config->chain_constants > CADS_MAX_CHAIN_CONSTANTS) {
+            fprintf(stderr, "❌ Error: chain_constants must be between 1 and %d (got %d)\n",
+                    CADS_MAX_CHAIN_CONSTANTS, config->chain_constants);
+            has_errors = true;
+        }
         
         if (has_errors) {
             free_cads_config(config);
@@ -103,9 +126,30 @@ int main(int argc, char* argv[]) {
         printf("   Complexity: %s\n", 
                config->complexity == COMPLEXITY_BASIC ? "Basic" :
                config->complexity == COMPLEXITY_INTERMEDIATE ? "Intermediate" : "Advanced");
+        if (config->escalate && config->strategy == STRATEGY_EXHAUSTIVE) {
+            printf("   Escalation: basic up to this level, new chains only\n");
+        }
         printf("   Max fields: %d\n", config->max_fields);
         printf("   Max constants: %d\n", config->max_constants);
+        if (config->chain_constants > 1) {
+            printf("   Independent constants per chain: %d\n", config->chain_constants);
+        }
         printf("   Early exit: %s\n", config->early_exit ? "Yes" : "No");
+        if (config->jit) {
+            printf("   JIT kernels: enabled\n");
+        }
+        if (config->kernel != KERNEL_AUTO) {
+            printf("   Step kernel: %s\n", config->kernel == KERNEL_BITSLICED ? "bit-sliced" : "byte-wise");
+        }
+        if (config->strategy == STRATEGY_MITM) {
+            printf("   Strategy: meet-in-the-middle (depth %d)\n", config->mitm_depth);
+        } else if (config->strategy == STRATEGY_CRC) {
+            printf("   Strategy: CRC parameter recovery\n");
+        } else if (config->strategy == STRATEGY_BYTES) {
+            printf("   Strategy: per-byte decomposition\n");
+        } else if (config->strategy == STRATEGY_RANGE) {
+            printf("   Strategy: range reductions\n");
+        }
         printf("   Progress interval: %dms\n\n", config->progress_interval);
     }
     
@@ -116,8 +160,20 @@ int main(int argc, char* argv[]) {
         return 1;
     }
     
+    // Exact duplicates add work but no information; conflicting copies rule out every model
+    size_t conflicting_packets = 0;
+    size_t duplicate_packets = remove_duplicate_packets(config->dataset, &conflicting_packets);
+    if (conflicting_packets > 0) {
+        fprintf(stderr, "⚠️  Warning: %zu packets share identical bytes with a packet of a different checksum; "
+                "no deterministic checksum can match them all\n", conflicting_packets);
+    }
+
     if (config->verbose) {
-        printf("✅ Loaded %zu packets successfully\n\n", config->dataset->count);
+        printf("✅ Loaded %zu packets successfully", config->dataset->count);
+        if (duplicate_packets > 0) {
+            printf(" (%zu exact duplicates removed)", duplicate_packets);
+        }
+        printf("\n\n");
     }
     
     // Create search results 
@@ -140,8 +196,39 @@ int main(int argc, char* argv[]) {
     if (config->verbose) {
         printf("🚀 Starting checksum algorithm discovery...\n\n");
     }
+    // Closed-form pre-phase; with early exit a fully determined model ends the run here
+    bool prephase_solved = false;
+    search_results_t* prephase_results = create_search_results(4);
+    if (config->algebraic_prephase && prephase_results) {
+        prephase_solved = execute_algebraic_prephase(config, prephase_results);
+        printf("\n");
+    }
+    
     // Use weighted threading engine (handles both single and multi-threaded execution)
-    bool search_success = execute_weighted_checksum_search(config, results, &benchmark);
+    bool search_success;
+    if (prephase_solved && config->early_exit && prephase_results->solution_count > 0) {
+        results->search_completed = true;
+        results->early_exit_triggered = true;
+        search_success = true;
+    } else if (config->strategy == STRATEGY_MITM) {
+        search_success = execute_mitm_checksum_search(config, results);
+    } else if (config->strategy == STRATEGY_CRC) {
+        search_success = execute_crc_recovery_search(config, results);
+    } else if (config->strategy == STRATEGY_BYTES) {
+        search_success = execute_byte_lane_search(config, results);
+    } else if (config->strategy == STRATEGY_RANGE) {
+        search_success = execute_range_reduction_search(config, results);
+    } else if (config->escalate) {
+        search_success = execute_escalating_checksum_search(config, results, &benchmark);
+    } else {
+        search_success = execute_weighted_checksum_search(config, results, &benchmark);
+    }
+    
+    // Pre-phase models the search did not rediscover
+    for (size_t i = 0; prephase_results && i < prephase_results->solution_count; i++) {
+        add_unique_solution(results, &prephase_results->solutions[i]);
+    }
+    free_search_results(prephase_results);
     
     if (!search_success) {
         fprintf(stderr, "❌ Error: Checksum search failed\n");
@@ -156,6 +243,25 @@ int main(int argc, char* argv[]) {
     printf("Tests performed: %llu\n", (unsigned long long)results->tests_performed);
     printf("Solutions found: %zu\n", results->solution_count);
     printf("Search completed: %s\n", results->search_completed ? "Yes" : "Interrupted");
+    if (config->strategy == STRATEGY_MITM) {
+        printf("MITM table memory: %.1f MB\n", results->mitm_table_bytes / (1024.0 * 1024.0));
+    }
+    if (config->strategy == STRATEGY_CRC) {
+        printf("CRC models found: %zu\n", results->crc_model_count);
+        for (size_t i = 0; i < results->crc_model_count; i++) {
+            printf("   ");
+            print_crc_model(&results->crc_models[i]);
+        }
+    }
+    if (config->strategy == STRATEGY_RANGE) {
+        printf("Range models found: %zu\n", results->range_model_count);
+        for (size_t i = 0; i < results->range_model_count; i++) {
+            printf("   ");
+            print_range_model(&results->range_models[i], config->checksum_size);
+        }
+    }
+    bool discovered = results->solution_count > 0 || results->crc_model_count > 0 ||
+                      results->range_model_count > 0;
     
     if (results->solution_count > 0) {
         printf("\n🏆 DISCOVERED ALGORITHMS:\n");
@@ -188,10 +294,29 @@ int main(int argc, char* argv[]) {
                 if (op < solution->operation_count - 1) printf(" ");
             }
             printf(" (%d total)\n", solution->operation_count);
-            printf("     Constant: 0x%02llX\n", (unsigned long long)solution->constant);
+            printf("     Constant: 0x%02llX", (unsigned long long)solution->constant);
+            for (int k = 0; k < solution->extra_constant_count; k++) {
+                printf(", 0x%02X", solution->extra_constants[k]);
+            }
+            printf("\n");
             printf("     Checksum size: %zu bytes\n", solution->checksum_size);
+            chain_program_t program;
+            char bytecode[CHAIN_PROGRAM_TEXT_MAX];
+            if (compile_solution_program(&program, solution) &&
+                format_chain_program(&program, bytecode, sizeof(bytecode))) {
+                printf("     Bytecode: %s\n", bytecode);
+            }
+            if (solution->checksum_bytes) {
+                printf("     Checksum bytes:");
+                for (int b = 0; b < 8; b++) {
+                    if (solution->checksum_bytes & (1u << b)) printf(" %d", b);
+                }
+                printf(" (byte 0 = least significant)\n");
+            }
             printf("     Validated: %s\n", solution->validated ? "✅" : "❌");
         }
+    }
+    if (discovered) {
         printf("\n✅ SUCCESS: Algorithm(s) discovered successfully!\n");
     } else {
         printf("\n⚠️  No algorithms discovered with current parameters.\n");
@@ -202,5 +327,5 @@ int main(int argc, char* argv[]) {
     free_search_results(results);
     free_cads_config(config);
     
-    return results->solution_count > 0 ? 0 : 1;
+    return discovered ? 0 : 1;
 }
@@ -0,0 +1,58 @@
+// Algebraic pre-phase: closed-form solvers that run before the brute-force engine.
+// Each solver either explains the whole dataset with a model or rules its family out
+// in milliseconds; models that map onto an operation chain are reported as solutions.
+
+#include "../../include/checksum_engine.h"
+#include "../../include/sequence_evaluator.h"
+#include "gf2_affine_solver.h"
+#include "modular_linear_solver.h"
+#include <stdio.h>
+
+static bool record_prephase_solution(const config_t* config, search_results_t* results,
+                                     checksum_solution_t* solution) {
+    // The canonical evaluator is the final word on whether a chain reproduces the dataset
+    if (!evaluate_operation_sequence(config->dataset, config, solution->field_indices, solution->field_count,
+                                     solution->operations, solution->operation_count, (uint8_t)solution->constant)) {
+        return false;
+    }
+    solution->validated = true;
+    return add_solution(results, solution);
+}
+
+bool execute_algebraic_prephase(const config_t* config, search_results_t* results) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) return false;
+    if (!initialize_algorithm_registry()) return false;
+
+    bool conclusive = false;
+
+    gf2_affine_result_t* gf2 = solve_gf2_affine(config->dataset, config->checksum_size);
+    if (gf2) {
+        print_gf2_affine_result(gf2, config->verbose);
+        bool redundant = gf2->packets_used > (size_t)gf2->rank;
+        if (gf2->consistent && redundant && gf2->packets_skipped == 0) {
+            checksum_solution_t solution;
+            if (gf2_affine_to_solution(gf2, &solution) && record_prephase_solution(config, results, &solution)) {
+                printf("   Model maps to an XOR chain over %d field(s)\n", solution.field_count);
+            }
+            conclusive = !gf2->underdetermined;
+        }
+        free_gf2_affine_result(gf2);
+    }
+
+    modular_linear_result_t* sum = solve_modular_linear(config->dataset, config->checksum_size);
+    if (sum) {
+        print_modular_linear_result(sum, config->verbose);
+        bool redundant = sum->packets_used > (size_t)sum->rank;
+        if (sum->consistent && redundant && sum->packets_skipped == 0) {
+            checksum_solution_t solution;
+            if (modular_linear_to_solution(sum, &solution) && record_prephase_solution(config, results, &solution)) {
+                printf("   Model maps to an ADD/SUB chain over %d field(s)\n", solution.field_count);
+            }
+            conclusive = conclusive || sum->solution_log2 == 0;
+        }
+        free_modular_linear_result(sum);
+    }
+
+    cleanup_algorithm_registry();
+    return conclusive;
+}
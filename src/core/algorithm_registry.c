@@ -2,6 +2,7 @@
 #include "../algorithms/basic_ops.h"
 #include "../algorithms/intermediate_ops.h"
 #include "../algorithms/advanced_ops.h"
+#include "operation_jit.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
@@ -55,39 +56,39 @@ static const complexity_stats_t complexity_statistics[] = {
 // Master algorithm registry with all operations
 static const algorithm_registry_entry_t master_registry[] = {
     // BASIC algorithms (6 total) - All 1 cycle
-    {OP_ADD, COMPLEXITY_BASIC, "ADD", "Simple addition", false, basic_add_wrapper, 1},
-    {OP_SUB, COMPLEXITY_BASIC, "SUB", "Subtraction", false, basic_sub_wrapper, 1},
-    {OP_XOR, COMPLEXITY_BASIC, "XOR", "Exclusive OR", false, basic_xor_wrapper, 1},
-    {OP_AND, COMPLEXITY_BASIC, "AND", "Bitwise AND", false, basic_and_wrapper, 1},
-    {OP_OR, COMPLEXITY_BASIC, "OR", "Bitwise OR", false, basic_or_wrapper, 1},
-    {OP_IDENTITY, COMPLEXITY_BASIC, "ID", "Pass-through", false, basic_identity_wrapper, 1},
+    {OP_ADD, COMPLEXITY_BASIC, "ADD", "Simple addition", false, basic_add_wrapper, 1, basic_add_inverse, NULL, NULL},
+    {OP_SUB, COMPLEXITY_BASIC, "SUB", "Subtraction", false, basic_sub_wrapper, 1, basic_sub_inverse, NULL, NULL},
+    {OP_XOR, COMPLEXITY_BASIC, "XOR", "Exclusive OR", false, basic_xor_wrapper, 1, basic_xor_inverse, NULL, NULL},
+    {OP_AND, COMPLEXITY_BASIC, "AND", "Bitwise AND", false, basic_and_wrapper, 1, NULL, NULL, NULL},
+    {OP_OR, COMPLEXITY_BASIC, "OR", "Bitwise OR", false, basic_or_wrapper, 1, NULL, NULL, NULL},
+    {OP_IDENTITY, COMPLEXITY_BASIC, "ID", "Pass-through", false, basic_identity_wrapper, 1, basic_identity_inverse, NULL, NULL},
     
     // INTERMEDIATE algorithms (12 total) - 1-30 cycles
-    {OP_NOT, COMPLEXITY_INTERMEDIATE, "NOT", "Bitwise NOT", false, intermediate_not_wrapper, 1},
-    {OP_LSHIFT, COMPLEXITY_INTERMEDIATE, "LSH", "Left shift", false, intermediate_lshift_wrapper, 1},
-    {OP_RSHIFT, COMPLEXITY_INTERMEDIATE, "RSH", "Right shift", false, intermediate_rshift_wrapper, 1},
-    {OP_MUL, COMPLEXITY_INTERMEDIATE, "MUL", "Multiplication", false, intermediate_mul_wrapper, 3},
-    {OP_DIV, COMPLEXITY_INTERMEDIATE, "DIV", "Division", false, intermediate_div_wrapper, 2},
-    {OP_MOD, COMPLEXITY_INTERMEDIATE, "MOD", "Modulo", false, intermediate_mod_wrapper, 2},
-    {OP_NEGATE, COMPLEXITY_INTERMEDIATE, "NEG", "Two's complement negation", false, intermediate_negate_wrapper, 1},
-    {OP_CONST_ADD, COMPLEXITY_INTERMEDIATE, "C+", "Add constant", true, intermediate_const_add_wrapper, 1},
-    {OP_CONST_XOR, COMPLEXITY_INTERMEDIATE, "C^", "XOR with constant", true, intermediate_const_xor_wrapper, 1},
-    {OP_CONST_SUB, COMPLEXITY_INTERMEDIATE, "C-", "Subtract constant", true, intermediate_const_sub_wrapper, 1},
-    {OP_ONES_COMPLEMENT, COMPLEXITY_INTERMEDIATE, "1COMP", "One's complement sum", false, intermediate_ones_complement_wrapper, 1},
-    {OP_TWOS_COMPLEMENT, COMPLEXITY_INTERMEDIATE, "2COMP", "Two's complement sum", false, intermediate_twos_complement_wrapper, 2},
+    {OP_NOT, COMPLEXITY_INTERMEDIATE, "NOT", "Bitwise NOT", false, intermediate_not_wrapper, 1, intermediate_not_inverse, NULL, NULL},
+    {OP_LSHIFT, COMPLEXITY_INTERMEDIATE, "LSH", "Left shift", false, intermediate_lshift_wrapper, 1, NULL, NULL, NULL},
+    {OP_RSHIFT, COMPLEXITY_INTERMEDIATE, "RSH", "Right shift", false, intermediate_rshift_wrapper, 1, NULL, NULL, NULL},
+    {OP_MUL, COMPLEXITY_INTERMEDIATE, "MUL", "Multiplication", false, intermediate_mul_wrapper, 3, NULL, NULL, NULL},
+    {OP_DIV, COMPLEXITY_INTERMEDIATE, "DIV", "Division", false, intermediate_div_wrapper, 2, NULL, NULL, NULL},
+    {OP_MOD, COMPLEXITY_INTERMEDIATE, "MOD", "Modulo", false, intermediate_mod_wrapper, 2, NULL, NULL, NULL},
+    {OP_NEGATE, COMPLEXITY_INTERMEDIATE, "NEG", "Two's complement negation", false, intermediate_negate_wrapper, 1, intermediate_negate_inverse, NULL, NULL},
+    {OP_CONST_ADD, COMPLEXITY_INTERMEDIATE, "C+", "Add constant", true, intermediate_const_add_wrapper, 1, intermediate_const_add_inverse, NULL, NULL},
+    {OP_CONST_XOR, COMPLEXITY_INTERMEDIATE, "C^", "XOR with constant", true, intermediate_const_xor_wrapper, 1, intermediate_const_xor_inverse, NULL, NULL},
+    {OP_CONST_SUB, COMPLEXITY_INTERMEDIATE, "C-", "Subtract constant", true, intermediate_const_sub_wrapper, 1, intermediate_const_sub_inverse, NULL, NULL},
+    {OP_ONES_COMPLEMENT, COMPLEXITY_INTERMEDIATE, "1COMP", "One's complement sum", false, intermediate_ones_complement_wrapper, 1, NULL, NULL, NULL},
+    {OP_TWOS_COMPLEMENT, COMPLEXITY_INTERMEDIATE, "2COMP", "Two's complement sum", false, intermediate_twos_complement_wrapper, 2, NULL, NULL, NULL},
     
     // ADVANCED algorithms (11 total) - 2-25 cycles
-    {OP_ROTLEFT, COMPLEXITY_ADVANCED, "ROTL", "Rotate left", false, advanced_rotleft_wrapper, 2},
-    {OP_ROTRIGHT, COMPLEXITY_ADVANCED, "ROTR", "Rotate right", false, advanced_rotright_wrapper, 2},
-    {OP_CRC8_CCITT, COMPLEXITY_ADVANCED, "CRC8C", "CRC-8 CCITT", false, advanced_crc8_ccitt_wrapper, 8},
-    {OP_CRC8_DALLAS, COMPLEXITY_ADVANCED, "CRC8D", "CRC-8 Dallas/Maxim", false, advanced_crc8_dallas_wrapper, 8},
-    {OP_CRC8_SAE, COMPLEXITY_ADVANCED, "CRC8S", "CRC-8 SAE J1850", false, advanced_crc8_sae_wrapper, 8},
-    {OP_FLETCHER8, COMPLEXITY_ADVANCED, "FLETCH", "Fletcher-8 checksum", false, advanced_fletcher8_wrapper, 6},
-    {OP_SWAP_NIBBLES, COMPLEXITY_ADVANCED, "SWAP", "Swap nibbles", false, advanced_swap_nibbles_wrapper, 2},
-    {OP_REVERSE_BITS, COMPLEXITY_ADVANCED, "REVB", "Reverse bits", false, advanced_reverse_bits_wrapper, 8},
-    {OP_LOOKUP_TABLE, COMPLEXITY_ADVANCED, "LUT", "Lookup table", false, advanced_lookup_table_wrapper, 3},
-    {OP_POLY_CRC, COMPLEXITY_ADVANCED, "PCRC", "Polynomial CRC", true, advanced_poly_crc_wrapper, 20},
-    {OP_CHECKSUM_VARIANT, COMPLEXITY_ADVANCED, "CVAR", "Checksum variant", true, advanced_checksum_variant_wrapper, 5}
+    {OP_ROTLEFT, COMPLEXITY_ADVANCED, "ROTL", "Rotate left", false, advanced_rotleft_wrapper, 2, advanced_rotleft_inverse, NULL, NULL},
+    {OP_ROTRIGHT, COMPLEXITY_ADVANCED, "ROTR", "Rotate right", false, advanced_rotright_wrapper, 2, advanced_rotright_inverse, NULL, NULL},
+    {OP_CRC8_CCITT, COMPLEXITY_ADVANCED, "CRC8C", "CRC-8 CCITT", false, advanced_crc8_ccitt_wrapper, 8, NULL, NULL, NULL},
+    {OP_CRC8_DALLAS, COMPLEXITY_ADVANCED, "CRC8D", "CRC-8 Dallas/Maxim", false, advanced_crc8_dallas_wrapper, 8, NULL, NULL, NULL},
+    {OP_CRC8_SAE, COMPLEXITY_ADVANCED, "CRC8S", "CRC-8 SAE J1850", false, advanced_crc8_sae_wrapper, 8, NULL, NULL, NULL},
+    {OP_FLETCHER8, COMPLEXITY_ADVANCED, "FLETCH", "Fletcher-8 checksum", false, advanced_fletcher8_wrapper, 6, NULL, NULL, NULL},
+    {OP_SWAP_NIBBLES, COMPLEXITY_ADVANCED, "SWAP", "Swap nibbles", false, advanced_swap_nibbles_wrapper, 2, advanced_swap_nibbles_inverse, NULL, NULL},
+    {OP_REVERSE_BITS, COMPLEXITY_ADVANCED, "REVB", "Reverse bits", false, advanced_reverse_bits_wrapper, 8, advanced_reverse_bits_inverse, NULL, NULL},
+    {OP_LOOKUP_TABLE, COMPLEXITY_ADVANCED, "LUT", "Lookup table", false, advanced_lookup_table_wrapper, 3, NULL, NULL, NULL},
+    {OP_POLY_CRC, COMPLEXITY_ADVANCED, "PCRC", "Polynomial CRC", true, advanced_poly_crc_wrapper, 20, NULL, NULL, NULL},
+    {OP_CHECKSUM_VARIANT, COMPLEXITY_ADVANCED, "CVAR", "Checksum variant", true, advanced_checksum_variant_wrapper, 5, NULL, NULL, NULL}
 };
 
 // Wrapper functions for basic operations
@@ -229,6 +230,8 @@ bool initialize_algorithm_registry(void) {
 }
 
 void cleanup_algorithm_registry(void) {
+    release_poly_crc_bank();
+    release_operation_kernels();
     if (g_algorithm_registry) {
         free(g_algorithm_registry);
         g_algorithm_registry = NULL;
@@ -0,0 +1,243 @@
+#include "bitsliced_kernel.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+size_t bitsliced_word_count(size_t packet_count) {
+    return (packet_count + 63) / 64 * BITSLICED_PLANES;
+}
+
+void bitslice_values(const uint64_t* values, size_t packet_count, uint64_t* planes) {
+    memset(planes, 0, bitsliced_word_count(packet_count) * sizeof(uint64_t));
+    for (size_t p = 0; p < packet_count; p++) {
+        uint64_t* block = &planes[(p >> 6) * BITSLICED_PLANES];
+        unsigned lane = (unsigned)(p & 63);
+        for (int i = 0; i < BITSLICED_PLANES; i++) {
+            block[i] |= ((values[p] >> i) & 1) << lane;
+        }
+    }
+}
+
+void unbitslice_values(const uint64_t* planes, size_t packet_count, uint64_t* values) {
+    for (size_t p = 0; p < packet_count; p++) {
+        const uint64_t* block = &planes[(p >> 6) * BITSLICED_PLANES];
+        unsigned lane = (unsigned)(p & 63);
+        uint64_t value = 0;
+        for (int i = 0; i < BITSLICED_PLANES; i++) {
+            value |= ((block[i] >> lane) & 1) << i;
+        }
+        values[p] = value;
+    }
+}
+
+bool bitsliced_operation_supported(operation_t op) {
+    return operation_is_t_function(op);
+}
+
+// r = a + b + carry over the planes. r may alias a or b.
+static inline void add_planes(const uint64_t* a, const uint64_t* b, uint64_t carry, uint64_t* r) {
+    for (int i = 0; i < BITSLICED_PLANES; i++) {
+        uint64_t half = a[i] ^ b[i];
+        uint64_t sum = half ^ carry;
+        carry = (a[i] & b[i]) | (carry & half);
+        r[i] = sum;
+    }
+}
+
+static inline void not_planes(const uint64_t* a, uint64_t* r) {
+    for (int i = 0; i < BITSLICED_PLANES; i++) r[i] = ~a[i];
+}
+
+static const uint64_t zero_planes[BITSLICED_PLANES];
+
+// One op on one group of 64 packets. b is the field operand, k the broadcast constant.
+static inline void apply_planes(operation_t op, const uint64_t* a, const uint64_t* b,
+                                const uint64_t* k, uint64_t* r) {
+    uint64_t t[BITSLICED_PLANES];
+    switch (op) {
+        case OP_ADD:
+            add_planes(a, b, 0, r);
+            break;
+        case OP_SUB:
+            not_planes(b, t);
+            add_planes(a, t, UINT64_MAX, r);
+            break;
+        case OP_XOR:
+            for (int i = 0; i < BITSLICED_PLANES; i++) r[i] = a[i] ^ b[i];
+            break;
+        case OP_AND:
+            for (int i = 0; i < BITSLICED_PLANES; i++) r[i] = a[i] & b[i];
+            break;
+        case OP_OR:
+            for (int i = 0; i < BITSLICED_PLANES; i++) r[i] = a[i] | b[i];
+            break;
+        case OP_NOT:
+        case OP_ONES_COMPLEMENT:    // ~(a + 0)
+            not_planes(a, r);
+            break;
+        case OP_NEGATE:
+            not_planes(a, t);
+            add_planes(t, zero_planes, UINT64_MAX, r);
+            break;
+        case OP_CONST_ADD:
+            add_planes(a, k, 0, r);
+            break;
+        case OP_CONST_SUB:
+            not_planes(k, t);
+            add_planes(a, t, UINT64_MAX, r);
+            break;
+        case OP_CONST_XOR:
+            for (int i = 0; i < BITSLICED_PLANES; i++) r[i] = a[i] ^ k[i];
+            break;
+        case OP_TWOS_COMPLEMENT:    // ~(a + b) + 1
+            add_planes(a, b, 0, t);
+            not_planes(t, t);
+            add_planes(t, zero_planes, UINT64_MAX, r);
+            break;
+        default:                    // OP_IDENTITY
+            memmove(r, a, sizeof(t));
+            break;
+    }
+}
+
+// Lanes of the group starting at packet that hold a packet
+static inline uint64_t group_lanes(size_t packet, size_t packet_count) {
+    size_t left = packet_count - packet;
+    return left >= 64 ? UINT64_MAX : (1ULL << left) - 1;
+}
+
+static void broadcast_constant(uint64_t constant, uint64_t* k) {
+    for (int i = 0; i < BITSLICED_PLANES; i++) k[i] = ((constant >> i) & 1) ? UINT64_MAX : 0;
+}
+
+void bitsliced_advance_chain_state(const chain_state_t* from,
+                                   chain_state_t* to,
+                                   operation_t op,
+                                   const uint64_t* field_planes,
+                                   int field_count,
+                                   size_t packet_count,
+                                   uint64_t constant) {
+    size_t words = bitsliced_word_count(packet_count);
+    to->field_cursor = from->field_cursor;
+    to->halted = from->halted;
+    operand_kind_t kind = get_operation_operand_kind(op);
+
+    if (!from->halted && kind == OPERAND_FIELD && from->field_cursor >= field_count) {
+        to->halted = true;
+    }
+    if (to->halted) {
+        memcpy(to->values, from->values, words * sizeof(uint64_t));
+        return;
+    }
+
+    const uint64_t* operand = NULL;
+    if (kind == OPERAND_FIELD) {
+        operand = &field_planes[(size_t)from->field_cursor * words];
+        to->field_cursor++;
+    }
+    uint64_t k[BITSLICED_PLANES];
+    broadcast_constant(kind == OPERAND_CONSTANT ? constant : 0, k);
+
+    for (size_t w = 0; w < words; w += BITSLICED_PLANES) {
+        apply_planes(op, &from->values[w], operand ? &operand[w] : zero_planes, k, &to->values[w]);
+    }
+    // NOT and friends set the unused lanes; clear them so equal packets give equal words
+    uint64_t lanes = group_lanes((words / BITSLICED_PLANES - 1) * 64, packet_count);
+    for (size_t w = words - BITSLICED_PLANES; w < words; w++) to->values[w] &= lanes;
+}
+
+bool bitsliced_chain_step_matches(const chain_state_t* from,
+                                  operation_t op,
+                                  const uint64_t* field_planes,
+                                  int field_count,
+                                  size_t packet_count,
+                                  uint64_t constant,
+                                  const uint64_t* expected_planes) {
+    size_t words = bitsliced_word_count(packet_count);
+    operand_kind_t kind = get_operation_operand_kind(op);
+    bool skip = from->halted || (kind == OPERAND_FIELD && from->field_cursor >= field_count);
+    const uint64_t* operand = (kind == OPERAND_FIELD && !skip)
+                              ? &field_planes[(size_t)from->field_cursor * words] : NULL;
+    uint64_t k[BITSLICED_PLANES];
+    broadcast_constant(kind == OPERAND_CONSTANT ? constant : 0, k);
+
+    for (size_t w = 0; w < words; w += BITSLICED_PLANES) {
+        uint64_t r[BITSLICED_PLANES];
+        const uint64_t* value = &from->values[w];
+        if (!skip) {
+            apply_planes(op, value, operand ? &operand[w] : zero_planes, k, r);
+            value = r;
+        }
+        uint64_t differ = 0;
+        for (int i = 0; i < BITSLICED_PLANES; i++) differ |= value[i] ^ expected_planes[w + i];
+        if (differ & group_lanes(w / BITSLICED_PLANES * 64, packet_count)) return false;
+    }
+    return true;
+}
+
+static double elapsed_seconds(const struct timeval* start) {
+    struct timeval end;
+    gettimeofday(&end, NULL);
+    return (end.tv_sec - start->tv_sec) + (end.tv_usec - start->tv_usec) / 1e6;
+}
+
+bool bitsliced_kernel_faster(const algorithm_registry_entry_t* algorithms, int algorithm_count,
+                             size_t packet_count, double* bytewise_rate, double* bitsliced_rate) {
+    *bytewise_rate = 0.0;
+    *bitsliced_rate = 0.0;
+    if (algorithm_count < 1 || packet_count == 0) return false;
+    for (int a = 0; a < algorithm_count; a++) {
+        if (!bitsliced_operation_supported(algorithms[a].op)) return false;
+    }
+
+    // Two permutation slots of random bytes; the step reads slot 1
+    size_t words = bitsliced_word_count(packet_count);
+    uint64_t* values = malloc(4 * packet_count * sizeof(uint64_t));
+    uint64_t* planes = malloc(4 * words * sizeof(uint64_t));
+    if (!values || !planes) {
+        free(values);
+        free(planes);
+        return false;
+    }
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (size_t p = 0; p < 2 * packet_count; p++) {
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        values[p] = seed & 0xFF;
+    }
+    bitslice_values(values, packet_count, planes);
+    bitslice_values(&values[packet_count], packet_count, &planes[words]);
+
+    // About four million packet-steps per kernel
+    uint64_t rounds = ((uint64_t)1 << 22) / ((uint64_t)packet_count * (uint64_t)algorithm_count) + 1;
+    uint64_t steps = rounds * (uint64_t)algorithm_count * packet_count;
+
+    chain_state_t from = {values, 1, false};
+    chain_state_t to = {&values[2 * packet_count], 1, false};
+    struct timeval start;
+    gettimeofday(&start, NULL);
+    for (uint64_t r = 0; r < rounds; r++) {
+        for (int a = 0; a < algorithm_count; a++) {
+            advance_chain_state(&from, &to, &algorithms[a], values, 2, packet_count, r);
+        }
+    }
+    double bytewise = elapsed_seconds(&start);
+
+    chain_state_t sliced_from = {planes, 1, false};
+    chain_state_t sliced_to = {&planes[2 * words], 1, false};
+    gettimeofday(&start, NULL);
+    for (uint64_t r = 0; r < rounds; r++) {
+        for (int a = 0; a < algorithm_count; a++) {
+            bitsliced_advance_chain_state(&sliced_from, &sliced_to, algorithms[a].op, planes, 2,
+                                          packet_count, r);
+        }
+    }
+    double bitsliced = elapsed_seconds(&start);
+
+    free(values);
+    free(planes);
+    if (bytewise > 0) *bytewise_rate = steps / bytewise;
+    if (bitsliced > 0) *bitsliced_rate = steps / bitsliced;
+    return bitsliced < bytewise;
+}
@@ -0,0 +1,52 @@
+#ifndef BITSLICED_KERNEL_H
+#define BITSLICED_KERNEL_H
+
+#include "../../include/algorithm_registry.h"
+#include "../../include/sequence_evaluator.h"
+
+// Bit-sliced chain steps for 1-byte checksums. Packets are taken 64 at a time and their
+// running values transposed into eight words, word i holding bit i of each of the 64
+// packets. XOR, AND, OR and NOT then cost one instruction per bit for all 64 packets,
+// and ADD / SUB a ripple carry across the eight words.
+//
+// Only T-function ops are supported: their low 8 result bits depend only on the low 8
+// bits of the operands, so the eight planes carry everything a 1-byte checksum can see.
+// A chain_state_t whose values point at planes is advanced and matched exactly like the
+// per-packet one; the words past the last packet are kept clear.
+
+#define BITSLICED_PLANES 8
+
+// Words holding packet_count sliced values: one group of BITSLICED_PLANES per 64 packets
+size_t bitsliced_word_count(size_t packet_count);
+
+// Low 8 bits of values[0..packet_count) to planes, and back
+void bitslice_values(const uint64_t* values, size_t packet_count, uint64_t* planes);
+void unbitslice_values(const uint64_t* planes, size_t packet_count, uint64_t* values);
+
+bool bitsliced_operation_supported(operation_t op);
+
+// advance_chain_state on planes. field_planes holds one sliced row per permutation slot.
+void bitsliced_advance_chain_state(const chain_state_t* from,
+                                   chain_state_t* to,
+                                   operation_t op,
+                                   const uint64_t* field_planes,
+                                   int field_count,
+                                   size_t packet_count,
+                                   uint64_t constant);
+
+// chain_step_matches on planes against the sliced expected checksums
+bool bitsliced_chain_step_matches(const chain_state_t* from,
+                                  operation_t op,
+                                  const uint64_t* field_planes,
+                                  int field_count,
+                                  size_t packet_count,
+                                  uint64_t constant,
+                                  const uint64_t* expected_planes);
+
+// Time one chain step of each op over packet_count packets with advance_chain_state
+// (including any --jit kernels) and with the bit-sliced kernel. Rates are packet-steps
+// per second; returns true when the bit-sliced kernel is faster.
+bool bitsliced_kernel_faster(const algorithm_registry_entry_t* algorithms, int algorithm_count,
+                             size_t packet_count, double* bytewise_rate, double* bitsliced_rate);
+
+#endif // BITSLICED_KERNEL_H
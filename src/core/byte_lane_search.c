@@ -0,0 +1,115 @@
+// Per-byte decomposition of multi-byte checksum searches.
+//
+// Checksums such as a Fletcher-16 pair or separate sum and xor bytes compute every byte
+// on its own, so a 2- or 4-byte search that has to match the whole value at once spends
+// nearly all of its work on combinations of unrelated bytes. Each checksum byte is first
+// searched as a 1-byte checksum over single-byte fields. A byte that no chain explains
+// usually takes a carry from the bytes below it, so the failing bytes are retried with one
+// joint search covering byte 0 up to the highest of them at that width.
+
+#include "../../include/checksum_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Copy of the dataset whose checksums keep `width` bytes starting at byte `shift`
+static packet_dataset_t* create_lane_dataset(const packet_dataset_t* dataset, size_t shift, size_t width) {
+    packet_dataset_t* lane = create_packet_dataset(dataset->count);
+    if (!lane) return NULL;
+    for (size_t p = 0; p < dataset->count; p++) {
+        const test_packet_t* packet = &dataset->packets[p];
+        uint64_t checksum = mask_checksum_to_size(packet->expected_checksum >> (8 * shift), width);
+        if (!add_packet_from_bytes(lane, packet->packet_data, packet->packet_length, checksum, width,
+                                   packet->description ? packet->description : "")) {
+            free_packet_dataset(lane);
+            return NULL;
+        }
+    }
+    return lane;
+}
+
+// Exhaustive search over a derived dataset; its solutions are appended to results tagged
+// with the checksum bytes they cover
+static bool search_lane(const config_t* config, packet_dataset_t* lane, size_t width, uint8_t bytes,
+                        search_results_t* results, size_t* solutions_found) {
+    config_t lane_config = *config;
+    lane_config.dataset = lane;
+    lane_config.checksum_size = width;
+    lane_config.strategy = STRATEGY_EXHAUSTIVE;
+
+    search_results_t* lane_results = create_search_results(16);
+    if (!lane_results) return false;
+    bool success = execute_weighted_checksum_search(&lane_config, lane_results, NULL);
+
+    add_search_statistics(results, lane_results);
+    for (size_t i = 0; i < lane_results->solution_count; i++) {
+        checksum_solution_t solution = lane_results->solutions[i];
+        solution.checksum_bytes = bytes;
+        add_solution(results, &solution);
+    }
+    *solutions_found = lane_results->solution_count;
+    free_search_results(lane_results);
+    return success;
+}
+
+bool execute_byte_lane_search(const config_t* config, search_results_t* results) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) {
+        return false;
+    }
+    size_t width = config->checksum_size;
+    if (width < 2 || width > 8) {
+        config_t whole = *config;
+        whole.strategy = STRATEGY_EXHAUSTIVE;
+        return execute_weighted_checksum_search(&whole, results, NULL);
+    }
+
+    results->search_completed = true;
+    size_t lane_solutions[8] = {0};
+    unsigned failed = 0;
+    for (size_t b = 0; b < width; b++) {
+        printf("🧩 Checksum byte %zu (bits %zu-%zu) as a 1-byte search\n", b, 8 * b + 7, 8 * b);
+        packet_dataset_t* lane = create_lane_dataset(config->dataset, b, 1);
+        bool success = lane && search_lane(config, lane, 1, (uint8_t)(1u << b), results, &lane_solutions[b]);
+        free_packet_dataset(lane);
+        if (!success) return false;
+        if (lane_solutions[b] == 0) failed |= 1u << b;
+    }
+
+    // Carries only travel upwards, so the joint search spans byte 0 to the highest failure.
+    // A span of one byte is the byte 0 search again and is skipped.
+    size_t joint_width = failed ? (size_t)(32 - __builtin_clz(failed)) : 0;
+    size_t joint_solutions = 0;
+    if (joint_width > 1) {
+        printf("🧩 Checksum bytes 0-%zu jointly at %zu-byte width\n", joint_width - 1, joint_width);
+        packet_dataset_t* joint = create_lane_dataset(config->dataset, 0, joint_width);
+        bool success = joint && search_lane(config, joint, joint_width, (uint8_t)((1u << joint_width) - 1),
+                                            results, &joint_solutions);
+        free_packet_dataset(joint);
+        if (!success) return false;
+    }
+
+    // A full checksum takes one joint chain (if any) and one chain per byte above it
+    bool covered = joint_width <= 1 ? failed == 0 : joint_solutions > 0;
+    double combinations = joint_width > 1 ? (double)joint_solutions : 1.0;
+    for (size_t b = joint_width > 1 ? joint_width : 0; b < width; b++) {
+        covered &= lane_solutions[b] > 0;
+        combinations *= (double)lane_solutions[b];
+    }
+
+    printf("\n🧩 Byte decomposition:\n");
+    for (size_t b = 0; b < width; b++) {
+        if (lane_solutions[b] > 0) {
+            printf("   byte %zu: %zu independent chains\n", b, lane_solutions[b]);
+        } else {
+            printf("   byte %zu: no independent chain\n", b);
+        }
+    }
+    if (joint_width > 1) {
+        printf("   bytes 0-%zu jointly: %zu chains\n", joint_width - 1, joint_solutions);
+    }
+    if (covered) {
+        printf("   every byte explained: %.0f combined %zu-byte checksums\n", combinations, width);
+    } else {
+        printf("   some bytes are not explained by any chain\n");
+    }
+    return true;
+}
@@ -0,0 +1,308 @@
+// Chain bytecode compiler, threaded interpreter and text form.
+//
+// The interpreter dispatches through a label table (GCC labels-as-values) so every
+// instruction ends in its own indirect jump; other compilers get the same bodies inside
+// a switch. Serialised layout, as bytes before hex encoding:
+//   version, checksum_size, highest field offset, constant_count,
+//   constants (checksum_size bytes each, most significant first), code
+
+#include "chain_bytecode.h"
+#include "../../include/sequence_evaluator.h"
+#include "../algorithms/width_ops.h"
+#include <string.h>
+#include <stdio.h>
+
+#define CHAIN_PROGRAM_VERSION 1
+
+#if defined(__GNUC__) && !defined(CADS_NO_COMPUTED_GOTO)
+#define CHAIN_THREADED 1
+#else
+#define CHAIN_THREADED 0
+#endif
+
+// Operand bytes after each opcode
+static const uint8_t operand_bytes[BC_OPCODE_COUNT] = {
+    [BC_LOAD] = 1, [BC_FIELD_ADD] = 1, [BC_FIELD_SUB] = 1, [BC_FIELD_XOR] = 1,
+    [BC_FIELD_CALL] = 2, [BC_CONST_ADD] = 1, [BC_CONST_SUB] = 1, [BC_CONST_XOR] = 1,
+    [BC_CONST_CALL] = 2, [BC_CALL] = 1, [BC_CONST_ADD_RETURN] = 1, [BC_RETURN] = 0,
+};
+
+static uint64_t width_mask(size_t checksum_size) {
+    return checksum_size >= 8 ? UINT64_MAX : (1ULL << (checksum_size * 8)) - 1;
+}
+
+// What execute_algorithm yields for an op missing from the registry
+static uint64_t unregistered_operation(uint64_t a, uint64_t b, uint64_t constant) {
+    (void)a;
+    (void)b;
+    (void)constant;
+    return 0;
+}
+
+static bool resolve_operation(chain_program_t* program, uint8_t op) {
+    if (op >= NUM_OPS) return false;
+    if (program->funcs[op]) return true;
+    algorithm_inverse_func_t inverse;
+    if (get_width_operation((operation_t)op, program->checksum_size, &program->funcs[op], &inverse)) return true;
+    const algorithm_registry_entry_t* entry = get_algorithm_by_operation((operation_t)op);
+    program->funcs[op] = entry && entry->func ? entry->func : unregistered_operation;
+    return true;
+}
+
+static void reset_program(chain_program_t* program, size_t checksum_size) {
+    memset(program, 0, sizeof(*program));
+    program->checksum_size = checksum_size;
+    program->mask = width_mask(checksum_size);
+}
+
+bool compile_chain_program(chain_program_t* program,
+                           const uint8_t* field_permutation, int field_count,
+                           const operation_t* operations, int operation_count,
+                           const uint64_t* constants, int constant_count,
+                           size_t checksum_size) {
+    if (!program || !field_permutation || field_count < 1 || (operation_count > 0 && !operations)) return false;
+    if (operation_count > CADS_MAX_SOLUTION_OPS || constant_count > CADS_MAX_CHAIN_CONSTANTS) return false;
+    reset_program(program, checksum_size);
+    program->constant_count = constant_count > 0 ? constant_count : 1;
+    for (int k = 0; k < constant_count; k++) program->constants[k] = constants[k];
+
+    int highest = field_permutation[0];
+    for (int f = 1; f < field_count; f++) {
+        if (field_permutation[f] > highest) highest = field_permutation[f];
+    }
+    program->field_limit = highest + 1;
+
+    uint8_t* code = program->code;
+    size_t pc = 0;
+    size_t last = 0;   // Start of the last op's instruction; 0 while only the LOAD is emitted
+    code[pc++] = BC_LOAD;
+    code[pc++] = field_permutation[0];
+    int cursor = 1;
+    int constant_ops = 0;
+    for (int i = 0; i < operation_count; i++) {
+        operation_t op = operations[i];
+        operand_kind_t kind = get_operation_operand_kind(op);
+        if (kind == OPERAND_FIELD && cursor >= field_count) break; // Out of fields: the rest is skipped
+        if (!resolve_operation(program, (uint8_t)op)) return false;
+        last = pc;
+        switch (kind) {
+            case OPERAND_NONE:
+                code[pc++] = BC_CALL;
+                code[pc++] = (uint8_t)op;
+                break;
+            case OPERAND_CONSTANT: {
+                uint8_t slot = (uint8_t)(constant_ops < program->constant_count ? constant_ops
+                                                                                  : program->constant_count - 1);
+                constant_ops++;
+                if (op == OP_CONST_ADD) code[pc++] = BC_CONST_ADD;
+                else if (op == OP_CONST_SUB) code[pc++] = BC_CONST_SUB;
+                else if (op == OP_CONST_XOR) code[pc++] = BC_CONST_XOR;
+                else {
+                    code[pc++] = BC_CONST_CALL;
+                    code[pc++] = (uint8_t)op;
+                }
+                code[pc++] = slot;
+                break;
+            }
+            case OPERAND_FIELD:
+                if (op == OP_ADD) code[pc++] = BC_FIELD_ADD;
+                else if (op == OP_SUB) code[pc++] = BC_FIELD_SUB;
+                else if (op == OP_XOR) code[pc++] = BC_FIELD_XOR;
+                else {
+                    code[pc++] = BC_FIELD_CALL;
+                    code[pc++] = (uint8_t)op;
+                }
+                code[pc++] = field_permutation[cursor++];
+                break;
+        }
+    }
+    if (last && code[last] == BC_CONST_ADD) {
+        code[last] = BC_CONST_ADD_RETURN;
+    } else {
+        code[pc++] = BC_RETURN;
+    }
+    program->length = pc;
+    return true;
+}
+
+bool compile_solution_program(chain_program_t* program, const checksum_solution_t* solution) {
+    if (!solution) return false;
+    uint64_t constants[CADS_MAX_CHAIN_CONSTANTS];
+    constants[0] = solution->constant;
+    int count = 1;
+    for (int k = 0; k < solution->extra_constant_count && count < CADS_MAX_CHAIN_CONSTANTS; k++) {
+        constants[count++] = solution->extra_constants[k];
+    }
+    return compile_chain_program(program, solution->field_indices, solution->field_count,
+                                 solution->operations, solution->operation_count,
+                                 constants, count, solution->checksum_size);
+}
+
+// Same bytes and truncation at the packet end as extract_packet_field_value
+static inline uint64_t load_field(const uint8_t* data, size_t length, uint8_t offset, size_t width) {
+    if (width <= 1) return data[offset];
+    uint64_t value = 0;
+    for (size_t i = 0; i < width && offset + i < length; i++) {
+        value = (value << 8) | data[offset + i];
+    }
+    return value;
+}
+
+uint64_t run_chain_program(const chain_program_t* program, const uint8_t* data, size_t length) {
+    const uint8_t* pc = program->code;
+    const uint64_t* constants = program->constants;
+    size_t width = program->checksum_size;
+    uint64_t acc = 0;
+
+#if CHAIN_THREADED
+    static const void* const labels[BC_OPCODE_COUNT] = {
+        [BC_LOAD] = &&op_load, [BC_FIELD_ADD] = &&op_field_add, [BC_FIELD_SUB] = &&op_field_sub,
+        [BC_FIELD_XOR] = &&op_field_xor, [BC_FIELD_CALL] = &&op_field_call,
+        [BC_CONST_ADD] = &&op_const_add, [BC_CONST_SUB] = &&op_const_sub,
+        [BC_CONST_XOR] = &&op_const_xor, [BC_CONST_CALL] = &&op_const_call, [BC_CALL] = &&op_call,
+        [BC_CONST_ADD_RETURN] = &&op_const_add_return, [BC_RETURN] = &&op_return,
+    };
+#define VM_CASE(label, opcode) label
+#define VM_NEXT(size) do { pc += (size); goto *labels[*pc]; } while (0)
+    goto *labels[*pc];
+#else
+#define VM_CASE(label, opcode) case opcode
+#define VM_NEXT(size) do { pc += (size); goto dispatch; } while (0)
+dispatch:
+    switch (*pc) {
+#endif
+    VM_CASE(op_load, BC_LOAD):
+        acc = load_field(data, length, pc[1], width);
+        VM_NEXT(2);
+    VM_CASE(op_field_add, BC_FIELD_ADD):
+        acc += load_field(data, length, pc[1], width);
+        VM_NEXT(2);
+    VM_CASE(op_field_sub, BC_FIELD_SUB):
+        acc -= load_field(data, length, pc[1], width);
+        VM_NEXT(2);
+    VM_CASE(op_field_xor, BC_FIELD_XOR):
+        acc ^= load_field(data, length, pc[1], width);
+        VM_NEXT(2);
+    VM_CASE(op_field_call, BC_FIELD_CALL):
+        acc = program->funcs[pc[1]](acc, load_field(data, length, pc[2], width), 0);
+        VM_NEXT(3);
+    VM_CASE(op_const_add, BC_CONST_ADD):
+        acc += constants[pc[1]];
+        VM_NEXT(2);
+    VM_CASE(op_const_sub, BC_CONST_SUB):
+        acc -= constants[pc[1]];
+        VM_NEXT(2);
+    VM_CASE(op_const_xor, BC_CONST_XOR):
+        acc ^= constants[pc[1]];
+        VM_NEXT(2);
+    VM_CASE(op_const_call, BC_CONST_CALL):
+        acc = program->funcs[pc[1]](acc, 0, constants[pc[2]]);
+        VM_NEXT(3);
+    VM_CASE(op_call, BC_CALL):
+        acc = program->funcs[pc[1]](acc, 0, 0);
+        VM_NEXT(2);
+    VM_CASE(op_const_add_return, BC_CONST_ADD_RETURN):
+        return (acc + constants[pc[1]]) & program->mask;
+    VM_CASE(op_return, BC_RETURN):
+        return acc & program->mask;
+#if !CHAIN_THREADED
+    default:
+        return acc & program->mask;
+    }
+#endif
+#undef VM_CASE
+#undef VM_NEXT
+}
+
+bool format_chain_program(const chain_program_t* program, char* text, size_t text_size) {
+    uint8_t bytes[4 + 8 * CADS_MAX_CHAIN_CONSTANTS + CHAIN_PROGRAM_MAX_CODE];
+    size_t n = 0;
+    size_t width = program->checksum_size;
+    if (width < 1 || width > 8) return false;
+    bytes[n++] = CHAIN_PROGRAM_VERSION;
+    bytes[n++] = (uint8_t)program->checksum_size;
+    bytes[n++] = (uint8_t)(program->field_limit - 1);
+    bytes[n++] = (uint8_t)program->constant_count;
+    for (int k = 0; k < program->constant_count; k++) {
+        for (size_t b = width; b-- > 0;) bytes[n++] = (uint8_t)(program->constants[k] >> (8 * b));
+    }
+    memcpy(bytes + n, program->code, program->length);
+    n += program->length;
+    if (text_size < 2 * n + 1) return false;
+    for (size_t i = 0; i < n; i++) {
+        snprintf(text + 2 * i, 3, "%02X", bytes[i]);
+    }
+    text[2 * n] = '\0';
+    return true;
+}
+
+static int hex_digit(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Every instruction well formed, operands in range, LOAD first and a return last
+static bool check_code(chain_program_t* program, int highest_offset) {
+    const uint8_t* code = program->code;
+    size_t pc = 0;
+    while (pc < program->length) {
+        uint8_t opcode = code[pc];
+        if (opcode >= BC_OPCODE_COUNT || (pc == 0) != (opcode == BC_LOAD)) return false;
+        if (pc + 1 + operand_bytes[opcode] > program->length) return false;
+        const uint8_t* operands = &code[pc + 1];
+        switch (opcode) {
+            case BC_LOAD: case BC_FIELD_ADD: case BC_FIELD_SUB: case BC_FIELD_XOR:
+                if (operands[0] > highest_offset) return false;
+                break;
+            case BC_FIELD_CALL:
+                if (!resolve_operation(program, operands[0]) || operands[1] > highest_offset) return false;
+                break;
+            case BC_CONST_CALL:
+                if (!resolve_operation(program, operands[0]) || operands[1] >= program->constant_count) return false;
+                break;
+            case BC_CALL:
+                if (!resolve_operation(program, operands[0])) return false;
+                break;
+            case BC_CONST_ADD: case BC_CONST_SUB: case BC_CONST_XOR: case BC_CONST_ADD_RETURN:
+                if (operands[0] >= program->constant_count) return false;
+                break;
+            default:
+                break;
+        }
+        pc += 1 + operand_bytes[opcode];
+        if (opcode == BC_RETURN || opcode == BC_CONST_ADD_RETURN) return pc == program->length;
+    }
+    return false;
+}
+
+bool parse_chain_program(chain_program_t* program, const char* text) {
+    if (!program || !text) return false;
+    uint8_t bytes[4 + 8 * CADS_MAX_CHAIN_CONSTANTS + CHAIN_PROGRAM_MAX_CODE];
+    size_t n = 0;
+    for (const char* p = text; *p; p += 2) {
+        int high = hex_digit(p[0]);
+        int low = high < 0 ? -1 : hex_digit(p[1]);
+        if (low < 0 || n == sizeof(bytes)) return false;
+        bytes[n++] = (uint8_t)(high << 4 | low);
+    }
+    if (n < 4 || bytes[0] != CHAIN_PROGRAM_VERSION) return false;
+    size_t checksum_size = bytes[1];
+    int constant_count = bytes[3];
+    if (checksum_size < 1 || checksum_size > 8) return false;
+    if (constant_count < 1 || constant_count > CADS_MAX_CHAIN_CONSTANTS) return false;
+    size_t header = 4 + (size_t)constant_count * checksum_size;
+    if (n <= header || n - header > CHAIN_PROGRAM_MAX_CODE) return false;
+
+    reset_program(program, checksum_size);
+    program->field_limit = bytes[2] + 1;
+    program->constant_count = constant_count;
+    const uint8_t* value = &bytes[4];
+    for (int k = 0; k < constant_count; k++) {
+        for (size_t b = 0; b < checksum_size; b++) program->constants[k] = program->constants[k] << 8 | *value++;
+    }
+    program->length = n - header;
+    memcpy(program->code, bytes + header, program->length);
+    return check_code(program, bytes[2]);
+}
@@ -0,0 +1,71 @@
+#ifndef CHAIN_BYTECODE_H
+#define CHAIN_BYTECODE_H
+
+#include "../../include/cads_types.h"
+#include "../../include/algorithm_registry.h"
+
+// Compact bytecode for one complete chain: field offsets, ops and constants resolved at
+// compile time, so evaluating a packet is a single pass of a threaded interpreter with no
+// registry lookups. The same bytes, with a short header, are the serialised form of a
+// solution.
+//
+// Instructions are one opcode byte followed by at most two operand bytes. Field operands
+// are byte offsets into the packet; constant operands index the program's constant pool.
+// Frequent pairs are fused: a field load with ADD, SUB or XOR, and a final C+ with the
+// checksum mask.
+
+typedef enum {
+    BC_LOAD = 0,            // off:      acc = field(off)
+    BC_FIELD_ADD,           // off:      acc += field(off)
+    BC_FIELD_SUB,           // off:      acc -= field(off)
+    BC_FIELD_XOR,           // off:      acc ^= field(off)
+    BC_FIELD_CALL,          // op, off:  acc = op(acc, field(off), 0)
+    BC_CONST_ADD,           // k:        acc += constants[k]
+    BC_CONST_SUB,           // k:        acc -= constants[k]
+    BC_CONST_XOR,           // k:        acc ^= constants[k]
+    BC_CONST_CALL,          // op, k:    acc = op(acc, 0, constants[k])
+    BC_CALL,                // op:       acc = op(acc, 0, 0)
+    BC_CONST_ADD_RETURN,    // k:        return (acc + constants[k]) & mask
+    BC_RETURN,              //           return acc & mask
+    BC_OPCODE_COUNT
+} chain_opcode_t;
+
+// LOAD, one instruction per op and the return
+#define CHAIN_PROGRAM_MAX_CODE (2 + 3 * CADS_MAX_SOLUTION_OPS + 1)
+
+typedef struct {
+    uint8_t code[CHAIN_PROGRAM_MAX_CODE];
+    size_t length;
+    uint64_t constants[CADS_MAX_CHAIN_CONSTANTS];
+    int constant_count;
+    size_t checksum_size;
+    uint64_t mask;                     // Checksum mask applied by the return
+    int field_limit;                   // Packets must be longer than every permutation offset
+    algorithm_func_t funcs[NUM_OPS];   // Resolved for the ops the code calls
+} chain_program_t;
+
+// Compile a chain the way evaluate_operation_sequence reads it: field 0 seeds the value,
+// FIELD ops consume the permutation in order and the chain stops at the first FIELD op
+// with no field left. The k-th constant op reads constants[k], the last one is reused
+// beyond constant_count. Returns false when the chain does not fit a program.
+bool compile_chain_program(chain_program_t* program,
+                           const uint8_t* field_permutation, int field_count,
+                           const operation_t* operations, int operation_count,
+                           const uint64_t* constants, int constant_count,
+                           size_t checksum_size);
+
+bool compile_solution_program(chain_program_t* program, const checksum_solution_t* solution);
+
+// Masked checksum of one packet; the caller has checked length against field_limit
+uint64_t run_chain_program(const chain_program_t* program, const uint8_t* data, size_t length);
+
+// Hex text of the header and code, two characters per byte plus the terminator
+#define CHAIN_PROGRAM_TEXT_MAX (2 * (4 + 8 * CADS_MAX_CHAIN_CONSTANTS + CHAIN_PROGRAM_MAX_CODE) + 1)
+
+bool format_chain_program(const chain_program_t* program, char* text, size_t text_size);
+
+// Parse format_chain_program output and resolve its ops; rejects malformed code and
+// unknown ops
+bool parse_chain_program(chain_program_t* program, const char* text);
+
+#endif // CHAIN_BYTECODE_H
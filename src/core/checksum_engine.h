@@ -3,6 +3,7 @@
 
 #include "../../include/cads_types.h"
 #include "../../include/cads_config_loader.h"
+#include "../../include/algorithm_registry.h"
 #include "packet_data.h"
 #include "progress_tracker.h"
 
@@ -22,6 +23,15 @@ bool validate_solution(const checksum_solution_t* solution, const packet_dataset
 // Search strategy functions
 bool should_continue_search(const search_results_t* results, const config_t* config);
 uint64_t estimate_search_space(const packet_dataset_t* dataset, const config_t* config);
+bool select_search_algorithms(const config_t* config, algorithm_registry_entry_t* algorithms, int* algorithm_count);
+void sort_search_solutions(search_results_t* results);
+
+// Switch width-dependent operations to the checksum size's instantiation, build the lookup
+// tables the selected operations can use (PCRC polynomials up to max_constants) and, with
+// --jit, their native kernels. Call before worker threads start;
+// cleanup_algorithm_registry frees them.
+void prepare_operation_tables(const config_t* config, algorithm_registry_entry_t* algorithms,
+                              int algorithm_count);
 
 // Algorithm testing
 bool test_algorithm_combination(const uint8_t* field_indices, uint8_t field_count,
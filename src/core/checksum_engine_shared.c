@@ -2,7 +2,11 @@
 // Provides result container management and basic field/masking helpers used by evaluator & threaded engine.
 
 #include "checksum_engine.h"
+#include "../algorithms/advanced_ops.h"
+#include "../algorithms/width_ops.h"
+#include "operation_jit.h"
 #include <stdio.h>
+#include <sys/time.h>
 // Optional precomputed field value cache (packet_index x field_index)
 static uint64_t** g_field_cache = NULL;
 static size_t g_field_cache_packets = 0;
@@ -63,7 +67,12 @@ static int compare_solutions(const void* a, const void* b) {
         if (A->operations[i] != B->operations[i]) return (int)A->operations[i] - (int)B->operations[i];
     }
     if (A->constant != B->constant) return (A->constant < B->constant) ? -1 : 1;
+    if (A->extra_constant_count != B->extra_constant_count) return A->extra_constant_count - B->extra_constant_count;
+    for (int i = 0; i < A->extra_constant_count; i++) {
+        if (A->extra_constants[i] != B->extra_constants[i]) return (int)A->extra_constants[i] - (int)B->extra_constants[i];
+    }
     if (A->checksum_size != B->checksum_size) return (int)A->checksum_size - (int)B->checksum_size;
+    if (A->checksum_bytes != B->checksum_bytes) return (int)A->checksum_bytes - (int)B->checksum_bytes;
     return 0;
 }
 
@@ -89,12 +98,25 @@ search_results_t* create_search_results(size_t initial_capacity) {
     results->tests_performed = 0;
     results->search_completed = false;
     results->early_exit_triggered = false;
+    results->prefixes_pruned = 0;
+    results->equivalent_prefixes = 0;
+    results->unary_runs_collapsed = 0;
+    memset(results->conflicts_pruned, 0, sizeof(results->conflicts_pruned));
+    results->memo_solutions_replayed = 0;
+    results->memo_solutions_dropped = 0;
+    results->mitm_table_bytes = 0;
+    results->crc_models = NULL;
+    results->crc_model_count = 0;
+    results->range_models = NULL;
+    results->range_model_count = 0;
     return results;
 }
 
 void free_search_results(search_results_t* results) {
     if (!results) return;
     free(results->solutions);
+    free(results->crc_models);
+    free(results->range_models);
     free(results);
 }
 
@@ -112,6 +134,60 @@ bool add_solution(search_results_t* results, const checksum_solution_t* solution
     return true;
 }
 
+bool add_unique_solution(search_results_t* results, const checksum_solution_t* solution) {
+    if (!results || !solution) return false;
+    for (size_t i = 0; i < results->solution_count; i++) {
+        if (compare_solutions(&results->solutions[i], solution) == 0) return false;
+    }
+    return add_solution(results, solution);
+}
+
+bool add_crc_model(search_results_t* results, const crc_model_t* model) {
+    if (!results || !model) return false;
+    crc_model_t* models = realloc(results->crc_models, (results->crc_model_count + 1) * sizeof(crc_model_t));
+    if (!models) return false;
+    models[results->crc_model_count++] = *model;
+    results->crc_models = models;
+    return true;
+}
+
+bool add_range_model(search_results_t* results, const range_model_t* model) {
+    if (!results || !model) return false;
+    range_model_t* models = realloc(results->range_models, (results->range_model_count + 1) * sizeof(range_model_t));
+    if (!models) return false;
+    models[results->range_model_count++] = *model;
+    results->range_models = models;
+    return true;
+}
+
+void add_search_statistics(search_results_t* results, const search_results_t* from) {
+    results->tests_performed += from->tests_performed;
+    results->prefixes_pruned += from->prefixes_pruned;
+    results->equivalent_prefixes += from->equivalent_prefixes;
+    results->unary_runs_collapsed += from->unary_runs_collapsed;
+    for (int d = 0; d < CADS_MAX_SOLUTION_OPS; d++) results->conflicts_pruned[d] += from->conflicts_pruned[d];
+    results->memo_solutions_replayed += from->memo_solutions_replayed;
+    results->memo_solutions_dropped += from->memo_solutions_dropped;
+    results->search_completed &= from->search_completed;
+    results->early_exit_triggered |= from->early_exit_triggered;
+}
+
+bool select_search_algorithms(const config_t* config, algorithm_registry_entry_t* algorithms, int* algorithm_count) {
+    if (config->custom_operation_count > 0 && config->custom_operations) {
+        if (config->custom_operation_count > 32) return false;
+        for (int i = 0; i < config->custom_operation_count; i++) {
+            const algorithm_registry_entry_t* entry = get_algorithm_by_operation(config->custom_operations[i]);
+            if (!entry) return false;
+            algorithms[i] = *entry;
+        }
+        *algorithm_count = config->custom_operation_count;
+    } else {
+        const algorithm_registry_entry_t* complexity_algorithms = get_algorithms_by_complexity(config->complexity, algorithm_count);
+        memcpy(algorithms, complexity_algorithms, *algorithm_count * sizeof(algorithm_registry_entry_t));
+    }
+    return true;
+}
+
 bool should_continue_search(const search_results_t* results, const config_t* config) {
     if (!results || !config) return false;
     if (config->early_exit && results->solution_count > 0) return false;
@@ -140,3 +216,54 @@ uint64_t mask_checksum_to_size(uint64_t checksum, size_t checksum_size) {
     uint64_t mask = (1ULL << (checksum_size * 8)) - 1;
     return checksum & mask;
 }
+
+// Seconds for `calls` PCRC evaluations with polynomials 0..poly_count-1
+static double time_poly_crc(int poly_count, uint64_t calls) {
+    struct timeval start, end;
+    uint64_t sink = 0;
+    gettimeofday(&start, NULL);
+    for (uint64_t i = 0; i < calls; i++) {
+        sink += advanced_poly_crc(sink + i, 0, i % (uint64_t)poly_count);
+    }
+    gettimeofday(&end, NULL);
+    volatile uint64_t keep = sink;
+    (void)keep;
+    return (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+}
+
+// --jit: native packet loops for the ops that have an encoding, the interpreter for the rest
+static void compile_jit_kernels(const config_t* config, algorithm_registry_entry_t* algorithms, int algorithm_count) {
+    jit_summary_t summary;
+    if (!compile_operation_kernels(algorithms, algorithm_count, &summary)) {
+        printf("⚠️  JIT not available on this platform, using the interpreter\n");
+        return;
+    }
+    if (config->verbose) {
+        printf("⚙️  JIT: %d of %d operations compiled to native kernels (%zu bytes)\n",
+               summary.compiled, algorithm_count, summary.code_bytes);
+    }
+}
+
+void prepare_operation_tables(const config_t* config, algorithm_registry_entry_t* algorithms,
+                              int algorithm_count) {
+    specialise_operations_for_width(algorithms, algorithm_count, config->checksum_size);
+    if (config->jit) compile_jit_kernels(config, algorithms, algorithm_count);
+
+    bool uses_poly_crc = false;
+    for (int a = 0; a < algorithm_count; a++) uses_poly_crc |= algorithms[a].op == OP_POLY_CRC;
+    // The constant is the polynomial, so only the first max_constants ever get evaluated
+    int poly_count = config->max_constants < 256 ? config->max_constants : 256;
+    if (!uses_poly_crc || poly_count < 1) return;
+
+    const uint64_t calls = 1 << 20;
+    double bitwise = config->verbose ? time_poly_crc(poly_count, calls) : 0.0;
+    int built = build_poly_crc_bank(poly_count);
+    if (config->verbose) {
+        double table = time_poly_crc(poly_count, calls);
+        printf("🧮 PCRC table bank: %d of 256 polynomials, %.1f KiB", built, built * 256 / 1024.0);
+        if (bitwise > 0 && table > 0) {
+            printf(", %.0fM -> %.0fM steps/s", calls / bitwise / 1e6, calls / table / 1e6);
+        }
+        printf("\n");
+    }
+}
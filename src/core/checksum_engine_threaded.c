@@ -4,6 +4,15 @@
 #include "../utils/field_combiner.h"
 #include "../utils/search_display.h"
 #include "thread_partitioner.h"
+#include "prefix_state_cache.h"
+#include "differential_analysis.h"
+#include "field_dependency.h"
+#include "column_analysis.h"
+#include "bitsliced_kernel.h"
+#include "unary_runs.h"
+#include "injectivity_conflicts.h"
+#include "memo_store.h"
+#include "chain_bytecode.h"
 #include "../../include/sequence_evaluator.h"
 #include <stdlib.h>
 #include <string.h>
@@ -11,6 +20,10 @@
 #include <pthread.h>
 #include <unistd.h>
 #include <time.h>
+#include <limits.h>
+
+// generate_all_permutations stops at four fields; wider masks are never searched
+#define MAX_SEARCHED_FIELDS 4
 
 // Forward declarations
 typedef struct weighted_thread_context_s weighted_thread_context_t;
@@ -77,6 +90,14 @@ struct weighted_thread_context_s {
     thread_progress_t* thread_progress;  // Per-thread progress tracking
     thread_progress_t** all_thread_progress;  // Array of all thread progress for unified view
     int total_threads;
+    size_t state_cache_bytes;            // This thread's share of config->state_cache_mb
+    const differential_analysis_t* differential;  // Influential bytes and field order, may be NULL
+    const fd_filter_t* fd_filter;        // Field sets that cannot determine the checksum, may be NULL
+    const column_analysis_t* columns;    // Interchangeable field columns, may be NULL
+    bool bitsliced;                      // Chain steps run on bit-sliced planes
+    const unary_run_table_t* unary_runs; // Mappings of unary op runs, NULL when runs are not collapsed
+    const uint32_t* covered_ops;         // Ops already searched, by field count up to MAX_SEARCHED_FIELDS
+    int completed_fields;                // Field counts this thread searched to the end before any interrupt
 };
 
 // Enhanced progress monitoring thread with per-thread support  
@@ -156,106 +177,580 @@ void print_found_solutions(const search_results_t* results, const algorithm_regi
                 }
             }
         }
-        printf("\n   Constant: 0x%02X\n\n", (unsigned int)solution->constant);
+        printf("\n   Constant: 0x%02X", (unsigned int)solution->constant);
+        for (int k = 0; k < solution->extra_constant_count; k++) {
+            printf(", 0x%02X", solution->extra_constants[k]);
+        }
+        printf("\n\n");
     }
 }
 
-// Custom recursive function that forces the first operation but explores all combinations after
-bool test_constrained_operation_sequence(const packet_dataset_t* dataset, 
-                                        const config_t* config,
-                                        const uint8_t* field_permutation,
-                                        int field_count,
-                                        const algorithm_registry_entry_t* algorithms,
-                                        int algorithm_count,
-                                        operation_t* operation_sequence,
-                                        operation_t starting_operation,
-                                        int current_depth,
-                                        int max_depth,
-                                        uint8_t constant,
-                                        search_results_t* results,
-                                        uint64_t* tests_performed) {
-    
-    // Base case: we've built a complete operation sequence, test it
-    if (current_depth >= max_depth) {
-        (*tests_performed)++;
-        
-        // Debug: Log when we test the known working solution pattern
-        if (max_depth == 4 && field_count == 4 && constant == 0x18 &&
-            field_permutation[0] == 3 && field_permutation[1] == 2 && field_permutation[2] == 4 && field_permutation[3] == 5 &&
-            operation_sequence[0] == OP_CONST_ADD && operation_sequence[1] == OP_CONST_ADD && 
-            operation_sequence[2] == OP_XOR && operation_sequence[3] == OP_XOR) {
-            printf("DEBUG: TESTING KNOWN SOLUTION PATTERN!\n");
-            printf("Fields: [%d,%d,%d,%d], Ops: [%d,%d,%d,%d], Constant: 0x%02X\n",
-                   field_permutation[0], field_permutation[1], field_permutation[2], field_permutation[3],
-                   (int)operation_sequence[0], (int)operation_sequence[1], (int)operation_sequence[2], (int)operation_sequence[3], constant);
+// Per-thread scratch for the incremental recursive search of one field mask.
+// states[d] holds every packet's running value after the first d operations, so each
+// recursion level applies a single operation instead of re-evaluating the whole chain.
+// States are only kept up to the first constant-reading op; the leaf solvers take it
+// from there for every candidate constant at once.
+// The permutation is not fixed up front: an op that reads the next field branches over
+// the mask fields not yet read, so permutations that agree on their first k fields share
+// every node above the op that reads field k + 1.
+typedef struct {
+    const config_t* config;
+    const algorithm_registry_entry_t* algorithms;
+    int algorithm_count;
+    const uint8_t* mask_fields;         // Byte offsets of the mask's fields, ascending
+    int field_count;
+    size_t packet_count;
+    const uint64_t* field_values;       // field_count x packet_count, one row per mask field
+    size_t row_stride;                  // Words per row of field_values or field_planes
+    operand_kind_t operand_kinds[NUM_OPS];
+    uint8_t slot_positions[CADS_MAX_FIELDS];  // Mask field placed in each permutation slot
+    uint32_t fields_read;               // Mask fields placed so far, by position
+    int cursors[CADS_MAX_CHAIN_DEPTH + 1];  // Field cursor before each op, also past the constant op
+    bool halts[CADS_MAX_CHAIN_DEPTH + 1];
+    uint64_t leaf_candidates[CADS_MAX_FIELDS + 1];  // constant_count * k!: a leaf leaving k fields unread
+    const uint64_t* expected;           // Expected checksums masked to checksum_size
+    bool checksum_sizes_match;          // Packets whose checksum_size differs never match
+    chain_state_t states[CADS_MAX_CHAIN_DEPTH];
+    prefix_state_cache_t* state_cache;  // NULL when prefix-state dedup is disabled
+    const uint64_t* subtree_leaves;     // algorithm_count^k, leaves under a node k levels above the leaf
+    search_results_t* results;
+    pthread_mutex_t* results_mutex;
+    uint64_t solutions_found;           // Solutions added by this thread
+    uint64_t prefixes_pruned;
+    const algorithm_registry_entry_t* path[CADS_MAX_CHAIN_DEPTH];  // Ops placed so far
+    int constant_count;                 // max_constants, capped at the 256 distinct 8-bit values
+    int constant_bits;                  // Bits needed to cover constant_count - 1
+    bool t_function;                    // Every op is a T-function: solve constants bit-serially
+    int chain_constants;                // Independent constant slots per chain (--chain-constants)
+    bool bitsliced;                     // states hold bit-sliced planes of the low 8 bits
+    const uint64_t* field_planes;       // field_count rows of bitsliced_word_count words
+    const uint64_t* expected_planes;
+    chain_state_t unsliced;             // Per-packet copy of a sliced state for the leaf solvers
+    int unsliced_depth;                 // Depth unsliced was taken from, -1 if stale
+    const unary_run_table_t* unary_runs; // NULL when unary runs are not collapsed
+    unary_run_set_t* run_sets;          // Runs explored from each start depth
+    uint8_t run_start[CADS_MAX_CHAIN_DEPTH + 1];     // Depth where the unary run ending at each state began
+    uint16_t run_mapping[CADS_MAX_CHAIN_DEPTH + 1];  // That run's mapping
+    uint64_t runs_collapsed;
+    conflict_detector_t* conflicts;     // NULL when there are fewer than two packets
+    uint64_t conflict_value_mask;       // Bits of the running value the rest of the chain can see
+    uint64_t conflicts_pruned[CADS_MAX_SOLUTION_OPS];
+    uint32_t covered_ops;               // Ops an earlier level or memo region searched for this field count
+    bool fresh[CADS_MAX_CHAIN_DEPTH + 1];  // Prefix before each op holds an op outside covered_ops
+    uint64_t covered_leaves[CADS_MAX_CHAIN_DEPTH + 1];  // covered op count^k: leaves an earlier level tested
+} chain_search_t;
+
+// Record the chain once per ordering of the fields it left unread, in the order
+// generate_all_permutations lists them; only the first under early exit
+static void record_field_orderings(chain_search_t* search, checksum_solution_t* solution, int slot,
+                                   uint32_t fields_read) {
+    if (slot == search->field_count) {
+        add_solution(search->results, solution);
+        search->solutions_found++;
+        return;
+    }
+    for (int position = 0; position < search->field_count; position++) {
+        if (fields_read & (1u << position)) continue;
+        solution->field_indices[slot] = search->mask_fields[position];
+        record_field_orderings(search, solution, slot + 1, fields_read | (1u << position));
+        if (search->config->early_exit) return;
+    }
+}
+
+// constants holds one value per constant slot the chain reads; slot 0 is the solution's
+// constant and the rest become its extra constants
+static void record_chain_solution(chain_search_t* search, const operation_t* operation_sequence, int max_depth,
+                                  const uint64_t* constants, int slot_count) {
+    checksum_solution_t solution = {0};
+    int fields_placed = search->cursors[max_depth];
+    for (int f = 0; f < fields_placed; f++) {
+        solution.field_indices[f] = search->mask_fields[search->slot_positions[f]];
+    }
+    solution.field_count = search->field_count;
+    for (int op = 0; op < max_depth && op < CADS_MAX_SOLUTION_OPS; op++) {
+        solution.operations[op] = operation_sequence[op];
+    }
+    solution.operation_count = max_depth;
+    solution.constant = (uint8_t)constants[0];
+    for (int k = 1; k < slot_count; k++) {
+        solution.extra_constants[k - 1] = (uint8_t)constants[k];
+    }
+    solution.extra_constant_count = slot_count > 1 ? slot_count - 1 : 0;
+    solution.checksum_size = search->config->checksum_size;
+    solution.validated = true;
+
+    // Solution found - don't print here, let main thread handle it after stopping all threads
+    pthread_mutex_lock(search->results_mutex);
+    record_field_orderings(search, &solution, fields_placed, search->fields_read);
+    pthread_mutex_unlock(search->results_mutex);
+}
+
+// (Chain, constant, permutation) candidates under a node with leaves op completions and
+// unread fields left to order, saturating
+static uint64_t subtree_candidates(const chain_search_t* search, uint64_t leaves, int unread) {
+    uint64_t per_leaf = search->leaf_candidates[unread];
+    return leaves > UINT64_MAX / per_leaf ? UINT64_MAX : leaves * per_leaf;
+}
+
+// Leaves below the op at depth with remaining ops to place, leaving out the chains an
+// earlier escalation level already tested
+static uint64_t subtree_leaves_below(const chain_search_t* search, int depth, int remaining) {
+    uint64_t leaves = search->subtree_leaves[remaining];
+    if (search->fresh[depth + 1] || leaves == UINT64_MAX) return leaves;
+    return leaves - search->covered_leaves[remaining];
+}
+
+// Candidates of a whole field_count mask: every first field, each start op and all their
+// completions to max_depth ops, leaving out covered chains as the prunes do
+static uint64_t mask_candidates(const chain_search_t* search, const operation_t* start_ops, int start_count,
+                                int field_count, int max_depth) {
+    uint64_t total = 0;
+    for (int s = 0; s < start_count; s++) {
+        uint64_t leaves = search->subtree_leaves[max_depth - 1];
+        bool fresh = search->fresh[0] || !(search->covered_ops & (1u << start_ops[s]));
+        if (!fresh && leaves != UINT64_MAX) leaves -= search->covered_leaves[max_depth - 1];
+        total += subtree_candidates(search, leaves, field_count);
+    }
+    return total;
+}
+
+// Chains made only of covered ops are skipped. Returns how many of the search's ops are covered.
+static int set_covered_operations(chain_search_t* search, uint32_t covered) {
+    int covered_count = 0;
+    for (int a = 0; a < search->algorithm_count; a++) covered_count += (covered >> search->algorithms[a].op) & 1;
+    search->covered_ops = covered;
+    search->covered_leaves[0] = 1;
+    for (int k = 1; k <= CADS_MAX_CHAIN_DEPTH; k++) {
+        search->covered_leaves[k] = search->covered_leaves[k - 1] * (uint64_t)covered_count;
+    }
+    search->fresh[0] = covered == 0;
+    return covered_count;
+}
+
+// Fields read so far, plus a bit for prefixes made only of covered ops: their subtrees
+// skip the chains an earlier level tested, so they never stand in for a fresh prefix
+static inline uint32_t prefix_field_set(const chain_search_t* search, int depth) {
+    return search->fresh[depth] ? search->fields_read : search->fields_read | (1u << 31);
+}
+
+// True when every active op is a T-function, which selects the bit-serial constant solver
+static bool algorithms_are_t_functions(const algorithm_registry_entry_t* algorithms, int algorithm_count) {
+    for (int i = 0; i < algorithm_count; i++) {
+        if (!operation_is_t_function(algorithms[i].op)) return false;
+    }
+    return algorithm_count > 0;
+}
+
+// --kernel: the bit-sliced kernel covers 1-byte checksums under T-function op sets; auto
+// times both kernels at the dataset's packet count and keeps the faster
+static bool select_bitsliced_kernel(const config_t* config, const algorithm_registry_entry_t* algorithms,
+                                    int algorithm_count) {
+    if (config->kernel == KERNEL_BYTEWISE) return false;
+    if (config->checksum_size != 1 || !algorithms_are_t_functions(algorithms, algorithm_count)) {
+        if (config->kernel == KERNEL_BITSLICED) {
+            printf("⚠️  Bit-sliced kernel needs a 1-byte checksum and T-function ops, using the byte-wise kernel\n");
         }
-        
-        
-    bool all_match = evaluate_operation_sequence(dataset, config, field_permutation, field_count, operation_sequence, max_depth, constant);
-    if (all_match) {
-            // Found a solution!
-            checksum_solution_t solution = {0};
-            for (int f = 0; f < field_count; f++) {
-                solution.field_indices[f] = field_permutation[f];
-            }
-            solution.field_count = field_count;
-            for (int op = 0; op < max_depth && op < 4; op++) {
-                solution.operations[op] = operation_sequence[op];
+        return false;
+    }
+    if (config->kernel == KERNEL_BITSLICED && !config->verbose) return true;
+
+    double bytewise = 0.0, bitsliced = 0.0;
+    bool faster = bitsliced_kernel_faster(algorithms, algorithm_count, config->dataset->count,
+                                          &bytewise, &bitsliced);
+    bool chosen = config->kernel == KERNEL_BITSLICED || faster;
+    if (config->verbose) {
+        printf("🧵 Step kernel: %s (%.0fM byte-wise vs %.0fM bit-sliced packet-steps/s)\n",
+               chosen ? "bit-sliced" : "byte-wise", bytewise / 1e6, bitsliced / 1e6);
+    }
+    return chosen;
+}
+
+// Extend every slot's constant one bit at a time: a candidate whose low bits already
+// disagree with some packet's low checksum bits is dropped together with all its completions.
+// With m slots each bit position tries the 2^m combinations of the slots' next bits.
+static bool solve_constant_bits(chain_search_t* search, operation_t* operation_sequence,
+                                const chain_tail_t* tail, const chain_state_t* from, int max_depth,
+                                const uint64_t* low_bits, int bit) {
+    uint64_t checksum_mask = mask_checksum_to_size(UINT64_MAX, search->config->checksum_size);
+    int slots = tail->slot_count;
+    bool last = bit + 1 >= search->constant_bits;
+    uint64_t bit_mask = last ? checksum_mask : (checksum_mask & ((2ULL << bit) - 1));
+    bool found = false;
+    for (uint32_t combination = 0; combination < (1u << slots); combination++) {
+        if (bit >= search->constant_bits && combination) break;
+        uint64_t constants[CADS_MAX_CHAIN_CONSTANTS];
+        bool in_range = true;
+        for (int k = 0; k < slots; k++) {
+            constants[k] = low_bits[k] | ((uint64_t)((combination >> k) & 1) << bit);
+            in_range &= constants[k] < (uint64_t)search->constant_count;
+        }
+        if (!in_range) continue;
+        if (!chain_tail_matches(tail, from, search->field_values,
+                                search->packet_count, constants, search->expected, bit_mask)) {
+            continue;
+        }
+        if (last) {
+            record_chain_solution(search, operation_sequence, max_depth, constants, slots);
+            found = true;
+        } else {
+            found |= solve_constant_bits(search, operation_sequence, tail, from, max_depth,
+                                         constants, bit + 1);
+        }
+        if (found && search->config->early_exit) return true;
+    }
+    return found;
+}
+
+// Solve the last slot with the others fixed. A last slot read once by C+, C- or C^ under
+// invertible ops is peeled from packet 0 and checked on the rest; otherwise the set of
+// still-possible constants is carried across packets, each packet clearing the candidates
+// it rejects, and the chain is dropped as soon as the set empties.
+static bool solve_last_constant(chain_search_t* search, operation_t* operation_sequence,
+                                const chain_tail_t* tail, bool peelable, const chain_state_t* from,
+                                int max_depth, uint64_t* constants) {
+    int free_slot = tail->slot_count - 1;
+    size_t checksum_size = search->config->checksum_size;
+
+    if (peelable) {
+        uint64_t constant = chain_tail_peel_constant(tail, from, search->field_values, search->packet_count, 0,
+                                                     constants, search->expected[0], checksum_size);
+        if (constant >= (uint64_t)search->constant_count) return false;
+        constants[free_slot] = constant;
+        if (!chain_tail_matches(tail, from, search->field_values, search->packet_count, constants,
+                                search->expected, mask_checksum_to_size(UINT64_MAX, checksum_size))) {
+            return false;
+        }
+        record_chain_solution(search, operation_sequence, max_depth, constants, tail->slot_count);
+        return true;
+    }
+
+    uint64_t candidates[CONSTANT_SET_WORDS] = {0};
+    for (int c = 0; c < search->constant_count; c++) {
+        candidates[c >> 6] |= 1ULL << (c & 63);
+    }
+    for (size_t p = 0; p < search->packet_count; p++) {
+        if (!chain_tail_filter_constants(tail, from, search->field_values, search->packet_count, p, constants,
+                                         free_slot, search->expected[p], checksum_size, candidates)) {
+            return false;
+        }
+    }
+    for (int w = 0; w < CONSTANT_SET_WORDS; w++) {
+        for (uint64_t bits = candidates[w]; bits; bits &= bits - 1) {
+            constants[free_slot] = (uint64_t)(w * 64 + __builtin_ctzll(bits));
+            record_chain_solution(search, operation_sequence, max_depth, constants, tail->slot_count);
+            if (search->config->early_exit) return true;
+        }
+    }
+    return true;
+}
+
+// Enumerate every slot but the last, then solve the last one directly
+static bool solve_constant_slots(chain_search_t* search, operation_t* operation_sequence,
+                                 const chain_tail_t* tail, bool peelable, const chain_state_t* from,
+                                 int max_depth, uint64_t* constants, int slot) {
+    if (slot == tail->slot_count - 1) {
+        return solve_last_constant(search, operation_sequence, tail, peelable, from, max_depth, constants);
+    }
+    bool found = false;
+    for (int c = 0; c < search->constant_count; c++) {
+        constants[slot] = (uint64_t)c;
+        found |= solve_constant_slots(search, operation_sequence, tail, peelable, from, max_depth,
+                                      constants, slot + 1);
+        if (found && search->config->early_exit) return true;
+    }
+    return found;
+}
+
+// Per-packet state at depth for the leaf solvers. Sliced states are unpacked once and
+// reused by the sibling leaves that start their constant ops at the same depth.
+static const chain_state_t* per_packet_state(chain_search_t* search, int depth) {
+    if (!search->bitsliced) return &search->states[depth];
+    if (search->unsliced_depth != depth) {
+        unbitslice_values(search->states[depth].values, search->packet_count, search->unsliced.values);
+        search->unsliced.field_cursor = search->states[depth].field_cursor;
+        search->unsliced.halted = search->states[depth].halted;
+        search->unsliced_depth = depth;
+    }
+    return &search->unsliced;
+}
+
+// Leaf solver for chains that read a constant: constant_depth is the first constant op
+static bool solve_chain_constants(chain_search_t* search, operation_t* operation_sequence,
+                                  int constant_depth, int max_depth) {
+    const chain_state_t* from = per_packet_state(search, constant_depth);
+    chain_tail_t tail;
+    build_chain_tail(&tail, from, &search->path[constant_depth],
+                     max_depth - constant_depth, search->field_count, search->chain_constants);
+    // Read the mask rows directly: slot k holds the field at slot_positions[k]
+    for (int op = 0; op < tail.operation_count; op++) {
+        if (tail.fields[op] >= 0) tail.fields[op] = search->slot_positions[tail.fields[op]];
+    }
+    uint64_t constants[CADS_MAX_CHAIN_CONSTANTS] = {0};
+    if (search->t_function) {
+        return solve_constant_bits(search, operation_sequence, &tail, from, max_depth, constants, 0);
+    }
+    return solve_constant_slots(search, operation_sequence, &tail, chain_tail_peelable(&tail),
+                                from, max_depth, constants, 0);
+}
+
+// Track the unary run ending after algorithm at depth and look it up among the runs
+// explored from the same start state. run_set is left NULL when the run is not stored.
+static prefix_state_status_t visit_unary_run(chain_search_t* search, const algorithm_registry_entry_t* algorithm,
+                                             int depth, int constant_depth,
+                                             unary_run_set_t** run_set, size_t* run_slot) {
+    const unary_run_table_t* table = search->unary_runs;
+    operation_t op = algorithm->op;
+    if (table->unary_index[op] < 0) {
+        search->run_start[depth + 1] = (uint8_t)(depth + 1);
+        search->run_mapping[depth + 1] = UNARY_RUN_IDENTITY;
+        return PREFIX_STATE_NEW;
+    }
+
+    bool halted = search->halts[depth + 1];
+    uint16_t mapping = search->run_mapping[depth];
+    if (!halted) mapping = unary_run_step(table, mapping, op);
+    search->run_start[depth + 1] = search->run_start[depth];
+    search->run_mapping[depth + 1] = mapping;
+    if (constant_depth >= 0 || mapping == UNARY_RUN_UNKNOWN) return PREFIX_STATE_NEW;
+
+    unary_run_set_t* set = &search->run_sets[search->run_start[depth]];
+    uint64_t key = unary_run_key(mapping, depth + 1, search->cursors[depth + 1], halted,
+                                 prefix_field_set(search, depth + 1));
+    prefix_state_status_t status = unary_run_set_visit(set, key, run_slot);
+    if (*run_slot != SIZE_MAX) *run_set = set;
+    return status;
+}
+
+// Put algorithm at depth and derive the field cursor after it with advance_chain_state's
+// rules. Returns whether it reads the next permutation slot.
+static inline bool place_operation(chain_search_t* search, operation_t* operation_sequence,
+                                   const algorithm_registry_entry_t* algorithm, int depth) {
+    int cursor = search->cursors[depth];
+    bool field = search->operand_kinds[algorithm->op] == OPERAND_FIELD;
+    operation_sequence[depth] = algorithm->op;
+    search->path[depth] = algorithm;
+    search->fresh[depth + 1] = search->fresh[depth] || !(search->covered_ops & (1u << algorithm->op));
+    search->halts[depth + 1] = search->halts[depth] || (field && cursor >= search->field_count);
+    bool reads_field = field && !search->halts[depth + 1];
+    search->cursors[depth + 1] = cursor + reads_field;
+    return reads_field;
+}
+
+// The step functions read the slot at the state's cursor. An op that reads a field is
+// handed that field's row as the only slot, so nothing is copied per choice.
+static inline const uint64_t* step_operands(const chain_search_t* search, int depth, chain_state_t* from,
+                                            int* slots) {
+    const uint64_t* rows = search->bitsliced ? search->field_planes : search->field_values;
+    *from = search->states[depth];
+    *slots = search->field_count;
+    if (search->cursors[depth + 1] > search->cursors[depth]) {
+        rows += (size_t)search->slot_positions[search->cursors[depth]] * search->row_stride;
+        from->field_cursor = 0;
+        *slots = 1;
+    }
+    return rows;
+}
+
+// First constant op of the chain once algorithm runs at depth, or -1 if none has run
+static inline int first_constant_depth(const chain_search_t* search, const algorithm_registry_entry_t* algorithm,
+                                       int depth, int constant_depth) {
+    if (constant_depth < 0 && !search->halts[depth] &&
+        search->operand_kinds[algorithm->op] == OPERAND_CONSTANT) {
+        return depth;
+    }
+    return constant_depth;
+}
+
+// Last op of the chain. Each leaf decides max_constants candidates per ordering of the
+// fields the chain leaves unread.
+static bool test_leaf_operations(chain_search_t* search, operation_t* operation_sequence,
+                                 int depth, int constant_depth, uint64_t* tests_performed) {
+    uint64_t constants = (uint64_t)search->constant_count;
+    bool early_exit = search->config->early_exit;
+    uint64_t solutions_before = search->solutions_found;
+    int cursor = search->cursors[depth];
+
+    for (int alg_idx = 0; alg_idx < search->algorithm_count; alg_idx++) {
+        const algorithm_registry_entry_t* algorithm = &search->algorithms[alg_idx];
+        bool reads_field = place_operation(search, operation_sequence, algorithm, depth);
+        if (!search->fresh[depth + 1]) continue;
+        int next_constant_depth = first_constant_depth(search, algorithm, depth, constant_depth);
+        uint64_t leaf_candidates = search->leaf_candidates[search->field_count - search->cursors[depth + 1]];
+
+        for (int position = 0; position < (reads_field ? search->field_count : 1); position++) {
+            if (reads_field) {
+                if (search->fields_read & (1u << position)) continue;
+                search->slot_positions[cursor] = (uint8_t)position;
             }
-            solution.operation_count = max_depth;
-            solution.constant = constant;
-            solution.checksum_size = config->checksum_size;
-            solution.validated = true;
-            
-            if (add_solution(results, &solution)) {
-                // Solution found - don't print here, let main thread handle it after stopping all threads
+            *tests_performed += leaf_candidates;
+            if (!search->checksum_sizes_match) continue;
+            if (reads_field) search->fields_read |= 1u << position;
+
+            chain_state_t from;
+            int slots;
+            const uint64_t* rows = step_operands(search, depth, &from, &slots);
+            if (next_constant_depth >= 0) {
+                solve_chain_constants(search, operation_sequence, next_constant_depth, depth + 1);
+            } else if (search->bitsliced
+                       ? bitsliced_chain_step_matches(&from, algorithm->op, rows, slots,
+                                                      search->packet_count, 0, search->expected_planes)
+                       : chain_step_matches(&from, algorithm, rows, slots, search->packet_count,
+                                            0, search->expected, search->config->checksum_size)) {
+                for (uint64_t c = 0; c < constants; c++) {
+                    record_chain_solution(search, operation_sequence, depth + 1, &c, 1);
+                    if (early_exit) break;
+                }
             }
-            return true;
+
+            if (reads_field) search->fields_read &= ~(1u << position);
+            if (early_exit && search->solutions_found > solutions_before) return true;
         }
+    }
+    return search->solutions_found > solutions_before;
+}
+
+static bool test_operation_sequences(chain_search_t* search, operation_t* operation_sequence,
+                                     operation_t starting_operation, int current_depth, int max_depth,
+                                     int constant_depth, uint64_t* tests_performed);
+
+// Advance past algorithm at current_depth, set up by place_operation with the field it
+// reads (if any), and test everything below it. Returns whether solutions were found.
+static bool test_operation(chain_search_t* search,
+                           operation_t* operation_sequence,
+                           operation_t starting_operation,
+                           const algorithm_registry_entry_t* algorithm,
+                           int current_depth,
+                           int max_depth,
+                           int constant_depth,
+                           uint64_t* tests_performed) {
+    int unread = search->field_count - search->cursors[current_depth + 1];
+    uint64_t solutions_before = search->solutions_found;
+    int next_constant_depth = first_constant_depth(search, algorithm, current_depth, constant_depth);
+
+    // A unary op extends the run of unary ops before it. Runs from one state that
+    // compose to the same mapping and end at the same depth with the same fields read
+    // have identical subtrees, so only the first is explored. Leaves are left alone: their
+    // check usually stops at the first packet, which costs less than the lookup.
+    size_t run_slot = SIZE_MAX;
+    unary_run_set_t* run_set = NULL;
+    if (search->unary_runs &&
+        visit_unary_run(search, algorithm, current_depth, next_constant_depth,
+                        &run_set, &run_slot) == PREFIX_STATE_SEEN) {
+        *tests_performed += subtree_candidates(search, subtree_leaves_below(search, current_depth,
+                                                                            max_depth - current_depth - 1), unread);
+        search->runs_collapsed++;
         return false;
     }
-    
-    // Recursive case: fill the next position
-    for (int alg_idx = 0; alg_idx < algorithm_count; alg_idx++) {
-        // At depth 0, only allow the starting operation
-        if (current_depth == 0 && algorithms[alg_idx].op != starting_operation) {
-            continue;
+
+    // Past the first constant op the running values depend on the constant, so they
+    // are left to the leaf solver and the prefix-state cache is not consulted
+    size_t slot = 0;
+    prefix_state_status_t status = PREFIX_STATE_NEW;
+    chain_state_t* next_state = &search->states[current_depth + 1];
+    if (next_constant_depth < 0) {
+        chain_state_t from;
+        int slots;
+        const uint64_t* rows = step_operands(search, current_depth, &from, &slots);
+        if (search->bitsliced) {
+            bitsliced_advance_chain_state(&from, next_state, algorithm->op, rows, slots, search->packet_count, 0);
+            if (search->unsliced_depth > current_depth) search->unsliced_depth = -1;
+        } else {
+            advance_chain_state(&from, next_state, algorithm, rows, slots, search->packet_count, 0);
         }
-        
-        operation_sequence[current_depth] = algorithms[alg_idx].op;
-        
-        
-        if (test_constrained_operation_sequence(dataset, config, field_permutation, field_count,
-                                              algorithms, algorithm_count, operation_sequence,
-                                              starting_operation, current_depth + 1, max_depth, 
-                                              constant, results, tests_performed)) {
-            if (config->early_exit) {
-                return true;
+        next_state->field_cursor = search->cursors[current_depth + 1];
+        if (search->state_cache) {
+            status = prefix_state_cache_visit(search->state_cache, next_state, current_depth + 1,
+                                              prefix_field_set(search, current_depth + 1), &slot);
+            if (status == PREFIX_STATE_SEEN) {
+                *tests_performed += subtree_candidates(search, subtree_leaves_below(search, current_depth,
+                                                                                    max_depth - current_depth - 1),
+                                                       unread);
+                search->prefixes_pruned++;
+                return false;
+            }
+        }
+        // Two packets with different expected checksums that share the running value and
+        // every unread field end on the same checksum for any suffix, so nothing below
+        // matches. Leaf parents are left alone: their leaves already stop at the first
+        // mismatching packet.
+        if (search->conflicts && max_depth - current_depth >= 3) {
+            uint32_t unread_set = search->halts[current_depth + 1]
+                                  ? 0 : ~search->fields_read & ((1u << search->field_count) - 1);
+            const chain_state_t* state = per_packet_state(search, current_depth + 1);
+            if (chain_state_conflicts(search->conflicts, state->values, search->conflict_value_mask, unread_set)) {
+                *tests_performed += subtree_candidates(search, subtree_leaves_below(search, current_depth,
+                                                                                    max_depth - current_depth - 1),
+                                                       unread);
+                search->conflicts_pruned[current_depth + 1]++;
+                return false;
             }
         }
     }
-    
-    return false;
+
+    test_operation_sequences(search, operation_sequence, starting_operation,
+                             current_depth + 1, max_depth, next_constant_depth, tests_performed);
+    bool found = search->solutions_found > solutions_before;
+    if (next_constant_depth < 0 && search->state_cache && status == PREFIX_STATE_NEW && found) {
+        prefix_state_cache_mark_solutions(search->state_cache, slot, next_state, current_depth + 1,
+                                          prefix_field_set(search, current_depth + 1));
+    }
+    if (run_set && found) {
+        unary_run_set_mark_solutions(run_set, run_slot);
+    }
+    return found;
 }
 
-// Helper function to recursively test all sequences starting with a specific operation
-bool test_starting_operation_sequences(const packet_dataset_t* dataset, 
-                                     const config_t* config,
-                                     const uint8_t* field_permutation,
-                                     int field_count,
-                                     const algorithm_registry_entry_t* algorithms,
-                                     int algorithm_count,
+// Walks the operation tree of one field mask, choosing the field each op reads as it
+// goes. Chains that never read the constant match for every constant or for none; the
+// others hand the state before their first constant op to a leaf solver that decides
+// every candidate constant together. constant_depth is that op's position, or -1 while
+// none has run.
+static bool test_operation_sequences(chain_search_t* search,
                                      operation_t* operation_sequence,
                                      operation_t starting_operation,
+                                     int current_depth,
                                      int max_depth,
-                                     uint8_t constant,
-                                     search_results_t* results,
+                                     int constant_depth,
                                      uint64_t* tests_performed) {
-    
-    return test_constrained_operation_sequence(dataset, config, field_permutation, field_count,
-                                             algorithms, algorithm_count, operation_sequence,
-                                             starting_operation, 0, max_depth, constant, 
-                                             results, tests_performed);
+    if (current_depth == max_depth - 1) {
+        return test_leaf_operations(search, operation_sequence, current_depth, constant_depth, tests_performed);
+    }
+    const algorithm_registry_entry_t* algorithms = search->algorithms;
+    bool early_exit = search->config->early_exit;
+    int cursor = search->cursors[current_depth];
+    bool found = false;
+    if (search->run_sets) unary_run_set_reset(&search->run_sets[current_depth]);
+
+    for (int alg_idx = 0; alg_idx < search->algorithm_count; alg_idx++) {
+        if (current_depth == 0 && algorithms[alg_idx].op != starting_operation) {
+            continue;
+        }
+        if (!place_operation(search, operation_sequence, &algorithms[alg_idx], current_depth)) {
+            found |= test_operation(search, operation_sequence, starting_operation, &algorithms[alg_idx],
+                                    current_depth, max_depth, constant_depth, tests_performed);
+            if (found && early_exit) return true;
+            continue;
+        }
+
+        // The op reads the next permutation slot: try each field not yet read
+        for (int position = 0; position < search->field_count; position++) {
+            if (search->fields_read & (1u << position)) continue;
+            search->slot_positions[cursor] = (uint8_t)position;
+            search->fields_read |= 1u << position;
+            found |= test_operation(search, operation_sequence, starting_operation, &algorithms[alg_idx],
+                                    current_depth, max_depth, constant_depth, tests_performed);
+            search->fields_read &= ~(1u << position);
+            if (found && early_exit) return true;
+        }
+    }
+    return found && early_exit;
+}
+
+// Field counts up to fields were searched to the end unless the search has been interrupted
+static void note_completed_fields(weighted_thread_context_t* ctx, int fields) {
+    pthread_mutex_lock(ctx->progress_mutex);
+    if (!*ctx->search_interrupted) ctx->completed_fields = fields;
+    pthread_mutex_unlock(ctx->progress_mutex);
 }
 
 // Weighted worker thread - explores only assigned operations via recursive search  
@@ -266,6 +761,7 @@ void* weighted_worker_thread(void* arg) {
     
     // If no operations assigned, exit immediately
     if (ctx->num_assigned_operations == 0) {
+        ctx->completed_fields = ctx->config->max_fields;
         return NULL;
     }
     
@@ -277,10 +773,110 @@ void* weighted_worker_thread(void* arg) {
         }
     }
     
+    // Incremental search buffers: per-mask field values, masked expectations and one
+    // running-value vector per chain depth
+    size_t packet_count = ctx->dataset->count;
+    uint64_t* field_values = malloc((size_t)CADS_MAX_FIELDS * packet_count * sizeof(uint64_t));
+    uint64_t* expected = malloc(packet_count * sizeof(uint64_t));
+    uint64_t* state_values = malloc((size_t)CADS_MAX_CHAIN_DEPTH * packet_count * sizeof(uint64_t));
+    // The bit-sliced kernel keeps the states, fields and expectations as planes instead;
+    // state_values then holds the leaf solvers' per-packet copy
+    size_t plane_words = bitsliced_word_count(packet_count);
+    uint64_t* planes = ctx->bitsliced
+                       ? malloc((size_t)(CADS_MAX_CHAIN_DEPTH + CADS_MAX_FIELDS + 1) * plane_words * sizeof(uint64_t))
+                       : NULL;
+    if (!field_values || !expected || !state_values || (ctx->bitsliced && !planes)) {
+        free(field_values);
+        free(expected);
+        free(state_values);
+        free(planes);
+        pthread_mutex_lock(&ctx->thread_progress->mutex);
+        ctx->thread_progress->completed = true;
+        pthread_mutex_unlock(&ctx->thread_progress->mutex);
+        return NULL;
+    }
+    
+    chain_search_t search = {
+        .config = ctx->config,
+        .algorithms = ctx->algorithms,
+        .algorithm_count = ctx->algorithm_count,
+        .packet_count = packet_count,
+        .field_values = field_values,
+        .expected = expected,
+        .checksum_sizes_match = true,
+        .results = ctx->results,
+        .results_mutex = ctx->results_mutex,
+        .bitsliced = ctx->bitsliced,
+        .unsliced_depth = -1
+    };
+    for (size_t p = 0; p < packet_count; p++) {
+        const test_packet_t* packet = &ctx->dataset->packets[p];
+        expected[p] = mask_checksum_to_size(packet->expected_checksum, ctx->config->checksum_size);
+        if (packet->checksum_size != ctx->config->checksum_size) {
+            search.checksum_sizes_match = false;
+        }
+    }
+    uint64_t* field_planes = NULL;
+    if (ctx->bitsliced) {
+        uint64_t* expected_planes = &planes[(size_t)CADS_MAX_CHAIN_DEPTH * plane_words];
+        field_planes = expected_planes + plane_words;
+        bitslice_values(expected, packet_count, expected_planes);
+        search.field_planes = field_planes;
+        search.expected_planes = expected_planes;
+        search.unsliced.values = state_values;
+    }
+    for (int d = 0; d < CADS_MAX_CHAIN_DEPTH; d++) {
+        search.states[d].values = ctx->bitsliced ? &planes[(size_t)d * plane_words]
+                                                 : &state_values[(size_t)d * packet_count];
+    }
+    
+    // Leaves below a node k levels above the leaf (saturating), credited when a subtree is pruned
+    uint64_t subtree_leaves[CADS_MAX_CHAIN_DEPTH + 1];
+    subtree_leaves[0] = 1;
+    for (int k = 1; k <= CADS_MAX_CHAIN_DEPTH; k++) {
+        uint64_t prev = subtree_leaves[k - 1];
+        subtree_leaves[k] = (prev > UINT64_MAX / (uint64_t)ctx->algorithm_count)
+                            ? UINT64_MAX : prev * (uint64_t)ctx->algorithm_count;
+    }
+    search.subtree_leaves = subtree_leaves;
+    search.constant_count = ctx->config->max_constants < CONSTANT_SET_SIZE
+                            ? ctx->config->max_constants : CONSTANT_SET_SIZE;
+    while ((1 << search.constant_bits) < search.constant_count) search.constant_bits++;
+    search.row_stride = ctx->bitsliced ? plane_words : packet_count;
+    for (int op = 0; op < NUM_OPS; op++) search.operand_kinds[op] = get_operation_operand_kind((operation_t)op);
+    search.leaf_candidates[0] = (uint64_t)search.constant_count;
+    for (int k = 1; k <= CADS_MAX_FIELDS; k++) {
+        search.leaf_candidates[k] = search.leaf_candidates[k - 1] * (uint64_t)k;
+    }
+    search.t_function = algorithms_are_t_functions(ctx->algorithms, ctx->algorithm_count);
+    search.chain_constants = ctx->config->chain_constants < 1 ? 1
+                             : ctx->config->chain_constants > CADS_MAX_CHAIN_CONSTANTS ? CADS_MAX_CHAIN_CONSTANTS
+                             : ctx->config->chain_constants;
+    if (ctx->unary_runs) {
+        int start_depths = ctx->config->max_fields < CADS_MAX_CHAIN_DEPTH ? ctx->config->max_fields + 1
+                                                                          : CADS_MAX_CHAIN_DEPTH;
+        search.run_sets = calloc((size_t)start_depths, sizeof(unary_run_set_t));
+        search.unary_runs = search.run_sets ? ctx->unary_runs : NULL;
+    }
+    search.state_cache = create_prefix_state_cache(ctx->state_cache_bytes,
+                                                   ctx->bitsliced ? plane_words : packet_count);
+    // T-function chains only ever see the low checksum_size bytes of the running value
+    search.conflicts = create_conflict_detector(packet_count, expected);
+    search.conflict_value_mask = search.t_function ? mask_checksum_to_size(UINT64_MAX, ctx->config->checksum_size)
+                                                   : UINT64_MAX;
+    const uint8_t* field_order = ctx->differential && ctx->differential->byte_count == min_packet_length
+                                 ? ctx->differential->field_order : NULL;
+    
     // Iterate through all complexity levels (same logic as single-threaded version)
     for (int complexity_level = 1; complexity_level <= ctx->config->max_fields; complexity_level++) {
+        note_completed_fields(ctx, complexity_level - 1);
+        // Chains made only of ops a finished lower level or a memo region searched are skipped
+        uint32_t covered = complexity_level <= MAX_SEARCHED_FIELDS ? ctx->covered_ops[complexity_level]
+                                                                   : ctx->config->covered_operations;
+        if (set_covered_operations(&search, covered) == ctx->algorithm_count) continue;
         
-        // Generate all field combinations using bit masks (same as single-threaded)
+        // Generate all field combinations using bit masks (same as single-threaded).
+        // Mask bits follow the differential field order so informative bytes come first.
         uint64_t max_mask = (1ULL << min_packet_length) - 1;
         for (uint64_t field_mask = 1; field_mask <= max_mask; field_mask++) {
             // Extract field indices from mask 
@@ -288,7 +884,7 @@ void* weighted_worker_thread(void* arg) {
             int field_count = 0;
             for (size_t i = 0; i < min_packet_length && field_count < CADS_MAX_FIELDS; i++) {
                 if (field_mask & (1ULL << i)) {
-                    fields[field_count++] = i;
+                    fields[field_count++] = field_order ? field_order[i] : i;
                 }
             }
             
@@ -297,114 +893,173 @@ void* weighted_worker_thread(void* arg) {
                 continue;
             }
             
-            // Generate all permutations of these fields
-            uint8_t permutations[24][CADS_MAX_FIELDS];
-            uint32_t perm_count = 0;
-            generate_all_permutations(fields, field_count, permutations, &perm_count);
+            // Masks that leave out a byte proven to move the checksum, or whose fields agree on
+            // two packets with different checksums, cannot hold a solution. Masks that swap in
+            // a duplicate column are restored from the canonical mask's solutions afterwards.
+            // Either way their candidates count as tested, so progress still reaches the end.
+            uint64_t field_set = 0;
+            for (int i = 0; i < field_count; i++) {
+                field_set |= 1ULL << fields[i];
+            }
+            if (!column_fields_canonical(ctx->columns, field_set) ||
+                !fd_filter_allows(ctx->fd_filter, field_set) ||
+                !differential_fields_allowed(ctx->differential, fields, field_count, ctx->config->checksum_size)) {
+                if (field_count <= MAX_SEARCHED_FIELDS) {
+                    local_tests += mask_candidates(&search, ctx->assigned_operations, ctx->num_assigned_operations,
+                                                   field_count, field_count + 1);
+                }
+                continue;
+            }
+            for (int i = 1; i < field_count; i++) {
+                for (int j = i; j > 0 && fields[j - 1] > fields[j]; j--) {
+                    uint8_t t = fields[j];
+                    fields[j] = fields[j - 1];
+                    fields[j - 1] = t;
+                }
+            }
+            
+            // generate_all_permutations stops at four fields, so wider masks have never
+            // been searched; keep it that way so candidate counts do not change
+            if (field_count > MAX_SEARCHED_FIELDS) continue;
+            extract_permutation_field_values(ctx->dataset, fields, field_count, ctx->config->checksum_size,
+                                             field_values);
+            if (ctx->bitsliced) {
+                for (int f = 0; f < field_count; f++) {
+                    bitslice_values(&field_values[(size_t)f * packet_count], packet_count,
+                                    &field_planes[(size_t)f * plane_words]);
+                }
+            }
+            search.mask_fields = fields;
+            search.field_count = field_count;
+            prefix_state_cache_new_context(search.state_cache);
+            if (search.conflicts) conflict_detector_set_fields(search.conflicts, field_values, field_count);
             
-            // For each field permutation
-            for (uint32_t perm_idx = 0; perm_idx < perm_count; perm_idx++) {
-                // For each constant value
-                for (int constant = 0; constant < ctx->config->max_constants; constant++) {
-                    // Check if search should be interrupted
-                    pthread_mutex_lock(ctx->progress_mutex);
-                    bool interrupted = *(ctx->search_interrupted);
-                    pthread_mutex_unlock(ctx->progress_mutex);
+            // Each (first field, starting operation) pair roots an independent subtree
+            for (int first = 0; first < field_count; first++) {
+                search.slot_positions[0] = (uint8_t)first;
+                search.fields_read = 1u << first;
+                search.cursors[0] = 1;
+                search.halts[0] = false;
+                if (ctx->bitsliced) {
+                    init_chain_state(&search.states[0], &field_planes[(size_t)first * plane_words], plane_words);
+                    search.unsliced_depth = -1;
+                } else {
+                    init_chain_state(&search.states[0], &field_values[(size_t)first * packet_count], packet_count);
+                }
+                
+                // Check if search should be interrupted
+                pthread_mutex_lock(ctx->progress_mutex);
+                bool interrupted = *(ctx->search_interrupted);
+                pthread_mutex_unlock(ctx->progress_mutex);
+                
+                if (interrupted) {
+                    // Mark thread as completed when exiting due to interruption
+                    time_t interrupt_time = time(NULL);
+                    pthread_mutex_lock(&ctx->thread_progress->mutex);
+                    double total_elapsed = interrupt_time - ctx->thread_progress->start_time;
+                    if (total_elapsed > 0) {
+                        ctx->thread_progress->current_rate = (double)ctx->thread_progress->tests_performed / total_elapsed;
+                    }
+                    ctx->thread_progress->completed = true;
+                    ctx->thread_progress->last_update = interrupt_time;
+                    pthread_mutex_unlock(&ctx->thread_progress->mutex);
+                    break;
+                }
+                
+                // For each assigned operation (start the recursive branch with this operation)
+                for (int op_idx = 0; op_idx < ctx->num_assigned_operations; op_idx++) {
+                    operation_t start_operation = ctx->assigned_operations[op_idx];
+                    
+                    // Initialize operation sequence with the assigned starting operation
+                    operation_t operation_sequence[CADS_MAX_FIELDS];
+                    operation_sequence[0] = start_operation;
+                    
+                    // Use same max_operation_depth logic as single-threaded version
+                    int max_operation_depth = field_count + 1;  // Allow extra operations for unary ops
+                    
+                    // Test all possible completions of sequences starting with our operation
+                    operation_t test_sequence[CADS_MAX_CHAIN_DEPTH];
+                    test_sequence[0] = start_operation;
                     
-                    if (interrupted) {
-                        // Mark thread as completed when exiting due to interruption
-                        time_t interrupt_time = time(NULL);
+                    uint64_t solutions_before = search.solutions_found;
+                    bool found = test_operation_sequences(&search, test_sequence, start_operation, 0,
+                                                          max_operation_depth, -1, &local_tests);
+                    
+                    // Track solutions found by this thread
+                    if (search.solutions_found > solutions_before) {
                         pthread_mutex_lock(&ctx->thread_progress->mutex);
-                        double total_elapsed = interrupt_time - ctx->thread_progress->start_time;
+                        ctx->thread_progress->solutions_found += (int)(search.solutions_found - solutions_before);
+                        pthread_mutex_unlock(&ctx->thread_progress->mutex);
+                    }
+                    
+                    // Check for early exit
+                    if (found && ctx->config->early_exit) {
+                        pthread_mutex_lock(ctx->progress_mutex);
+                        *(ctx->search_interrupted) = true;
+                        pthread_mutex_unlock(ctx->progress_mutex);
+                        
+                        // Mark thread as completed when exiting due to solution found
+                        time_t solution_time = time(NULL);
+                        pthread_mutex_lock(&ctx->thread_progress->mutex);
+                        double total_elapsed = solution_time - ctx->thread_progress->start_time;
                         if (total_elapsed > 0) {
                             ctx->thread_progress->current_rate = (double)ctx->thread_progress->tests_performed / total_elapsed;
                         }
                         ctx->thread_progress->completed = true;
-                        ctx->thread_progress->last_update = interrupt_time;
+                        ctx->thread_progress->last_update = solution_time;
                         pthread_mutex_unlock(&ctx->thread_progress->mutex);
                         break;
                     }
                     
-                    // For each assigned operation (start the recursive branch with this operation)
-                    for (int op_idx = 0; op_idx < ctx->num_assigned_operations; op_idx++) {
-                        operation_t start_operation = ctx->assigned_operations[op_idx];
-                        
-                        // Initialize operation sequence with the assigned starting operation
-                        operation_t operation_sequence[CADS_MAX_FIELDS];
-                        operation_sequence[0] = start_operation;
+                    // Update progress periodically based on time (more efficient)
+                    time_t current_time = time(NULL);
+                    if (current_time - last_update >= (ctx->config->progress_interval / 1000)) {
+                        // Update global progress  
+                        pthread_mutex_lock(ctx->progress_mutex);
+                        *(ctx->total_tests) += local_tests;
+                        pthread_mutex_unlock(ctx->progress_mutex);
                         
-                        // Use same max_operation_depth logic as single-threaded version
-                        int max_operation_depth = field_count + 1;  // Allow extra operations for unary ops
-                        
-                        // Test all possible completions of sequences starting with our operation
-                        operation_t test_sequence[CADS_MAX_FIELDS];
-                        test_sequence[0] = start_operation;
-                        
-                        bool found = test_starting_operation_sequences(ctx->dataset, ctx->config,
-                                                                     permutations[perm_idx], field_count,
-                                                                     ctx->algorithms, ctx->algorithm_count,
-                                                                     test_sequence, start_operation, max_operation_depth,
-                                                                     constant, ctx->results, &local_tests);
-                        
-                        // Track solutions found by this thread
-                        if (found) {
-                            pthread_mutex_lock(&ctx->thread_progress->mutex);
-                            ctx->thread_progress->solutions_found++;
-                            pthread_mutex_unlock(&ctx->thread_progress->mutex);
-                        }
-                        
-                        // Check for early exit
-                        if (found && ctx->config->early_exit) {
-                            pthread_mutex_lock(ctx->progress_mutex);
-                            *(ctx->search_interrupted) = true;
-                            pthread_mutex_unlock(ctx->progress_mutex);
-                            
-                            // Mark thread as completed when exiting due to solution found
-                            time_t solution_time = time(NULL);
-                            pthread_mutex_lock(&ctx->thread_progress->mutex);
-                            double total_elapsed = solution_time - ctx->thread_progress->start_time;
-                            if (total_elapsed > 0) {
-                                ctx->thread_progress->current_rate = (double)ctx->thread_progress->tests_performed / total_elapsed;
-                            }
-                            ctx->thread_progress->completed = true;
-                            ctx->thread_progress->last_update = solution_time;
-                            pthread_mutex_unlock(&ctx->thread_progress->mutex);
-                            break;
+                        // Update per-thread progress with rate calculation
+                        pthread_mutex_lock(&ctx->thread_progress->mutex);
+                        ctx->thread_progress->tests_performed += local_tests;
+                        // Calculate overall rate since thread start (more accurate than incremental rate)
+                        double total_elapsed = current_time - ctx->thread_progress->start_time;
+                        if (total_elapsed > 0) {
+                            ctx->thread_progress->current_rate = (double)ctx->thread_progress->tests_performed / total_elapsed;
                         }
+                        ctx->thread_progress->last_update = current_time;
+                        pthread_mutex_unlock(&ctx->thread_progress->mutex);
                         
-                        // Update progress periodically based on time (more efficient)
-                        time_t current_time = time(NULL);
-                        if (current_time - last_update >= (ctx->config->progress_interval / 1000)) {
-                            // Update global progress  
-                            pthread_mutex_lock(ctx->progress_mutex);
-                            *(ctx->total_tests) += local_tests;
-                            pthread_mutex_unlock(ctx->progress_mutex);
-                            
-                            // Update per-thread progress with rate calculation
-                            pthread_mutex_lock(&ctx->thread_progress->mutex);
-                            ctx->thread_progress->tests_performed += local_tests;
-                            // Calculate overall rate since thread start (more accurate than incremental rate)
-                            double total_elapsed = current_time - ctx->thread_progress->start_time;
-                            if (total_elapsed > 0) {
-                                ctx->thread_progress->current_rate = (double)ctx->thread_progress->tests_performed / total_elapsed;
-                            }
-                            ctx->thread_progress->last_update = current_time;
-                            pthread_mutex_unlock(&ctx->thread_progress->mutex);
-                            
-                            local_tests = 0;
-                            last_update = current_time;
-                        }
+                        local_tests = 0;
+                        last_update = current_time;
                     }
                 }
             }
         }
     }
+    note_completed_fields(ctx, ctx->config->max_fields);
     
     // Add remaining local tests and mark thread as completed
     pthread_mutex_lock(ctx->progress_mutex);
     *(ctx->total_tests) += local_tests;
     pthread_mutex_unlock(ctx->progress_mutex);
     
+    pthread_mutex_lock(ctx->results_mutex);
+    ctx->results->prefixes_pruned += search.prefixes_pruned;
+    ctx->results->unary_runs_collapsed += search.runs_collapsed;
+    for (int d = 0; d < CADS_MAX_SOLUTION_OPS; d++) ctx->results->conflicts_pruned[d] += search.conflicts_pruned[d];
+    if (search.state_cache) {
+        ctx->results->equivalent_prefixes += search.state_cache->equivalent_hits;
+    }
+    pthread_mutex_unlock(ctx->results_mutex);
+    free_prefix_state_cache(search.state_cache);
+    free_conflict_detector(search.conflicts);
+    free(search.run_sets);
+    free(planes);
+    free(state_values);
+    free(expected);
+    free(field_values);
+    
     // Update per-thread progress and mark as completed
     time_t final_time = time(NULL);
     pthread_mutex_lock(&ctx->thread_progress->mutex);
@@ -421,6 +1076,67 @@ void* weighted_worker_thread(void* arg) {
     return NULL;
 }
 
+// Load the memo store from its default location; NULL when it has none
+static memo_store_t* open_default_memo_store(void) {
+    char path[PATH_MAX];
+    return default_memo_path(path, sizeof(path)) ? open_memo_store(path, MEMO_STORE_BUDGET_BYTES) : NULL;
+}
+
+// A remembered solution still holds once its chain also matches every packet appended
+// after its region was searched; earlier packets were checked by that search
+static bool solution_holds_from(const checksum_solution_t* solution, const packet_dataset_t* dataset,
+                                size_t first_packet, size_t checksum_size) {
+    chain_program_t program;
+    if (first_packet >= dataset->count) return true;
+    if (!compile_solution_program(&program, solution)) return false;
+    for (size_t p = first_packet; p < dataset->count; p++) {
+        const test_packet_t* packet = &dataset->packets[p];
+        if (packet->checksum_size != checksum_size || packet->packet_length < (size_t)program.field_limit) return false;
+        uint64_t expected = mask_checksum_to_size(packet->expected_checksum, checksum_size);
+        if (run_chain_program(&program, packet->packet_data, packet->packet_length) != expected) return false;
+    }
+    return true;
+}
+
+// Take the chains of field_count fields made only of ops a memo region searched from the
+// region: its solutions over those ops and constants that hold on any appended packets go
+// to results, in canonical columns (expand_equivalent_solutions restores the rest).
+// Returns the ops, 0 when no region applies, and the packets appended since in
+// new_packets. first_only stops at one solution (early exit).
+static uint32_t replay_memo_region(memo_store_t* memo, const uint64_t* keys, const config_t* config,
+                                   uint32_t operations, int field_count, int constant_count,
+                                   const column_analysis_t* columns, bool first_only, search_results_t* results,
+                                   size_t* new_packets) {
+    const packet_dataset_t* dataset = config->dataset;
+    const memo_region_t* region = find_memo_region(memo, keys, dataset->count, operations, field_count,
+                                                   constant_count);
+    if (!region) return 0;
+    uint32_t covered = region->operations & operations;
+    *new_packets = dataset->count - (size_t)region->packet_count;
+    for (size_t i = 0; i < region->solution_count; i++) {
+        const checksum_solution_t* solution = &region->solutions[i];
+        if (solution->field_count != field_count || solution->constant >= (uint64_t)constant_count) continue;
+        bool inside = true;
+        for (int o = 0; o < solution->operation_count && inside; o++) {
+            inside = (covered >> solution->operations[o]) & 1;
+        }
+        for (int c = 0; c < solution->extra_constant_count && inside; c++) {
+            inside = solution->extra_constants[c] < constant_count;
+        }
+        uint64_t field_set = 0;
+        for (int f = 0; f < solution->field_count; f++) field_set |= 1ULL << solution->field_indices[f];
+        if (!inside || !column_fields_canonical(columns, field_set)) continue;
+        if (!solution_holds_from(solution, dataset, (size_t)region->packet_count, config->checksum_size)) {
+            results->memo_solutions_dropped++;
+            continue;
+        }
+        add_solution(results, solution);
+        results->memo_solutions_replayed++;
+        if (first_only) break;
+    }
+    return covered;
+}
+
 // Weighted checksum search - handles both single and multi-threaded execution
 bool execute_weighted_checksum_search(const config_t* config, 
                                      search_results_t* results,
@@ -441,26 +1157,64 @@ bool execute_weighted_checksum_search(const config_t* config,
     // Build operations array first to know how many operations we have
     int algorithm_count;
     algorithm_registry_entry_t* algorithms = malloc(32 * sizeof(algorithm_registry_entry_t));
-    if (!algorithms) {
+    if (!algorithms || !select_search_algorithms(config, algorithms, &algorithm_count)) {
+        free(algorithms);
         cleanup_algorithm_registry();
         return false;
     }
+    prepare_operation_tables(config, algorithms, algorithm_count);
     
-    if (config->custom_operation_count > 0 && config->custom_operations) {
-        algorithm_count = config->custom_operation_count;
-        for (int i = 0; i < algorithm_count; i++) {
-            const algorithm_registry_entry_t* entry = get_algorithm_by_operation(config->custom_operations[i]);
-            if (entry) {
-                algorithms[i] = *entry;
-            } else {
-                free(algorithms);
-                cleanup_algorithm_registry();
-                return false;
-            }
+    // Per field count, ops whose chains an earlier search tested: a finished lower --escalate
+    // level (no solutions there), or a memo region whose solutions are replayed instead
+    uint32_t operations = 0;
+    for (int a = 0; a < algorithm_count; a++) operations |= 1u << algorithms[a].op;
+    int constant_count = config->max_constants < CONSTANT_SET_SIZE ? config->max_constants : CONSTANT_SET_SIZE;
+    int searched_fields = config->max_fields < MAX_SEARCHED_FIELDS ? config->max_fields : MAX_SEARCHED_FIELDS;
+    size_t solutions_at_entry = results->solution_count;
+    uint32_t covered_ops[MAX_SEARCHED_FIELDS + 1];
+    uint32_t memo_ops[MAX_SEARCHED_FIELDS + 1] = {0};  // Ops a memo region actually searched
+    column_analysis_t* columns = analyze_dataset_columns(config->dataset, config->checksum_size);
+    memo_store_t* memo = config->memo ? open_default_memo_store() : NULL;
+    uint64_t* memo_keys = memo ? malloc((config->dataset->count + 1) * sizeof(uint64_t)) : NULL;
+    if (memo_keys) memo_prefix_keys(config, memo_keys);
+    size_t new_packets = 0;  // Most packets appended since a replayed region was searched
+    for (int f = 1; f <= MAX_SEARCHED_FIELDS; f++) {
+        covered_ops[f] = config->covered_operations & operations;
+        if (!memo_keys || f > searched_fields) continue;
+        search_results_t* replayed = create_search_results(16);
+        if (!replayed) continue;
+        size_t appended = 0;
+        memo_ops[f] = replay_memo_region(memo, memo_keys, config, operations, f, constant_count, columns,
+                                         config->early_exit, replayed, &appended);
+        if (__builtin_popcount(memo_ops[f]) > __builtin_popcount(covered_ops[f])) {
+            covered_ops[f] = memo_ops[f];
+            if (appended > new_packets) new_packets = appended;
+            results->memo_solutions_replayed += replayed->memo_solutions_replayed;
+            results->memo_solutions_dropped += replayed->memo_solutions_dropped;
+            for (size_t i = 0; i < replayed->solution_count; i++) add_solution(results, &replayed->solutions[i]);
+        }
+        free_search_results(replayed);
+        // A replayed solution answers an early-exit search outright
+        if (config->early_exit && results->solution_count > solutions_at_entry) {
+            for (int g = 1; g <= MAX_SEARCHED_FIELDS; g++) covered_ops[g] = operations;
+            break;
         }
-    } else {
-        const algorithm_registry_entry_t* complexity_algorithms = get_algorithms_by_complexity(config->complexity, &algorithm_count);
-        memcpy(algorithms, complexity_algorithms, algorithm_count * sizeof(algorithm_registry_entry_t));
+    }
+    if (memo_keys && config->verbose) {
+        for (int f = 1; f <= searched_fields; f++) {
+            printf("💾 Memo: %d-field chains over %d of %d ops already searched\n", f,
+                   __builtin_popcount(memo_ops[f]), algorithm_count);
+        }
+        printf("💾 Memo: %zu solutions replayed\n", results->memo_solutions_replayed);
+    }
+    bool memo_covers_all = memo_keys != NULL;
+    for (int f = 1; f <= searched_fields; f++) memo_covers_all &= memo_ops[f] == operations;
+    if (new_packets > 0) {
+        // Appending packets only removes solutions: a fully remembered space has nothing new
+        printf("💾 Memo: %zu new packets, %zu of %zu remembered solutions still hold%s\n", new_packets,
+               results->memo_solutions_replayed,
+               results->memo_solutions_replayed + results->memo_solutions_dropped,
+               memo_covers_all ? "; no new solution can appear" : "");
     }
     
     // Normalize thread count: cap at operation count and use at least 1 thread  
@@ -510,6 +1264,9 @@ bool execute_weighted_checksum_search(const config_t* config,
                                                                            config->max_fields, config->max_constants, permutations);
     if (!partitions) {
         free(algorithms);
+        free_memo_store(memo);
+        free(memo_keys);
+        free_column_analysis(columns);
         cleanup_algorithm_registry();
         return false;
     }
@@ -522,12 +1279,16 @@ bool execute_weighted_checksum_search(const config_t* config,
     // Calculate operation sequences for ALL complexity levels (same as single-threaded)
     uint64_t operation_sequences = 0;
     for (int complexity = 1; complexity <= config->max_fields; complexity++) {
+        int covered_count = __builtin_popcount(complexity <= MAX_SEARCHED_FIELDS ? covered_ops[complexity]
+                                                                                 : config->covered_operations & operations);
         uint64_t ops_for_complexity = 1;
+        uint64_t covered_sequences = 1;  // Tested by an earlier --escalate level or memo region
         // Allow field_count+1 operations for complex patterns
         for (int i = 0; i < complexity + 1; i++) {
             ops_for_complexity *= algorithm_count;
+            covered_sequences *= covered_count;
         }
-        operation_sequences += ops_for_complexity;
+        operation_sequences += ops_for_complexity - covered_sequences;
     }
     
     uint64_t estimated_tests = permutations * operation_sequences * config->max_constants;
@@ -544,15 +1305,25 @@ bool execute_weighted_checksum_search(const config_t* config,
                 // Calculate precise search space for constrained recursive search
                 // Thread starts with N assigned operations, then branches to all operations
                 int thread_assigned_ops = partitions->partitions[i].num_assigned_operations;
+                uint32_t assigned = 0;
+                for (int a = 0; a < thread_assigned_ops; a++) {
+                    assigned |= 1u << partitions->partitions[i].assigned_operations[a];
+                }
                 
                 uint64_t thread_operation_sequences = 0;
                 for (int complexity = 1; complexity <= config->max_fields; complexity++) {
-                    // N starting operations × total_ops^(remaining positions)
+                    uint32_t covered = complexity <= MAX_SEARCHED_FIELDS ? covered_ops[complexity]
+                                                                         : config->covered_operations & operations;
+                    int covered_count = __builtin_popcount(covered);
+                    // N starting operations × total_ops^(remaining positions), less the chains
+                    // from covered starting operations made only of covered ops
                     uint64_t ops_for_complexity = thread_assigned_ops;
+                    uint64_t covered_sequences = __builtin_popcount(assigned & covered);
                     for (int j = 1; j < complexity + 1; j++) {
                         ops_for_complexity *= algorithm_count;
+                        covered_sequences *= covered_count;
                     }
-                    thread_operation_sequences += ops_for_complexity;
+                    thread_operation_sequences += ops_for_complexity - covered_sequences;
                 }
                 
                 thread_estimates[i] = permutations * thread_operation_sequences * config->max_constants;
@@ -575,6 +1346,9 @@ bool execute_weighted_checksum_search(const config_t* config,
     if (!threads) {
         free_partitioning_result(partitions);
         free(algorithms);
+        free_memo_store(memo);
+        free(memo_keys);
+        free_column_analysis(columns);
         cleanup_algorithm_registry();
         return false;
     }
@@ -584,6 +1358,9 @@ bool execute_weighted_checksum_search(const config_t* config,
         free(threads);
         free_partitioning_result(partitions);
         free(algorithms);
+        free_memo_store(memo);
+        free(memo_keys);
+        free_column_analysis(columns);
         cleanup_algorithm_registry();
         return false;
     }
@@ -601,6 +1378,9 @@ bool execute_weighted_checksum_search(const config_t* config,
         free(threads);
         free_partitioning_result(partitions);
         free(algorithms);
+        free_memo_store(memo);
+        free(memo_keys);
+        free_column_analysis(columns);
         cleanup_algorithm_registry();
         return false;
     }
@@ -640,6 +1420,31 @@ bool execute_weighted_checksum_search(const config_t* config,
         progress_thread_created = true;
     }
     
+    // Frame pairs that differ in one byte pin down bytes every solution must read
+    differential_analysis_t* differential = analyze_packet_differences(config->dataset, config->checksum_size);
+    if (differential && config->verbose) {
+        print_differential_analysis(differential);
+    }
+    fd_filter_t* fd_filter = build_fd_filter(config->dataset, config->checksum_size, config->max_fields);
+    if (fd_filter && config->verbose) {
+        printf("🧬 Functional-dependency filter: %zu of %zu field sets cannot determine the checksum\n",
+               fd_filter->rejected_count, fd_filter->evaluated);
+    }
+    if (config->verbose && algorithms_are_t_functions(algorithms, algorithm_count)) {
+        printf("⚡ T-function kernel: every op is low-bit-first, constants solved bit-serially\n");
+    }
+    if (columns && config->verbose && (columns->constant_columns > 0 || columns->duplicate_columns > 0)) {
+        print_column_analysis(columns);
+    }
+    bool bitsliced = select_bitsliced_kernel(config, algorithms, algorithm_count);
+    int longest_run = config->max_fields < CADS_MAX_CHAIN_DEPTH ? config->max_fields + 1 : CADS_MAX_CHAIN_DEPTH;
+    unary_run_table_t* unary_runs = build_unary_run_table(algorithms, algorithm_count, config->checksum_size,
+                                                          longest_run);
+    if (unary_runs && config->verbose) {
+        printf("🔗 Unary runs: %d ops compose to %d distinct mappings over runs of up to %d\n",
+               unary_runs->unary_count, unary_runs->mapping_count, longest_run);
+    }
+    
     // Launch worker threads
     for (int i = 0; i < actual_threads; i++) {
         contexts[i] = (weighted_thread_context_t) {
@@ -658,7 +1463,15 @@ bool execute_weighted_checksum_search(const config_t* config,
             .search_interrupted = &search_interrupted,
             .thread_progress = &thread_progress[i],
             .all_thread_progress = all_thread_progress,
-            .total_threads = actual_threads
+            .total_threads = actual_threads,
+            .state_cache_bytes = config->state_cache_mb > 0
+                                 ? ((size_t)config->state_cache_mb << 20) / (size_t)actual_threads : 0,
+            .differential = differential,
+            .fd_filter = fd_filter,
+            .columns = columns,
+            .bitsliced = bitsliced,
+            .unary_runs = unary_runs,
+            .covered_ops = covered_ops
         };
         
         if (pthread_create(&threads[i], NULL, weighted_worker_thread, &contexts[i]) != 0) {
@@ -667,10 +1480,16 @@ bool execute_weighted_checksum_search(const config_t* config,
                 pthread_join(threads[j], NULL);
             }
             
+            free_differential_analysis(differential);
+            free_fd_filter(fd_filter);
+            free_column_analysis(columns);
+            free_unary_run_table(unary_runs);
             free(contexts);
             free(threads);
             free_partitioning_result(partitions);
             free(algorithms);
+            free_memo_store(memo);
+            free(memo_keys);
             cleanup_algorithm_registry();
             return false;
         }
@@ -681,8 +1500,42 @@ bool execute_weighted_checksum_search(const config_t* config,
         pthread_join(threads[i], NULL);
     }
     
+    // Report every equivalent field index, not just the canonical ones the workers searched
+    expand_equivalent_solutions(columns, results);
+    
+    // An exhaustive search becomes a memo region. It keeps the expanded solutions: columns
+    // that are duplicates now may differ once packets are appended. A search stopped at its
+    // first solution keeps the field counts every thread finished before the stop, so the
+    // next run resumes after them; an early exit answered from the memo adds nothing.
+    int completed_fields = searched_fields;
+    for (int i = 0; i < actual_threads; i++) {
+        if (contexts[i].completed_fields < completed_fields) completed_fields = contexts[i].completed_fields;
+    }
+    if (memo_keys && completed_fields > 0 && !(config->early_exit && results->memo_solutions_replayed > 0)) {
+        size_t found = results->solution_count - solutions_at_entry;
+        checksum_solution_t* kept = malloc((found ? found : 1) * sizeof(checksum_solution_t));
+        size_t kept_count = 0;
+        for (size_t i = solutions_at_entry; kept && i < results->solution_count; i++) {
+            if (results->solutions[i].field_count <= completed_fields) kept[kept_count++] = results->solutions[i];
+        }
+        if (!kept ||
+            !record_memo_region(memo, memo_keys, config->dataset->count, operations, completed_fields,
+                                constant_count, kept, kept_count) ||
+            !save_memo_store(memo)) {
+            if (config->verbose) printf("⚠️  Memo store could not be updated\n");
+        } else if (completed_fields < searched_fields) {
+            printf("💾 Memo: stopped early; chains of up to %d fields are remembered, the next run resumes "
+                   "after them\n", completed_fields);
+        }
+        free(kept);
+    }
+    free_memo_store(memo);
+    free(memo_keys);
+    
     // Final progress update to show correct solution count and completion state
     update_progress(&tracker, total_tests, results->solution_count);
+    results->tests_performed = total_tests;
+    results->search_completed = !(config->early_exit && results->solution_count > 0);
     
     // Stop progress monitoring first
     if (progress_thread_created) {
@@ -703,6 +1556,29 @@ bool execute_weighted_checksum_search(const config_t* config,
         display_per_thread_progress(all_thread_progress, actual_threads, &tracker);
     }
     
+    if (config->verbose && config->state_cache_mb > 0) {
+        printf("🧠 Prefix-state dedup: %llu subtrees pruned, %llu equivalent prefixes re-explored (%d MB budget)\n",
+               (unsigned long long)results->prefixes_pruned,
+               (unsigned long long)results->equivalent_prefixes, config->state_cache_mb);
+    }
+    if (config->verbose && unary_runs) {
+        printf("🔗 Unary runs: %llu collapsed into an explored run with the same mapping\n",
+               (unsigned long long)results->unary_runs_collapsed);
+    }
+    if (config->verbose) {
+        uint64_t conflicts = 0;
+        for (int d = 0; d < CADS_MAX_SOLUTION_OPS; d++) conflicts += results->conflicts_pruned[d];
+        if (conflicts > 0) {
+            printf("🚧 Injectivity conflicts: %llu subtrees pruned (by prefix length:", (unsigned long long)conflicts);
+            for (int d = 0; d < CADS_MAX_SOLUTION_OPS; d++) {
+                if (results->conflicts_pruned[d] > 0) {
+                    printf(" %d=%llu", d, (unsigned long long)results->conflicts_pruned[d]);
+                }
+            }
+            printf(")\n");
+        }
+    }
+    
     // Print any solutions found (now that all threads have stopped)
     if (results->solution_count > 0) {
     // Deterministic ordering
@@ -722,6 +1598,10 @@ bool execute_weighted_checksum_search(const config_t* config,
         free(tracker.thread_estimates);
     }
     free_partitioning_result(partitions);
+    free_differential_analysis(differential);
+    free_fd_filter(fd_filter);
+    free_column_analysis(columns);
+    free_unary_run_table(unary_runs);
     pthread_mutex_destroy(&results_mutex);
     pthread_mutex_destroy(&progress_mutex);
     free(algorithms);
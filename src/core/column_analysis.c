@@ -0,0 +1,142 @@
+#include "column_analysis.h"
+#include "checksum_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+column_analysis_t* analyze_dataset_columns(const packet_dataset_t* dataset, size_t checksum_size) {
+    if (!dataset || dataset->count == 0) return NULL;
+    size_t column_count = SIZE_MAX;
+    for (size_t p = 0; p < dataset->count; p++) {
+        if (dataset->packets[p].packet_length < column_count) column_count = dataset->packets[p].packet_length;
+    }
+    if (column_count == 0 || column_count > 64) return NULL;
+
+    size_t n = dataset->count;
+    column_analysis_t* analysis = calloc(1, sizeof(column_analysis_t));
+    uint64_t* columns = malloc(column_count * n * sizeof(uint64_t));
+    if (analysis) {
+        analysis->column_count = column_count;
+        analysis->representative = calloc(column_count, sizeof(uint8_t));
+        analysis->previous_members = calloc(column_count, sizeof(uint64_t));
+        analysis->constant = calloc(column_count, sizeof(bool));
+        analysis->values = calloc(column_count, sizeof(uint64_t));
+    }
+    if (!analysis || !columns || !analysis->representative || !analysis->previous_members ||
+        !analysis->constant || !analysis->values) {
+        free(columns);
+        free_column_analysis(analysis);
+        return NULL;
+    }
+
+    for (size_t c = 0; c < column_count; c++) {
+        uint64_t* column = &columns[c * n];
+        for (size_t p = 0; p < n; p++) {
+            const test_packet_t* packet = &dataset->packets[p];
+            column[p] = extract_packet_field_value(packet->packet_data, packet->packet_length,
+                                                   (uint8_t)c, checksum_size);
+        }
+
+        bool constant = true;
+        for (size_t p = 1; p < n && constant; p++) constant = column[p] == column[0];
+        analysis->constant[c] = constant;
+        analysis->values[c] = constant ? column[0] : 0;
+        if (constant) analysis->constant_columns++;
+
+        // Column counts are tiny, so classes are found by comparing against each representative
+        analysis->representative[c] = (uint8_t)c;
+        for (size_t r = 0; r < c; r++) {
+            if (analysis->representative[r] != r) continue;
+            if (memcmp(&columns[r * n], column, n * sizeof(uint64_t)) != 0) continue;
+            analysis->representative[c] = (uint8_t)r;
+            for (size_t m = r; m < c; m++) {
+                if (analysis->representative[m] == r) analysis->previous_members[c] |= 1ULL << m;
+            }
+            analysis->duplicate_columns++;
+            break;
+        }
+        if (analysis->representative[c] == c) analysis->class_count++;
+    }
+    free(columns);
+    return analysis;
+}
+
+void free_column_analysis(column_analysis_t* analysis) {
+    if (!analysis) return;
+    free(analysis->representative);
+    free(analysis->previous_members);
+    free(analysis->constant);
+    free(analysis->values);
+    free(analysis);
+}
+
+bool column_fields_canonical(const column_analysis_t* analysis, uint64_t field_set) {
+    if (!analysis || analysis->duplicate_columns == 0) return true;
+    for (uint64_t m = field_set; m; m &= m - 1) {
+        size_t c = (size_t)__builtin_ctzll(m);
+        if (c >= analysis->column_count) continue;
+        if (analysis->previous_members[c] & ~field_set) return false;
+    }
+    return true;
+}
+
+// Assign every position a distinct member of its field's class, keeping the variants
+// whose field set the search skipped
+static size_t expand_positions(const column_analysis_t* analysis, search_results_t* results,
+                               const checksum_solution_t* base, checksum_solution_t* variant,
+                               int position, uint64_t used) {
+    if (position == base->field_count) {
+        if (column_fields_canonical(analysis, used)) return 0;
+        return add_solution(results, variant) ? 1 : 0;
+    }
+    size_t added = 0;
+    uint8_t representative = analysis->representative[base->field_indices[position]];
+    for (size_t c = representative; c < analysis->column_count; c++) {
+        if (analysis->representative[c] != representative || (used & (1ULL << c))) continue;
+        variant->field_indices[position] = (uint8_t)c;
+        added += expand_positions(analysis, results, base, variant, position + 1, used | (1ULL << c));
+    }
+    variant->field_indices[position] = base->field_indices[position];
+    return added;
+}
+
+size_t expand_equivalent_solutions(const column_analysis_t* analysis, search_results_t* results) {
+    if (!analysis || analysis->duplicate_columns == 0 || !results) return 0;
+    size_t added = 0;
+    size_t original_count = results->solution_count;
+    for (size_t s = 0; s < original_count; s++) {
+        checksum_solution_t base = results->solutions[s];
+        uint64_t field_set = 0;
+        bool expandable = true;
+        for (int i = 0; i < base.field_count && expandable; i++) {
+            uint8_t f = base.field_indices[i];
+            expandable = f < analysis->column_count;
+            if (!expandable) break;
+            field_set |= 1ULL << f;
+            // Permutations of one class's members are all found by the search; expand the
+            // one that lists them in ascending order
+            for (int j = 0; j < i && expandable; j++) {
+                uint8_t g = base.field_indices[j];
+                expandable = analysis->representative[g] != analysis->representative[f] || g < f;
+            }
+        }
+        if (!expandable || !column_fields_canonical(analysis, field_set)) continue;
+        checksum_solution_t variant = base;
+        added += expand_positions(analysis, results, &base, &variant, 0, 0);
+    }
+    return added;
+}
+
+void print_column_analysis(const column_analysis_t* analysis) {
+    if (!analysis) return;
+    printf("🧱 Column analysis: %zu field columns in %zu classes (%zu constant, %zu duplicate)\n",
+           analysis->column_count, analysis->class_count, analysis->constant_columns, analysis->duplicate_columns);
+    for (size_t c = 0; c < analysis->column_count; c++) {
+        if (analysis->representative[c] != c) {
+            printf("   field %-3zu same as field %u%s\n", c, analysis->representative[c],
+                   analysis->constant[c] ? " (constant)" : "");
+        } else if (analysis->constant[c]) {
+            printf("   field %-3zu constant 0x%llX\n", c, (unsigned long long)analysis->values[c]);
+        }
+    }
+}
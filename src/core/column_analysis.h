@@ -0,0 +1,37 @@
+#ifndef COLUMN_ANALYSIS_H
+#define COLUMN_ANALYSIS_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Column equivalence classes over the dataset. Two field indices whose projected values
+// agree in every packet are interchangeable in any chain, so the search only enumerates
+// field sets that take the first members of each class and the reported solutions are
+// expanded back to every equivalent field index afterwards. Constant columns are the
+// classes whose value never changes.
+
+typedef struct {
+    size_t column_count;               // Field indices 0..column_count-1 are covered
+    uint8_t* representative;           // First column of each column's class
+    uint64_t* previous_members;        // Earlier members of the same class (bit i = column i)
+    bool* constant;                    // Same value in every packet
+    uint64_t* values;                  // Value of constant columns
+    size_t class_count;
+    size_t constant_columns;
+    size_t duplicate_columns;          // Columns that are not their class representative
+} column_analysis_t;
+
+// Returns NULL when the frames are too long for 64-bit masks or on allocation failure
+column_analysis_t* analyze_dataset_columns(const packet_dataset_t* dataset, size_t checksum_size);
+void free_column_analysis(column_analysis_t* analysis);
+
+// True when the field set uses a prefix of every class it touches. NULL analyses allow all.
+bool column_fields_canonical(const column_analysis_t* analysis, uint64_t field_set);
+
+// Append the solutions obtained by swapping fields for equivalent columns. Only solutions
+// found on canonical field sets are expanded; returns the number of solutions added.
+size_t expand_equivalent_solutions(const column_analysis_t* analysis, search_results_t* results);
+
+void print_column_analysis(const column_analysis_t* analysis);
+
+#endif // COLUMN_ANALYSIS_H
@@ -0,0 +1,66 @@
+// Complexity escalation (--escalate).
+//
+// The op set of each complexity level contains the one below it, so rerunning a failed
+// basic search at intermediate repeats every basic-only chain. The ladder searches the
+// levels in order and, once a level has finished without a solution, hands its op set to
+// the next level as covered_operations; the engine then skips every chain made only of
+// covered ops. The whole ladder tests as many candidates as the top level alone.
+
+#include "../../include/checksum_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+// Ops of a complexity level, bit i = operation i; 0 when the registry cannot be loaded
+static uint32_t level_operations(complexity_level_t level) {
+    if (!initialize_algorithm_registry()) return 0;
+    int count = 0;
+    const algorithm_registry_entry_t* algorithms = get_algorithms_by_complexity(level, &count);
+    uint32_t operations = 0;
+    for (int i = 0; i < count; i++) operations |= 1u << algorithms[i].op;
+    cleanup_algorithm_registry();
+    return operations;
+}
+
+bool execute_escalating_checksum_search(const config_t* config, search_results_t* results,
+                                        const hardware_benchmark_result_t* benchmark) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) {
+        return false;
+    }
+    if (config->custom_operation_count > 0) {
+        printf("⚠️  --escalate ignores an explicit operation list; searching it once\n");
+        config_t single = *config;
+        single.escalate = false;
+        return execute_weighted_checksum_search(&single, results, benchmark);
+    }
+
+    complexity_level_t top = config->complexity > COMPLEXITY_ADVANCED ? COMPLEXITY_ADVANCED : config->complexity;
+    uint32_t covered = 0;
+    results->search_completed = true;
+    for (int level = COMPLEXITY_BASIC; level <= (int)top; level++) {
+        uint32_t operations = level_operations((complexity_level_t)level);
+        if (operations == 0) return false;
+        if ((operations & ~covered) == 0) continue;
+        printf("🪜 Escalating to %s: %d new operations\n", get_complexity_name((complexity_level_t)level),
+               __builtin_popcount(operations & ~covered));
+
+        config_t level_config = *config;
+        level_config.complexity = (complexity_level_t)level;
+        level_config.escalate = false;
+        level_config.covered_operations = covered;
+        search_results_t* level_results = create_search_results(16);
+        if (!level_results) return false;
+        bool success = execute_weighted_checksum_search(&level_config, level_results, benchmark);
+
+        add_search_statistics(results, level_results);
+        for (size_t i = 0; i < level_results->solution_count; i++) {
+            add_solution(results, &level_results->solutions[i]);
+        }
+        bool finished = level_results->search_completed && level_results->solution_count == 0;
+        free_search_results(level_results);
+        if (!success) return false;
+        // Only a level searched to the end without a solution lets the next one skip its chains
+        if (!finished) break;
+        covered = operations;
+    }
+    return true;
+}
@@ -0,0 +1,161 @@
+// Slice-by-8 CRC kernels and the standard parameter catalogue.
+//
+// Normal (MSB-first) CRCs run with the register left-aligned in 32 bits and the
+// polynomial shifted to match, so widths 8, 16 and 32 share the CRC-32 slicing code.
+// Reflected CRCs keep the register in the low bits with the reflected polynomial. Table k
+// holds the effect of a byte followed by k zero bytes, which lets eight bytes be folded
+// in with eight independent lookups.
+
+#include "crc_catalogue.h"
+
+const crc_catalogue_entry_t crc_catalogue[] = {
+    {"CRC-8/AUTOSAR",           8, 0x2F,       0xFF,       false, false, 0xFF,       0xDF},
+    {"CRC-8/BLUETOOTH",         8, 0xA7,       0x00,       true,  true,  0x00,       0x26},
+    {"CRC-8/CDMA2000",          8, 0x9B,       0xFF,       false, false, 0x00,       0xDA},
+    {"CRC-8/DARC",              8, 0x39,       0x00,       true,  true,  0x00,       0x15},
+    {"CRC-8/DVB-S2",            8, 0xD5,       0x00,       false, false, 0x00,       0xBC},
+    {"CRC-8/GSM-A",             8, 0x1D,       0x00,       false, false, 0x00,       0x37},
+    {"CRC-8/GSM-B",             8, 0x49,       0x00,       false, false, 0xFF,       0x94},
+    {"CRC-8/HITAG",             8, 0x1D,       0xFF,       false, false, 0x00,       0xB4},
+    {"CRC-8/I-432-1",           8, 0x07,       0x00,       false, false, 0x55,       0xA1},
+    {"CRC-8/I-CODE",            8, 0x1D,       0xFD,       false, false, 0x00,       0x7E},
+    {"CRC-8/LTE",               8, 0x9B,       0x00,       false, false, 0x00,       0xEA},
+    {"CRC-8/MAXIM-DOW",         8, 0x31,       0x00,       true,  true,  0x00,       0xA1},
+    {"CRC-8/MIFARE-MAD",        8, 0x1D,       0xC7,       false, false, 0x00,       0x99},
+    {"CRC-8/NRSC-5",            8, 0x31,       0xFF,       false, false, 0x00,       0xF7},
+    {"CRC-8/OPENSAFETY",        8, 0x2F,       0x00,       false, false, 0x00,       0x3E},
+    {"CRC-8/ROHC",              8, 0x07,       0xFF,       true,  true,  0x00,       0xD0},
+    {"CRC-8/SAE-J1850",         8, 0x1D,       0xFF,       false, false, 0xFF,       0x4B},
+    {"CRC-8/SMBUS",             8, 0x07,       0x00,       false, false, 0x00,       0xF4},
+    {"CRC-8/TECH-3250",         8, 0x1D,       0xFF,       true,  true,  0x00,       0x97},
+    {"CRC-8/WCDMA",             8, 0x9B,       0x00,       true,  true,  0x00,       0x25},
+    {"CRC-16/ARC",              16, 0x8005,     0x0000,     true,  true,  0x0000,     0xBB3D},
+    {"CRC-16/CDMA2000",         16, 0xC867,     0xFFFF,     false, false, 0x0000,     0x4C06},
+    {"CRC-16/CMS",              16, 0x8005,     0xFFFF,     false, false, 0x0000,     0xAEE7},
+    {"CRC-16/DDS-110",          16, 0x8005,     0x800D,     false, false, 0x0000,     0x9ECF},
+    {"CRC-16/DECT-R",           16, 0x0589,     0x0000,     false, false, 0x0001,     0x007E},
+    {"CRC-16/DECT-X",           16, 0x0589,     0x0000,     false, false, 0x0000,     0x007F},
+    {"CRC-16/DNP",              16, 0x3D65,     0x0000,     true,  true,  0xFFFF,     0xEA82},
+    {"CRC-16/EN-13757",         16, 0x3D65,     0x0000,     false, false, 0xFFFF,     0xC2B7},
+    {"CRC-16/GENIBUS",          16, 0x1021,     0xFFFF,     false, false, 0xFFFF,     0xD64E},
+    {"CRC-16/GSM",              16, 0x1021,     0x0000,     false, false, 0xFFFF,     0xCE3C},
+    {"CRC-16/IBM-3740",         16, 0x1021,     0xFFFF,     false, false, 0x0000,     0x29B1},
+    {"CRC-16/IBM-SDLC",         16, 0x1021,     0xFFFF,     true,  true,  0xFFFF,     0x906E},
+    {"CRC-16/ISO-IEC-14443-3-A", 16, 0x1021,    0xC6C6,     true,  true,  0x0000,     0xBF05},
+    {"CRC-16/KERMIT",           16, 0x1021,     0x0000,     true,  true,  0x0000,     0x2189},
+    {"CRC-16/LJ1200",           16, 0x6F63,     0x0000,     false, false, 0x0000,     0xBDF4},
+    {"CRC-16/M17",              16, 0x5935,     0xFFFF,     false, false, 0x0000,     0x772B},
+    {"CRC-16/MAXIM-DOW",        16, 0x8005,     0x0000,     true,  true,  0xFFFF,     0x44C2},
+    {"CRC-16/MCRF4XX",          16, 0x1021,     0xFFFF,     true,  true,  0x0000,     0x6F91},
+    {"CRC-16/MODBUS",           16, 0x8005,     0xFFFF,     true,  true,  0x0000,     0x4B37},
+    {"CRC-16/NRSC-5",           16, 0x080B,     0xFFFF,     true,  true,  0x0000,     0xA066},
+    {"CRC-16/OPENSAFETY-A",     16, 0x5935,     0x0000,     false, false, 0x0000,     0x5D38},
+    {"CRC-16/OPENSAFETY-B",     16, 0x755B,     0x0000,     false, false, 0x0000,     0x20FE},
+    {"CRC-16/PROFIBUS",         16, 0x1DCF,     0xFFFF,     false, false, 0xFFFF,     0xA819},
+    {"CRC-16/RIELLO",           16, 0x1021,     0xB2AA,     true,  true,  0x0000,     0x63D0},
+    {"CRC-16/SPI-FUJITSU",      16, 0x1021,     0x1D0F,     false, false, 0x0000,     0xE5CC},
+    {"CRC-16/T10-DIF",          16, 0x8BB7,     0x0000,     false, false, 0x0000,     0xD0DB},
+    {"CRC-16/TELEDISK",         16, 0xA097,     0x0000,     false, false, 0x0000,     0x0FB3},
+    {"CRC-16/TMS37157",         16, 0x1021,     0x89EC,     true,  true,  0x0000,     0x26B1},
+    {"CRC-16/UMTS",             16, 0x8005,     0x0000,     false, false, 0x0000,     0xFEE8},
+    {"CRC-16/USB",              16, 0x8005,     0xFFFF,     true,  true,  0xFFFF,     0xB4C8},
+    {"CRC-16/XMODEM",           16, 0x1021,     0x0000,     false, false, 0x0000,     0x31C3},
+    {"CRC-32/AIXM",             32, 0x814141AB, 0x00000000, false, false, 0x00000000, 0x3010BF7F},
+    {"CRC-32/AUTOSAR",          32, 0xF4ACFB13, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0x1697D06A},
+    {"CRC-32/BASE91-D",         32, 0xA833982B, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0x87315576},
+    {"CRC-32/BZIP2",            32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0xFFFFFFFF, 0xFC891918},
+    {"CRC-32/CD-ROM-EDC",       32, 0x8001801B, 0x00000000, true,  true,  0x00000000, 0x6EC2EDC4},
+    {"CRC-32/CKSUM",            32, 0x04C11DB7, 0x00000000, false, false, 0xFFFFFFFF, 0x765E7680},
+    {"CRC-32/ISCSI",            32, 0x1EDC6F41, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0xE3069283},
+    {"CRC-32/ISO-HDLC",         32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0xFFFFFFFF, 0xCBF43926},
+    {"CRC-32/JAMCRC",           32, 0x04C11DB7, 0xFFFFFFFF, true,  true,  0x00000000, 0x340BC6D9},
+    {"CRC-32/MEF",              32, 0x741B8CD7, 0xFFFFFFFF, true,  true,  0x00000000, 0xD2C22F51},
+    {"CRC-32/MPEG-2",           32, 0x04C11DB7, 0xFFFFFFFF, false, false, 0x00000000, 0x0376E6E7},
+    {"CRC-32/XFER",             32, 0x000000AF, 0x00000000, false, false, 0x00000000, 0xBD0BE338},
+};
+
+const size_t crc_catalogue_count = sizeof(crc_catalogue) / sizeof(crc_catalogue[0]);
+
+static uint64_t reflect_value(uint64_t value, int width) {
+    uint64_t result = 0;
+    for (int i = 0; i < width; i++) {
+        if ((value >> i) & 1) result |= 1ULL << (width - 1 - i);
+    }
+    return result;
+}
+
+void crc_table_init(crc_table_t* table, int width, uint64_t poly, bool reflected) {
+    table->width = width;
+    table->poly = poly;
+    table->reflected = reflected;
+    if (reflected) {
+        uint32_t rpoly = (uint32_t)reflect_value(poly, width);
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t r = i;
+            for (int b = 0; b < 8; b++) r = (r & 1) ? (r >> 1) ^ rpoly : r >> 1;
+            table->entries[0][i] = r;
+        }
+        for (int k = 1; k < 8; k++) {
+            for (int i = 0; i < 256; i++) {
+                uint32_t prev = table->entries[k - 1][i];
+                table->entries[k][i] = (prev >> 8) ^ table->entries[0][prev & 0xFF];
+            }
+        }
+    } else {
+        uint32_t apoly = (uint32_t)(poly << (32 - width));
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t r = i << 24;
+            for (int b = 0; b < 8; b++) r = (r & 0x80000000u) ? (r << 1) ^ apoly : r << 1;
+            table->entries[0][i] = r;
+        }
+        for (int k = 1; k < 8; k++) {
+            for (int i = 0; i < 256; i++) {
+                uint32_t prev = table->entries[k - 1][i];
+                table->entries[k][i] = (prev << 8) ^ table->entries[0][prev >> 24];
+            }
+        }
+    }
+}
+
+uint32_t crc_table_update(const crc_table_t* table, uint32_t reg, const uint8_t* data, size_t n) {
+    const uint32_t (*t)[256] = table->entries;
+    if (table->reflected) {
+        for (; n >= 8; n -= 8, data += 8) {
+            uint32_t a = reg ^ ((uint32_t)data[0] | (uint32_t)data[1] << 8 |
+                                (uint32_t)data[2] << 16 | (uint32_t)data[3] << 24);
+            reg = t[7][a & 0xFF] ^ t[6][(a >> 8) & 0xFF] ^ t[5][(a >> 16) & 0xFF] ^ t[4][a >> 24] ^
+                  t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+        }
+        for (; n > 0; n--, data++) reg = (reg >> 8) ^ t[0][(reg ^ *data) & 0xFF];
+        return reg;
+    }
+
+    int shift = 32 - table->width;
+    uint32_t aligned = reg << shift;
+    for (; n >= 8; n -= 8, data += 8) {
+        uint32_t a = aligned ^ ((uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 |
+                                (uint32_t)data[2] << 8 | (uint32_t)data[3]);
+        aligned = t[7][a >> 24] ^ t[6][(a >> 16) & 0xFF] ^ t[5][(a >> 8) & 0xFF] ^ t[4][a & 0xFF] ^
+                  t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]];
+    }
+    for (; n > 0; n--, data++) aligned = (aligned << 8) ^ t[0][(aligned >> 24) ^ *data];
+    return aligned >> shift;
+}
+
+uint32_t crc_table_initial_register(const crc_table_t* table, const crc_model_t* model) {
+    return (uint32_t)(table->reflected ? reflect_value(model->init, model->width) : model->init);
+}
+
+uint64_t crc_table_finish(const crc_table_t* table, const crc_model_t* model, uint32_t reg) {
+    uint64_t value = reg;
+    if (table->reflected != model->refout) value = reflect_value(value, model->width);
+    return value ^ model->xorout;
+}
+
+uint64_t crc_table_model_compute(const crc_table_t* table, const crc_model_t* model,
+                                 const uint8_t* data, size_t length) {
+    size_t skipped = model->data_start + model->data_end_trim;
+    size_t n = length > skipped ? length - skipped : 0;
+    uint32_t reg = crc_table_update(table, crc_table_initial_register(table, model), data + model->data_start, n);
+    return crc_table_finish(table, model, reg);
+}
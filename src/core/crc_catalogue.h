@@ -0,0 +1,52 @@
+#ifndef CRC_CATALOGUE_H
+#define CRC_CATALOGUE_H
+
+#include "../../include/cads_types.h"
+
+// Standard CRC parameter sets (reveng catalogue notation); check is the CRC of "123456789"
+typedef struct {
+    const char* name;
+    int width;
+    uint64_t poly;
+    uint64_t init;
+    bool refin;
+    bool refout;
+    uint64_t xorout;
+    uint64_t check;
+} crc_catalogue_entry_t;
+
+extern const crc_catalogue_entry_t crc_catalogue[];
+extern const size_t crc_catalogue_count;
+
+// Slice-by-8 lookup tables for one (width, poly, refin), widths 8..32. Reflected tables
+// keep the register reflected in the low bits; normal ones keep it unreflected. Built once
+// and only read afterwards, so one table is shared by every thread.
+typedef struct {
+    int width;
+    uint64_t poly;
+    bool reflected;
+    uint32_t entries[8][256];
+} crc_table_t;
+
+void crc_table_init(crc_table_t* table, int width, uint64_t poly, bool reflected);
+
+// Feed n bytes into a register kept in the table's domain
+uint32_t crc_table_update(const crc_table_t* table, uint32_t reg, const uint8_t* data, size_t n);
+
+// One byte, for scans that need the register after every byte
+static inline uint32_t crc_table_step(const crc_table_t* table, uint32_t reg, uint8_t byte) {
+    if (table->reflected) return (reg >> 8) ^ table->entries[0][(reg ^ byte) & 0xFF];
+    int shift = 32 - table->width;
+    uint32_t aligned = reg << shift;
+    return ((aligned << 8) ^ table->entries[0][(aligned >> 24) ^ byte]) >> shift;
+}
+
+// Convert between a model's init / output and the table's register domain
+uint32_t crc_table_initial_register(const crc_table_t* table, const crc_model_t* model);
+uint64_t crc_table_finish(const crc_table_t* table, const crc_model_t* model, uint32_t reg);
+
+// Table-driven equivalent of crc_model_compute; table must match the model's width, poly and refin
+uint64_t crc_table_model_compute(const crc_table_t* table, const crc_model_t* model,
+                                 const uint8_t* data, size_t length);
+
+#endif // CRC_CATALOGUE_H
@@ -0,0 +1,639 @@
+// Whole-frame CRC parameter recovery.
+//
+// For two frames of equal length, crc(A) ^ crc(B) = ((A ^ B)(x) * x^w) mod P: init and
+// xorout cancel. Every such pair is therefore a multiple of the generator P, and the GCD
+// over a handful of pairs is P itself or P times a small cofactor. Candidates of degree w
+// are split off that GCD, after which init follows from frames of different lengths
+// (crc(M) ^ crc0(M) = init * x^(8n) ^ xorout is linear in init) and xorout from any frame.
+// Reflection is handled by reflecting the input bytes and the observed checksum up front,
+// so the algebra only ever sees an unreflected CRC. Every candidate model is confirmed
+// against the full dataset with the reference implementation.
+
+#include "crc_recovery.h"
+#include "crc_catalogue.h"
+#include "../../include/checksum_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define CRC_MAX_SKIP 32                // Largest header / trailer excluded from a data range
+#define CRC_MAX_PAIRS 12               // Frame pairs folded into the GCD
+#define CRC_MAX_COFACTOR_DEGREE 12     // GCD excess over the width still split by enumeration
+#define CRC_MAX_LENGTH_GROUPS 8        // Distinct range lengths used to solve for init
+
+static const int crc_widths[] = {8, 16, 32};
+
+static uint64_t width_mask(int width) {
+    return width == 64 ? UINT64_MAX : ((1ULL << width) - 1);
+}
+
+static uint64_t reflect_bits(uint64_t value, int width) {
+    uint64_t result = 0;
+    for (int i = 0; i < width; i++) {
+        if ((value >> i) & 1) result |= 1ULL << (width - 1 - i);
+    }
+    return result;
+}
+
+static uint8_t reflect_byte(uint8_t value) {
+    return (uint8_t)reflect_bits(value, 8);
+}
+
+// Unreflected register update; data == NULL feeds zero bytes
+static uint64_t crc_update(uint64_t reg, uint64_t poly, int width, const uint8_t* data, size_t n, bool refin) {
+    uint64_t top = 1ULL << (width - 1);
+    uint64_t mask = width_mask(width);
+    for (size_t i = 0; i < n; i++) {
+        uint8_t byte = data ? (refin ? reflect_byte(data[i]) : data[i]) : 0;
+        reg ^= (uint64_t)byte << (width - 8);
+        for (int b = 0; b < 8; b++) {
+            reg = (reg & top) ? ((reg << 1) ^ poly) : (reg << 1);
+        }
+        reg &= mask;
+    }
+    return reg;
+}
+
+uint64_t crc_model_compute(const crc_model_t* model, const uint8_t* data, size_t length) {
+    size_t skipped = model->data_start + model->data_end_trim;
+    size_t n = length > skipped ? length - skipped : 0;
+    uint64_t reg = crc_update(model->init, model->poly, model->width, data + model->data_start, n, model->refin);
+    if (model->refout) reg = reflect_bits(reg, model->width);
+    return (reg ^ model->xorout) & width_mask(model->width);
+}
+
+bool crc_model_matches_dataset(const crc_model_t* model, const packet_dataset_t* dataset) {
+    for (size_t i = 0; i < dataset->count; i++) {
+        const test_packet_t* packet = &dataset->packets[i];
+        if (packet->packet_length <= model->data_start + model->data_end_trim) return false;
+        if (crc_model_compute(model, packet->packet_data, packet->packet_length) != packet->expected_checksum) return false;
+    }
+    return true;
+}
+
+void print_crc_model(const crc_model_t* model) {
+    int digits = model->width / 4;
+    printf("width=%d poly=0x%0*llx init=0x%0*llx refin=%s refout=%s xorout=0x%0*llx",
+           model->width, digits, (unsigned long long)model->poly, digits, (unsigned long long)model->init,
+           model->refin ? "true" : "false", model->refout ? "true" : "false",
+           digits, (unsigned long long)model->xorout);
+    printf(" data=[%zu, len-%zu)", model->data_start, model->data_end_trim);
+    if (model->name) printf(" %s", model->name);
+    printf("%s\n", model->init_ambiguous ? " (init/xorout not fixed by the frame lengths)" : "");
+}
+
+// --- GF(2)[x] arithmetic on little-endian word arrays (bit i = coefficient of x^i) ---
+
+static int poly_degree(const uint64_t* p, size_t words) {
+    for (size_t w = words; w-- > 0;) {
+        if (p[w]) return (int)(w * 64) + 63 - __builtin_clzll(p[w]);
+    }
+    return -1;
+}
+
+// a ^= b * x^shift, for b of degree b_degree
+static void poly_xor_shifted(uint64_t* a, size_t words, const uint64_t* b, int b_degree, int shift) {
+    size_t word_shift = (size_t)shift / 64;
+    int bit_shift = shift % 64;
+    size_t b_words = (size_t)b_degree / 64 + 1;
+    for (size_t i = 0; i < b_words && i + word_shift < words; i++) {
+        a[i + word_shift] ^= b[i] << bit_shift;
+        if (bit_shift && i + word_shift + 1 < words) a[i + word_shift + 1] ^= b[i] >> (64 - bit_shift);
+    }
+}
+
+static void poly_mod(uint64_t* a, const uint64_t* b, size_t words) {
+    int db = poly_degree(b, words);
+    int da;
+    while ((da = poly_degree(a, words)) >= db) {
+        poly_xor_shifted(a, words, b, db, da - db);
+    }
+}
+
+// a = gcd(a, b); b is clobbered
+static void poly_gcd(uint64_t* a, uint64_t* b, size_t words) {
+    while (poly_degree(b, words) >= 0) {
+        poly_mod(a, b, words);
+        for (size_t w = 0; w < words; w++) {
+            uint64_t t = a[w];
+            a[w] = b[w];
+            b[w] = t;
+        }
+    }
+}
+
+// --- Worker ---
+
+typedef struct {
+    size_t start;
+    size_t trim;
+} crc_range_t;
+
+typedef struct {
+    const config_t* config;
+    const crc_range_t* ranges;
+    size_t range_count;
+    size_t task_count;                 // widths x reflections x ranges
+    size_t* next_task;
+    pthread_mutex_t* work_mutex;
+    search_results_t* results;
+    pthread_mutex_t* results_mutex;
+    volatile bool* stop;
+    size_t words;                      // Poly buffer size for the longest frame
+    uint64_t* pair_poly;
+    uint64_t* gcd_poly;
+    const size_t* group_of;            // First packet of the same length, per packet
+    uint64_t candidates_verified;
+} crc_worker_t;
+
+// Observed checksum seen as an unreflected register
+static uint64_t observed_register(const test_packet_t* packet, int width, bool refout) {
+    uint64_t value = packet->expected_checksum & width_mask(width);
+    return refout ? reflect_bits(value, width) : value;
+}
+
+// init solving: crc(M) ^ crc0(M) = init * x^(8n) ^ xorout (register form), so two lengths give
+// init * (x^(8n0) + x^(8nk)) = K0 ^ Kk
+static bool solve_init(const uint64_t* length_k, const size_t* lengths, int groups, uint64_t poly, int width,
+                       uint64_t* init, bool* unique) {
+    uint64_t rows[(CRC_MAX_LENGTH_GROUPS - 1) * 32];
+    int row_count = 0;
+    for (int k = 1; k < groups; k++) {
+        uint64_t columns[32];
+        for (int i = 0; i < width; i++) {
+            uint64_t e = 1ULL << i;
+            columns[i] = crc_update(e, poly, width, NULL, lengths[0], false) ^ crc_update(e, poly, width, NULL, lengths[k], false);
+        }
+        uint64_t rhs = length_k[0] ^ length_k[k];
+        for (int o = 0; o < width; o++) {
+            uint64_t row = ((rhs >> o) & 1) << 63;
+            for (int i = 0; i < width; i++) row |= ((columns[i] >> o) & 1) << i;
+            rows[row_count++] = row;
+        }
+    }
+
+    int rank = 0;
+    int pivot_col[32];
+    for (int col = 0; col < width && rank < row_count; col++) {
+        int pivot = rank;
+        while (pivot < row_count && !((rows[pivot] >> col) & 1)) pivot++;
+        if (pivot == row_count) continue;
+        uint64_t t = rows[pivot];
+        rows[pivot] = rows[rank];
+        rows[rank] = t;
+        for (int r = 0; r < row_count; r++) {
+            if (r != rank && ((rows[r] >> col) & 1)) rows[r] ^= rows[rank];
+        }
+        pivot_col[rank++] = col;
+    }
+    for (int r = rank; r < row_count; r++) {
+        if (rows[r] >> 63) return false;
+    }
+    *init = 0;
+    for (int r = 0; r < rank; r++) {
+        if (rows[r] >> 63) *init |= 1ULL << pivot_col[r];
+    }
+    *unique = rank == width;
+    return true;
+}
+
+// A constant header is indistinguishable from a different init, so models that only differ
+// in data_start are merged into the widest one. Catalogue matches replace recovered models
+// of the same generator, which are the same CRC without the name.
+static void record_crc_model(search_results_t* results, const crc_model_t* model) {
+    for (size_t i = 0; i < results->crc_model_count; i++) {
+        crc_model_t* existing = &results->crc_models[i];
+        if (existing->width != model->width || existing->poly != model->poly || existing->refin != model->refin ||
+            existing->refout != model->refout || existing->data_end_trim != model->data_end_trim) {
+            continue;
+        }
+        if (existing->name && model->name && strcmp(existing->name, model->name) != 0) continue;
+        if (existing->name && !model->name) return;
+        if ((model->name && !existing->name) || model->data_start < existing->data_start) *existing = *model;
+        return;
+    }
+    add_crc_model(results, model);
+}
+
+static void record_model(crc_worker_t* w, const crc_model_t* model) {
+    pthread_mutex_lock(w->results_mutex);
+    record_crc_model(w->results, model);
+    if (w->config->early_exit) {
+        w->results->early_exit_triggered = true;
+        *w->stop = true;
+    }
+    pthread_mutex_unlock(w->results_mutex);
+}
+
+static void try_candidate(crc_worker_t* w, crc_model_t* model) {
+    const packet_dataset_t* dataset = w->config->dataset;
+    uint64_t length_k[CRC_MAX_LENGTH_GROUPS];
+    size_t lengths[CRC_MAX_LENGTH_GROUPS];
+    int groups = 0;
+
+    for (size_t p = 0; p < dataset->count && groups < CRC_MAX_LENGTH_GROUPS; p++) {
+        if (w->group_of[p] != p) continue;
+        const test_packet_t* packet = &dataset->packets[p];
+        size_t n = packet->packet_length - model->data_start - model->data_end_trim;
+        lengths[groups] = n;
+        length_k[groups++] = observed_register(packet, model->width, model->refout) ^
+                             crc_update(0, model->poly, model->width, packet->packet_data + model->data_start, n, model->refin);
+    }
+
+    uint64_t init = 0;
+    bool unique = false;
+    if (!solve_init(length_k, lengths, groups, model->poly, model->width, &init, &unique)) return;
+    model->init_ambiguous = !unique;
+    if (!unique) {
+        // Prefer the conventional 0 / all-ones pairs when the data cannot tell
+        uint64_t ones = width_mask(model->width);
+        uint64_t preferred[2] = {0, ones};
+        for (int i = 0; i < 2; i++) {
+            uint64_t xorout = length_k[0] ^ crc_update(preferred[i], model->poly, model->width, NULL, lengths[0], false);
+            bool consistent = true;
+            for (int k = 1; k < groups; k++) {
+                uint64_t other = length_k[k] ^ crc_update(preferred[i], model->poly, model->width, NULL, lengths[k], false);
+                if (other != xorout) consistent = false;
+            }
+            if (consistent && (xorout == 0 || xorout == ones)) {
+                init = preferred[i];
+                break;
+            }
+        }
+    }
+    model->init = init;
+    uint64_t xorout = length_k[0] ^ crc_update(init, model->poly, model->width, NULL, lengths[0], false);
+    model->xorout = model->refout ? reflect_bits(xorout, model->width) : xorout;
+
+    w->candidates_verified++;
+    if (crc_model_matches_dataset(model, dataset)) record_model(w, model);
+}
+
+static void run_task(crc_worker_t* w, size_t task) {
+    const packet_dataset_t* dataset = w->config->dataset;
+    int width = crc_widths[task / (4 * w->range_count)];
+    int reflection = (int)((task / w->range_count) % 4);
+    const crc_range_t* range = &w->ranges[task % w->range_count];
+    bool refin = reflection & 1;
+    bool refout = (reflection >> 1) & 1;
+
+    memset(w->gcd_poly, 0, w->words * sizeof(uint64_t));
+    int pairs = 0;
+    for (size_t p = 0; p < dataset->count && pairs < CRC_MAX_PAIRS; p++) {
+        size_t q = w->group_of[p];
+        if (q == p) continue;
+        const test_packet_t* a = &dataset->packets[p];
+        const test_packet_t* b = &dataset->packets[q];
+        size_t n = a->packet_length - range->start - range->trim;
+
+        // (A ^ B)(x) * x^w + (crc(A) ^ crc(B)); the first byte holds the top coefficients
+        memset(w->pair_poly, 0, w->words * sizeof(uint64_t));
+        w->pair_poly[0] = observed_register(a, width, refout) ^ observed_register(b, width, refout);
+        for (size_t i = 0; i < n; i++) {
+            uint8_t d = a->packet_data[range->start + i] ^ b->packet_data[range->start + i];
+            if (refin) d = reflect_byte(d);
+            if (!d) continue;
+            size_t bit = (n - 1 - i) * 8 + (size_t)width;
+            w->pair_poly[bit / 64] ^= (uint64_t)d << (bit % 64);
+            if (bit % 64 > 56) w->pair_poly[bit / 64 + 1] ^= (uint64_t)d >> (64 - bit % 64);
+        }
+        if (poly_degree(w->pair_poly, w->words) < 0) continue;
+        poly_gcd(w->gcd_poly, w->pair_poly, w->words);
+        pairs++;
+        if (poly_degree(w->gcd_poly, w->words) < width) return;  // No degree-w divisor left
+    }
+
+    int degree = poly_degree(w->gcd_poly, w->words);
+    if (degree < width || degree > width + CRC_MAX_COFACTOR_DEGREE) return;
+
+    // G = P * Q with deg Q = degree - width; enumerate monic Q and keep exact quotients.
+    // Widths up to 32 plus the cofactor bound keep G within one word.
+    uint64_t g = w->gcd_poly[0];
+    int cofactor_degree = degree - width;
+    for (uint64_t low = 0; low < (1ULL << cofactor_degree) && !*w->stop; low++) {
+        uint64_t q = (1ULL << cofactor_degree) | low;
+        uint64_t remainder = g;
+        uint64_t quotient = 0;
+        for (int d = degree; d >= cofactor_degree; d--) {
+            if ((remainder >> d) & 1) {
+                remainder ^= q << (d - cofactor_degree);
+                quotient |= 1ULL << (d - cofactor_degree);
+            }
+        }
+        if (remainder != 0 || !(quotient & 1)) continue;  // Real generators have an x^0 term
+
+        crc_model_t model = {
+            .width = width,
+            .poly = quotient & width_mask(width),
+            .refin = refin,
+            .refout = refout,
+            .data_start = range->start,
+            .data_end_trim = range->trim
+        };
+        try_candidate(w, &model);
+    }
+}
+
+static void* crc_worker_thread(void* arg) {
+    crc_worker_t* w = (crc_worker_t*)arg;
+    while (!*w->stop) {
+        pthread_mutex_lock(w->work_mutex);
+        size_t task = (*w->next_task)++;
+        pthread_mutex_unlock(w->work_mutex);
+        if (task >= w->task_count) break;
+        run_task(w, task);
+    }
+    return NULL;
+}
+
+// --- Catalogue sweep ---
+
+typedef struct {
+    const config_t* config;
+    const crc_catalogue_entry_t* const* entries;   // Entries that fit the checksum size
+    const crc_table_t* const* tables;              // Shared table of each entry
+    size_t min_length;
+    size_t task_count;                             // entries x start offsets
+    size_t* next_task;
+    pthread_mutex_t* work_mutex;
+    search_results_t* results;
+    pthread_mutex_t* results_mutex;
+    volatile bool* stop;
+    bool single_length;                            // Init and xorout cannot be told apart
+    uint64_t spans_checked;
+} crc_sweep_worker_t;
+
+// Every span starting at start: the first packet's register is advanced one byte at a time
+// and checked at each end; hits are confirmed on the other packets with the sliced kernel
+static void sweep_start(crc_sweep_worker_t* w, const crc_catalogue_entry_t* entry, const crc_table_t* table,
+                        size_t start) {
+    const packet_dataset_t* dataset = w->config->dataset;
+    const test_packet_t* first = &dataset->packets[0];
+    crc_model_t model = {
+        .width = entry->width,
+        .poly = entry->poly,
+        .init = entry->init,
+        .xorout = entry->xorout,
+        .refin = entry->refin,
+        .refout = entry->refout,
+        .data_start = start,
+        .init_ambiguous = w->single_length,
+        .name = entry->name
+    };
+    // The trim must leave the shortest frame a non-empty range
+    size_t min_end = start + 1 + (first->packet_length - w->min_length);
+    uint32_t reg = crc_table_initial_register(table, &model);
+    for (size_t end = start + 1; end <= first->packet_length && !*w->stop; end++) {
+        reg = crc_table_step(table, reg, first->packet_data[end - 1]);
+        if (end < min_end) continue;
+        w->spans_checked++;
+        if (crc_table_finish(table, &model, reg) != first->expected_checksum) continue;
+
+        model.data_end_trim = first->packet_length - end;
+        bool matches = true;
+        for (size_t p = 1; p < dataset->count && matches; p++) {
+            const test_packet_t* packet = &dataset->packets[p];
+            matches = crc_table_model_compute(table, &model, packet->packet_data, packet->packet_length) ==
+                      packet->expected_checksum;
+        }
+        if (!matches || !crc_model_matches_dataset(&model, dataset)) continue;
+
+        pthread_mutex_lock(w->results_mutex);
+        record_crc_model(w->results, &model);
+        if (w->config->early_exit) {
+            w->results->early_exit_triggered = true;
+            *w->stop = true;
+        }
+        pthread_mutex_unlock(w->results_mutex);
+    }
+}
+
+static void* crc_sweep_thread(void* arg) {
+    crc_sweep_worker_t* w = (crc_sweep_worker_t*)arg;
+    while (!*w->stop) {
+        pthread_mutex_lock(w->work_mutex);
+        size_t task = (*w->next_task)++;
+        pthread_mutex_unlock(w->work_mutex);
+        if (task >= w->task_count) break;
+        size_t entry = task / w->min_length;
+        sweep_start(w, w->entries[entry], w->tables[entry], task % w->min_length);
+    }
+    return NULL;
+}
+
+// Try every catalogue parameter set that fits the checksum on every span of the frames.
+// Tables are built once per (width, poly, refin) before the threads start.
+static bool sweep_crc_catalogue(const config_t* config, search_results_t* results, size_t min_length,
+                                int thread_count, volatile bool* stop, uint64_t* spans_checked) {
+    const packet_dataset_t* dataset = config->dataset;
+    const crc_catalogue_entry_t** entries = malloc(crc_catalogue_count * sizeof(*entries));
+    const crc_table_t** entry_tables = malloc(crc_catalogue_count * sizeof(*entry_tables));
+    crc_table_t* tables = malloc(crc_catalogue_count * sizeof(crc_table_t));
+    crc_sweep_worker_t* workers = calloc((size_t)thread_count, sizeof(crc_sweep_worker_t));
+    pthread_t* threads = malloc((size_t)thread_count * sizeof(pthread_t));
+    bool ok = entries && entry_tables && tables && workers && threads;
+
+    size_t entry_count = 0, table_count = 0;
+    for (size_t e = 0; ok && e < crc_catalogue_count; e++) {
+        const crc_catalogue_entry_t* entry = &crc_catalogue[e];
+        if (entry->width > (int)config->checksum_size * 8) continue;
+        size_t t = 0;
+        while (t < table_count && !(tables[t].width == entry->width && tables[t].poly == entry->poly &&
+                                    tables[t].reflected == entry->refin)) {
+            t++;
+        }
+        if (t == table_count) crc_table_init(&tables[table_count++], entry->width, entry->poly, entry->refin);
+        entries[entry_count] = entry;
+        entry_tables[entry_count++] = &tables[t];
+    }
+
+    bool single_length = true;
+    for (size_t p = 1; p < dataset->count; p++) {
+        single_length &= dataset->packets[p].packet_length == dataset->packets[0].packet_length;
+    }
+    if (ok && config->verbose) {
+        printf("📚 CRC catalogue: %zu parameter sets, %zu tables, every span of the frames\n",
+               entry_count, table_count);
+    }
+
+    pthread_mutex_t work_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t results_mutex = PTHREAD_MUTEX_INITIALIZER;
+    size_t next_task = 0;
+    for (int t = 0; ok && t < thread_count; t++) {
+        workers[t] = (crc_sweep_worker_t) {
+            .config = config,
+            .entries = entries,
+            .tables = entry_tables,
+            .min_length = min_length,
+            .task_count = entry_count * min_length,
+            .next_task = &next_task,
+            .work_mutex = &work_mutex,
+            .results = results,
+            .results_mutex = &results_mutex,
+            .stop = stop,
+            .single_length = single_length
+        };
+    }
+
+    int started = 0;
+    if (ok) {
+        for (; started < thread_count; started++) {
+            if (pthread_create(&threads[started], NULL, crc_sweep_thread, &workers[started]) != 0) {
+                *stop = true;
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+        *spans_checked += workers[t].spans_checked;
+    }
+
+    free(entries);
+    free(entry_tables);
+    free(tables);
+    free(workers);
+    free(threads);
+    pthread_mutex_destroy(&work_mutex);
+    pthread_mutex_destroy(&results_mutex);
+    return ok;
+}
+
+static int compare_crc_models(const void* a, const void* b) {
+    const crc_model_t* x = (const crc_model_t*)a;
+    const crc_model_t* y = (const crc_model_t*)b;
+    if (x->width != y->width) return x->width - y->width;
+    if (x->data_start != y->data_start) return x->data_start < y->data_start ? -1 : 1;
+    if (x->data_end_trim != y->data_end_trim) return x->data_end_trim < y->data_end_trim ? -1 : 1;
+    if (x->refin != y->refin) return x->refin ? 1 : -1;
+    if (x->refout != y->refout) return x->refout ? 1 : -1;
+    return x->poly < y->poly ? -1 : x->poly > y->poly;
+}
+
+bool execute_crc_recovery_search(const config_t* config, search_results_t* results) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) return false;
+    const packet_dataset_t* dataset = config->dataset;
+
+    size_t min_length = SIZE_MAX, max_length = 0;
+    for (size_t p = 0; p < dataset->count; p++) {
+        size_t length = dataset->packets[p].packet_length;
+        if (length < min_length) min_length = length;
+        if (length > max_length) max_length = length;
+    }
+
+    // Widths that fit the checksum field; a narrower CRC needs the upper bits clear
+    int width_count = 0;
+    while (width_count < 3 && crc_widths[width_count] <= (int)config->checksum_size * 8) width_count++;
+
+    // Frames of equal length have equal range lengths; pairs within a group cancel init and xorout
+    size_t* group_of = malloc(dataset->count * sizeof(size_t));
+    crc_range_t* ranges = malloc((CRC_MAX_SKIP + 1) * (CRC_MAX_SKIP + 1) * sizeof(crc_range_t));
+    if (!group_of || !ranges) {
+        free(group_of);
+        free(ranges);
+        return false;
+    }
+    for (size_t p = 0; p < dataset->count; p++) {
+        group_of[p] = p;
+        for (size_t q = 0; q < p; q++) {
+            if (group_of[q] == q && dataset->packets[q].packet_length == dataset->packets[p].packet_length) {
+                group_of[p] = q;
+                break;
+            }
+        }
+    }
+    size_t range_count = 0;
+    for (size_t start = 0; start <= CRC_MAX_SKIP; start++) {
+        for (size_t trim = 0; trim <= CRC_MAX_SKIP; trim++) {
+            if (start + trim < min_length) ranges[range_count++] = (crc_range_t) {start, trim};
+        }
+    }
+
+    size_t task_count = (size_t)width_count * 4 * range_count;
+    int thread_count = config->threads > 1 ? config->threads
+                     : config->threads == 0 ? (int)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    if ((size_t)thread_count > task_count) thread_count = task_count > 0 ? (int)task_count : 1;
+
+    if (config->verbose) {
+        printf("🔁 CRC recovery: widths up to %d bits, %zu data ranges, 4 reflection variants, threads: %d\n",
+               width_count > 0 ? crc_widths[width_count - 1] : 0, range_count, thread_count);
+    }
+
+    // Named parameter sets first; an early exit there leaves the recovery threads nothing to do
+    volatile bool stop = false;
+    uint64_t spans_checked = 0;
+    int sweep_threads = config->threads > 1 ? config->threads
+                      : config->threads == 0 ? (int)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    bool ok = sweep_crc_catalogue(config, results, min_length, sweep_threads, &stop, &spans_checked);
+    results->tests_performed += spans_checked;
+
+    crc_worker_t* workers = calloc((size_t)thread_count, sizeof(crc_worker_t));
+    pthread_t* threads = malloc((size_t)thread_count * sizeof(pthread_t));
+    pthread_mutex_t work_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t results_mutex = PTHREAD_MUTEX_INITIALIZER;
+    size_t next_task = 0;
+    ok = ok && workers && threads;
+    size_t words = (max_length * 8 + 64) / 64 + 1;
+
+    for (int t = 0; ok && t < thread_count; t++) {
+        crc_worker_t* w = &workers[t];
+        *w = (crc_worker_t) {
+            .config = config,
+            .ranges = ranges,
+            .range_count = range_count,
+            .task_count = task_count,
+            .next_task = &next_task,
+            .work_mutex = &work_mutex,
+            .results = results,
+            .results_mutex = &results_mutex,
+            .stop = &stop,
+            .words = words,
+            .group_of = group_of
+        };
+        w->pair_poly = malloc(words * sizeof(uint64_t));
+        w->gcd_poly = malloc(words * sizeof(uint64_t));
+        if (!w->pair_poly || !w->gcd_poly) ok = false;
+    }
+
+    int started = 0;
+    if (ok) {
+        for (; started < thread_count; started++) {
+            if (pthread_create(&threads[started], NULL, crc_worker_thread, &workers[started]) != 0) {
+                stop = true;
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    uint64_t verified = 0;
+    for (int t = 0; workers && t < thread_count; t++) {
+        verified += workers[t].candidates_verified;
+        free(workers[t].pair_poly);
+        free(workers[t].gcd_poly);
+    }
+    results->tests_performed += verified;
+    results->search_completed = ok && (!stop || results->early_exit_triggered);
+
+    if (results->crc_model_count > 1) {
+        qsort(results->crc_models, results->crc_model_count, sizeof(crc_model_t), compare_crc_models);
+    }
+    if (ok && config->verbose) {
+        printf("   Catalogue spans checked: %llu\n", (unsigned long long)spans_checked);
+        printf("   Candidate polynomials verified: %llu\n", (unsigned long long)verified);
+    }
+
+    free(workers);
+    free(threads);
+    free(ranges);
+    free(group_of);
+    pthread_mutex_destroy(&work_mutex);
+    pthread_mutex_destroy(&results_mutex);
+    return ok;
+}
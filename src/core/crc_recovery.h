@@ -0,0 +1,16 @@
+#ifndef CRC_RECOVERY_H
+#define CRC_RECOVERY_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Reference bitwise CRC of data[model->data_start, length - model->data_end_trim).
+// Frames shorter than the range yield the model's empty-message CRC.
+uint64_t crc_model_compute(const crc_model_t* model, const uint8_t* data, size_t length);
+
+// True when the model reproduces every packet's expected checksum
+bool crc_model_matches_dataset(const crc_model_t* model, const packet_dataset_t* dataset);
+
+void print_crc_model(const crc_model_t* model);
+
+#endif // CRC_RECOVERY_H
@@ -0,0 +1,173 @@
+#include "differential_analysis.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    uint64_t key;                      // Hash of the frame with one position blanked
+    size_t packet;
+} difference_key_t;
+
+static int compare_difference_keys(const void* a, const void* b) {
+    const difference_key_t* x = (const difference_key_t*)a;
+    const difference_key_t* y = (const difference_key_t*)b;
+    if (x->key != y->key) return x->key < y->key ? -1 : 1;
+    return x->packet < y->packet ? -1 : x->packet > y->packet;
+}
+
+static uint64_t blanked_frame_hash(const test_packet_t* packet, size_t blank) {
+    uint64_t h = 1469598103934665603ULL ^ packet->packet_length;
+    for (size_t i = 0; i < packet->packet_length; i++) {
+        h ^= i == blank ? 0x100 : packet->packet_data[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static bool equal_except(const test_packet_t* a, const test_packet_t* b, size_t blank) {
+    if (a->packet_length != b->packet_length) return false;
+    for (size_t i = 0; i < a->packet_length; i++) {
+        if (i != blank && a->packet_data[i] != b->packet_data[i]) return false;
+    }
+    return true;
+}
+
+// Rank used for the enumeration order: linear responders, other influential bytes,
+// unobserved bytes, then bytes that never moved the checksum
+static int response_rank(byte_response_t response) {
+    switch (response) {
+        case BYTE_RESPONSE_XOR:
+        case BYTE_RESPONSE_ADD:
+        case BYTE_RESPONSE_SUB: return 0;
+        case BYTE_RESPONSE_NONLINEAR: return 1;
+        case BYTE_RESPONSE_UNOBSERVED: return 2;
+        default: return 3;
+    }
+}
+
+differential_analysis_t* analyze_packet_differences(const packet_dataset_t* dataset, size_t checksum_size) {
+    if (!dataset || dataset->count == 0) return NULL;
+
+    size_t byte_count = SIZE_MAX;
+    for (size_t p = 0; p < dataset->count; p++) {
+        if (dataset->packets[p].packet_length < byte_count) byte_count = dataset->packets[p].packet_length;
+    }
+    if (byte_count > 256) byte_count = 256;
+
+    differential_analysis_t* analysis = calloc(1, sizeof(differential_analysis_t));
+    if (!analysis) return NULL;
+    analysis->byte_count = byte_count;
+    size_t slots = byte_count ? byte_count : 1;
+    analysis->response = calloc(slots, sizeof(uint8_t));
+    analysis->pair_counts = calloc(slots, sizeof(uint32_t));
+    analysis->influential = calloc(slots, sizeof(bool));
+    analysis->field_order = calloc(slots, sizeof(uint8_t));
+    difference_key_t* keys = malloc(dataset->count * sizeof(difference_key_t));
+    if (!analysis->response || !analysis->pair_counts || !analysis->influential || !analysis->field_order || !keys) {
+        free(keys);
+        free_differential_analysis(analysis);
+        return NULL;
+    }
+
+    uint64_t mask = checksum_size >= 8 ? UINT64_MAX : ((1ULL << (checksum_size * 8)) - 1);
+    for (size_t b = 0; b < byte_count; b++) {
+        for (size_t p = 0; p < dataset->count; p++) {
+            keys[p].key = blanked_frame_hash(&dataset->packets[p], b);
+            keys[p].packet = p;
+        }
+        qsort(keys, dataset->count, sizeof(difference_key_t), compare_difference_keys);
+
+        bool xor_linear = true, additive = true, subtractive = true, changed = false;
+        for (size_t start = 0; start < dataset->count;) {
+            size_t end = start + 1;
+            while (end < dataset->count && keys[end].key == keys[start].key) end++;
+
+            // Compare every member against the first: the responses are transitive
+            const test_packet_t* base = &dataset->packets[keys[start].packet];
+            uint64_t base_sum = base->expected_checksum & mask;
+            for (size_t k = start + 1; k < end; k++) {
+                const test_packet_t* other = &dataset->packets[keys[k].packet];
+                if (other->packet_data[b] == base->packet_data[b] || !equal_except(base, other, b)) continue;
+                analysis->pair_counts[b]++;
+                uint64_t other_sum = other->expected_checksum & mask;
+                uint64_t byte_delta = (uint64_t)other->packet_data[b] - base->packet_data[b];
+                if (other_sum != base_sum) changed = true;
+                if ((other_sum ^ base_sum) != (uint64_t)(other->packet_data[b] ^ base->packet_data[b])) xor_linear = false;
+                if (((other_sum - base_sum) & mask) != (byte_delta & mask)) additive = false;
+                if (((base_sum - other_sum) & mask) != (byte_delta & mask)) subtractive = false;
+            }
+            start = end;
+        }
+
+        analysis->single_byte_pairs += analysis->pair_counts[b];
+        if (analysis->pair_counts[b] == 0) {
+            analysis->response[b] = BYTE_RESPONSE_UNOBSERVED;
+        } else if (!changed) {
+            analysis->response[b] = BYTE_RESPONSE_NONE;
+        } else {
+            analysis->influential[b] = true;
+            analysis->influential_count++;
+            analysis->response[b] = xor_linear ? BYTE_RESPONSE_XOR
+                                  : additive ? BYTE_RESPONSE_ADD
+                                  : subtractive ? BYTE_RESPONSE_SUB : BYTE_RESPONSE_NONLINEAR;
+        }
+    }
+    free(keys);
+
+    size_t n = 0;
+    for (int rank = 0; rank <= 3; rank++) {
+        for (size_t b = 0; b < byte_count; b++) {
+            if (response_rank((byte_response_t)analysis->response[b]) == rank) analysis->field_order[n++] = (uint8_t)b;
+        }
+    }
+    return analysis;
+}
+
+void free_differential_analysis(differential_analysis_t* analysis) {
+    if (!analysis) return;
+    free(analysis->response);
+    free(analysis->pair_counts);
+    free(analysis->influential);
+    free(analysis->field_order);
+    free(analysis);
+}
+
+bool differential_fields_allowed(const differential_analysis_t* analysis, const uint8_t* fields,
+                                 int field_count, size_t checksum_size) {
+    if (!analysis || analysis->influential_count == 0) return true;
+    size_t span = checksum_size > 1 ? checksum_size : 1;
+    int covered = 0;
+    for (size_t b = 0; b < analysis->byte_count; b++) {
+        if (!analysis->influential[b]) continue;
+        bool hit = false;
+        for (int f = 0; f < field_count && !hit; f++) {
+            hit = fields[f] <= b && b < (size_t)fields[f] + span;
+        }
+        if (!hit) return false;
+        if (++covered == analysis->influential_count) break;
+    }
+    return true;
+}
+
+static const char* response_name(byte_response_t response) {
+    switch (response) {
+        case BYTE_RESPONSE_NONE: return "none";
+        case BYTE_RESPONSE_XOR: return "xor";
+        case BYTE_RESPONSE_ADD: return "add";
+        case BYTE_RESPONSE_SUB: return "sub";
+        case BYTE_RESPONSE_NONLINEAR: return "nonlinear";
+        default: return "unobserved";
+    }
+}
+
+void print_differential_analysis(const differential_analysis_t* analysis) {
+    if (!analysis) return;
+    printf("🔬 Differential analysis: %zu single-byte frame pairs, %d influential byte(s)\n",
+           analysis->single_byte_pairs, analysis->influential_count);
+    for (size_t b = 0; b < analysis->byte_count; b++) {
+        if (analysis->response[b] == BYTE_RESPONSE_UNOBSERVED) continue;
+        printf("   byte %-3zu %-10s (%u pair%s)%s\n", b, response_name((byte_response_t)analysis->response[b]),
+               analysis->pair_counts[b], analysis->pair_counts[b] == 1 ? "" : "s",
+               analysis->influential[b] ? " required" : "");
+    }
+}
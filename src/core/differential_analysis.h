@@ -0,0 +1,41 @@
+#ifndef DIFFERENTIAL_ANALYSIS_H
+#define DIFFERENTIAL_ANALYSIS_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Differential analysis over frame pairs that differ in exactly one byte. If such a pair
+// has different checksums, that byte provably influences the checksum: every chain must
+// read a field covering it. The response to the change (XOR, additive, ...) is recorded
+// per byte and used to order the field enumeration.
+
+typedef enum {
+    BYTE_RESPONSE_UNOBSERVED = 0,      // No pair of frames differs in this byte alone
+    BYTE_RESPONSE_NONE,                // Changing the byte alone never changed the checksum
+    BYTE_RESPONSE_XOR,                 // Checksum XOR difference equals the byte XOR difference
+    BYTE_RESPONSE_ADD,                 // Checksum difference equals the byte difference
+    BYTE_RESPONSE_SUB,                 // Checksum difference is the negated byte difference
+    BYTE_RESPONSE_NONLINEAR            // Influences the checksum without a linear response
+} byte_response_t;
+
+typedef struct {
+    size_t byte_count;                 // Positions analysed (shortest frame length)
+    size_t single_byte_pairs;          // Frame pairs differing in exactly one byte
+    uint8_t* response;                 // byte_response_t per position
+    uint32_t* pair_counts;             // Single-byte pairs per position
+    bool* influential;                 // Proven to change the checksum
+    int influential_count;
+    uint8_t* field_order;              // Positions, most informative first
+} differential_analysis_t;
+
+// Returns NULL on allocation failure or an empty dataset
+differential_analysis_t* analyze_packet_differences(const packet_dataset_t* dataset, size_t checksum_size);
+void free_differential_analysis(differential_analysis_t* analysis);
+
+// True when the fields (each spanning checksum_size bytes) cover every influential byte
+bool differential_fields_allowed(const differential_analysis_t* analysis, const uint8_t* fields,
+                                 int field_count, size_t checksum_size);
+
+void print_differential_analysis(const differential_analysis_t* analysis);
+
+#endif // DIFFERENTIAL_ANALYSIS_H
@@ -0,0 +1,183 @@
+#include "field_dependency.h"
+#include "checksum_engine.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define FD_MAX_EVALUATIONS (1u << 22)  // Field sets partitioned before the filter stops growing
+
+// Build-time state for the depth-first walk over field sets
+typedef struct {
+    const uint64_t* values;            // field_limit x packet_count projected field values
+    const uint64_t* expected;
+    size_t packet_count;
+    int max_fields;
+    uint64_t* classes;                 // (max_fields + 1) x packet_count class hashes
+    uint64_t* slot_keys;               // Class lookup table, reset per set with a generation stamp
+    uint32_t* slot_packets;
+    uint32_t* slot_stamps;
+    size_t slot_mask;
+    uint32_t stamp;
+    fd_filter_t* filter;
+    bool ok;
+} fd_builder_t;
+
+static uint64_t refine_class(uint64_t parent, uint64_t value) {
+    uint64_t x = parent + value * 0x9E3779B97F4A7C15ULL + 0x632BE59BD9B4E019ULL;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 29;
+    return x;
+}
+
+static size_t mask_slot(uint64_t mask, size_t capacity) {
+    return (size_t)((mask * 0x9E3779B97F4A7C15ULL) >> 17) & (capacity - 1);
+}
+
+static bool insert_rejected(fd_filter_t* filter, uint64_t mask) {
+    if ((filter->rejected_count + 1) * 2 > filter->capacity) {
+        size_t capacity = filter->capacity * 2;
+        uint64_t* table = calloc(capacity, sizeof(uint64_t));
+        if (!table) return false;
+        for (size_t i = 0; i < filter->capacity; i++) {
+            uint64_t m = filter->rejected[i];
+            if (!m) continue;
+            size_t s = mask_slot(m, capacity);
+            while (table[s]) s = (s + 1) & (capacity - 1);
+            table[s] = m;
+        }
+        free(filter->rejected);
+        filter->rejected = table;
+        filter->capacity = capacity;
+    }
+    size_t s = mask_slot(mask, filter->capacity);
+    while (filter->rejected[s]) s = (s + 1) & (filter->capacity - 1);
+    filter->rejected[s] = mask;
+    filter->rejected_count++;
+    return true;
+}
+
+bool fd_filter_allows(const fd_filter_t* filter, uint64_t field_mask) {
+    if (!filter || filter->rejected_count == 0) return true;
+    size_t s = mask_slot(field_mask, filter->capacity);
+    while (filter->rejected[s]) {
+        if (filter->rejected[s] == field_mask) return false;
+        s = (s + 1) & (filter->capacity - 1);
+    }
+    return true;
+}
+
+// True when two packets agree on every field of the set but not on the checksum.
+// Hash collisions between distinct tuples are checked exactly and never reject.
+static bool has_conflict(fd_builder_t* b, const uint64_t* classes, uint64_t mask) {
+    b->stamp++;
+    for (size_t p = 0; p < b->packet_count; p++) {
+        size_t s = (size_t)(classes[p] >> 7) & b->slot_mask;
+        while (b->slot_stamps[s] == b->stamp && b->slot_keys[s] != classes[p]) s = (s + 1) & b->slot_mask;
+        if (b->slot_stamps[s] != b->stamp) {
+            b->slot_stamps[s] = b->stamp;
+            b->slot_keys[s] = classes[p];
+            b->slot_packets[s] = (uint32_t)p;
+            continue;
+        }
+        size_t q = b->slot_packets[s];
+        if (b->expected[q] == b->expected[p]) continue;
+        bool same_tuple = true;
+        for (uint64_t m = mask; m && same_tuple; m &= m - 1) {
+            size_t f = (size_t)__builtin_ctzll(m);
+            same_tuple = b->values[f * b->packet_count + p] == b->values[f * b->packet_count + q];
+        }
+        if (same_tuple) return true;
+    }
+    return false;
+}
+
+// Supersets of a set that determines the checksum determine it too, so only the
+// subtrees under failing sets are walked
+static void visit_field_sets(fd_builder_t* b, int first_field, int depth, uint64_t mask) {
+    const uint64_t* parent = &b->classes[(size_t)depth * b->packet_count];
+    uint64_t* classes = &b->classes[(size_t)(depth + 1) * b->packet_count];
+    for (int f = first_field; f < b->filter->field_limit && b->ok; f++) {
+        if (b->filter->evaluated >= FD_MAX_EVALUATIONS) return;
+        const uint64_t* values = &b->values[(size_t)f * b->packet_count];
+        for (size_t p = 0; p < b->packet_count; p++) classes[p] = refine_class(parent[p], values[p]);
+
+        uint64_t field_set = mask | (1ULL << f);
+        b->filter->evaluated++;
+        if (!has_conflict(b, classes, field_set)) continue;
+        if (!insert_rejected(b->filter, field_set)) {
+            b->ok = false;
+            return;
+        }
+        if (depth + 1 < b->max_fields) visit_field_sets(b, f + 1, depth + 1, field_set);
+    }
+}
+
+fd_filter_t* build_fd_filter(const packet_dataset_t* dataset, size_t checksum_size, int max_fields) {
+    if (!dataset || dataset->count == 0 || max_fields < 1) return NULL;
+    size_t field_limit = SIZE_MAX;
+    for (size_t p = 0; p < dataset->count; p++) {
+        if (dataset->packets[p].packet_length < field_limit) field_limit = dataset->packets[p].packet_length;
+    }
+    if (field_limit == 0 || field_limit > 64) return NULL;
+    if (max_fields > (int)field_limit) max_fields = (int)field_limit;
+
+    size_t n = dataset->count;
+    size_t slots = 16;
+    while (slots < n * 2) slots <<= 1;
+
+    fd_filter_t* filter = calloc(1, sizeof(fd_filter_t));
+    fd_builder_t b = {
+        .packet_count = n,
+        .max_fields = max_fields,
+        .slot_mask = slots - 1,
+        .filter = filter,
+        .ok = true
+    };
+    uint64_t* values = malloc(field_limit * n * sizeof(uint64_t));
+    uint64_t* expected = malloc(n * sizeof(uint64_t));
+    b.classes = calloc((size_t)(max_fields + 1) * n, sizeof(uint64_t));
+    b.slot_keys = malloc(slots * sizeof(uint64_t));
+    b.slot_packets = malloc(slots * sizeof(uint32_t));
+    b.slot_stamps = calloc(slots, sizeof(uint32_t));
+    if (filter) {
+        filter->capacity = 64;
+        filter->rejected = calloc(filter->capacity, sizeof(uint64_t));
+        filter->field_limit = (int)field_limit;
+    }
+    if (!filter || !filter->rejected || !values || !expected || !b.classes ||
+        !b.slot_keys || !b.slot_packets || !b.slot_stamps) {
+        b.ok = false;
+    } else {
+        for (size_t f = 0; f < field_limit; f++) {
+            for (size_t p = 0; p < n; p++) {
+                const test_packet_t* packet = &dataset->packets[p];
+                values[f * n + p] = extract_packet_field_value(packet->packet_data, packet->packet_length,
+                                                               (uint8_t)f, checksum_size);
+            }
+        }
+        for (size_t p = 0; p < n; p++) {
+            expected[p] = mask_checksum_to_size(dataset->packets[p].expected_checksum, checksum_size);
+        }
+        b.values = values;
+        b.expected = expected;
+        visit_field_sets(&b, 0, 0, 0);
+    }
+
+    free(values);
+    free(expected);
+    free(b.classes);
+    free(b.slot_keys);
+    free(b.slot_packets);
+    free(b.slot_stamps);
+    if (!b.ok) {
+        free_fd_filter(filter);
+        return NULL;
+    }
+    return filter;
+}
+
+void free_fd_filter(fd_filter_t* filter) {
+    if (!filter) return;
+    free(filter->rejected);
+    free(filter);
+}
@@ -0,0 +1,28 @@
+#ifndef FIELD_DEPENDENCY_H
+#define FIELD_DEPENDENCY_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Functional-dependency filter on field sets. A chain only reads its fields and the
+// constant, so if two packets agree on every field of a set but have different
+// checksums, no operation sequence over that set (or any subset) can be a solution.
+// The check partitions packets by their projected field tuples, refining the partition
+// one field at a time, and is computed once for every set the search will visit.
+
+typedef struct {
+    uint64_t* rejected;                // Open-addressing set of failing field masks (bit i = field i)
+    size_t capacity;
+    size_t rejected_count;
+    size_t evaluated;                  // Field sets whose partition was computed
+    int field_limit;                   // Fields 0..field_limit-1 are covered
+} fd_filter_t;
+
+// Returns NULL when the frames are too long for 64-bit masks or on allocation failure
+fd_filter_t* build_fd_filter(const packet_dataset_t* dataset, size_t checksum_size, int max_fields);
+void free_fd_filter(fd_filter_t* filter);
+
+// False when the field set provably cannot determine the checksum. NULL filters allow all.
+bool fd_filter_allows(const fd_filter_t* filter, uint64_t field_mask);
+
+#endif // FIELD_DEPENDENCY_H
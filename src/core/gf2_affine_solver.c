@@ -0,0 +1,271 @@
+#include "gf2_affine_solver.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GF2_TEST(row, col) (((row)[(col) >> 6] >> ((col) & 63)) & 1ULL)
+#define GF2_SET(row, col) ((row)[(col) >> 6] |= 1ULL << ((col) & 63))
+
+static bool packet_bit(const test_packet_t* packet, size_t input_bit) {
+    return (packet->packet_data[input_bit >> 3] >> (input_bit & 7)) & 1;
+}
+
+gf2_affine_result_t* solve_gf2_affine(const packet_dataset_t* dataset, size_t checksum_size) {
+    if (!dataset || dataset->count == 0 || checksum_size < 1 || checksum_size > CADS_MAX_CHECKSUM_SIZE) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    size_t length = most_common_length(dataset, &used);
+    size_t input_bits = length * 8;
+    int checksum_bits = (int)checksum_size * 8;
+    uint64_t checksum_mask = checksum_bits == 64 ? UINT64_MAX : ((1ULL << checksum_bits) - 1);
+
+    gf2_affine_result_t* result = calloc(1, sizeof(gf2_affine_result_t));
+    if (!result) return NULL;
+    result->packet_length = length;
+    result->packets_used = used;
+    result->packets_skipped = dataset->count - used;
+    result->checksum_bits = checksum_bits;
+    result->coefficient_words = (input_bits + 63) / 64;
+    result->coefficients = calloc((size_t)checksum_bits * (result->coefficient_words ? result->coefficient_words : 1),
+                                  sizeof(uint64_t));
+    result->byte_relevance = calloc(length ? length : 1, 1);
+
+    const test_packet_t** rows = malloc(used * sizeof(test_packet_t*));
+    size_t* active = malloc((input_bits ? input_bits : 1) * sizeof(size_t));
+    if (!result->coefficients || !result->byte_relevance || !rows || !active) {
+        free(rows);
+        free(active);
+        free_gf2_affine_result(result);
+        return NULL;
+    }
+    size_t m = 0;
+    for (size_t i = 0; i < dataset->count; i++) {
+        if (dataset->packets[i].packet_length == length) rows[m++] = &dataset->packets[i];
+    }
+
+    // Bits that never change are indistinguishable from the affine constant
+    size_t v = 0;
+    for (size_t bit = 0; bit < input_bits; bit++) {
+        bool first = packet_bit(rows[0], bit);
+        for (size_t r = 1; r < m; r++) {
+            if (packet_bit(rows[r], bit) != first) {
+                active[v++] = bit;
+                break;
+            }
+        }
+    }
+    result->active_bits = (int)v;
+
+    // Columns: v active bits, the constant, then one right-hand side per checksum bit
+    size_t unknowns = v + 1;
+    size_t columns = unknowns + (size_t)checksum_bits;
+    size_t words = (columns + 63) / 64;
+    uint64_t* matrix = calloc(m * words, sizeof(uint64_t));
+    int* pivot_row = malloc(unknowns * sizeof(int));
+    if (!matrix || !pivot_row) {
+        free(matrix);
+        free(pivot_row);
+        free(rows);
+        free(active);
+        free_gf2_affine_result(result);
+        return NULL;
+    }
+    for (size_t r = 0; r < m; r++) {
+        uint64_t* row = &matrix[r * words];
+        for (size_t j = 0; j < v; j++) {
+            if (packet_bit(rows[r], active[j])) GF2_SET(row, j);
+        }
+        GF2_SET(row, v);
+        uint64_t expected = rows[r]->expected_checksum & checksum_mask;
+        for (int k = 0; k < checksum_bits; k++) {
+            if ((expected >> k) & 1) GF2_SET(row, unknowns + (size_t)k);
+        }
+    }
+
+    // Reduced row echelon form over the unknown columns
+    size_t rank = 0;
+    for (size_t col = 0; col < unknowns; col++) {
+        pivot_row[col] = -1;
+        size_t pivot = rank;
+        while (pivot < m && !GF2_TEST(&matrix[pivot * words], col)) pivot++;
+        if (pivot == m) continue;
+        if (pivot != rank) {
+            for (size_t w = 0; w < words; w++) {
+                uint64_t t = matrix[pivot * words + w];
+                matrix[pivot * words + w] = matrix[rank * words + w];
+                matrix[rank * words + w] = t;
+            }
+        }
+        const uint64_t* pivot_bits = &matrix[rank * words];
+        for (size_t r = 0; r < m; r++) {
+            if (r != rank && GF2_TEST(&matrix[r * words], col)) {
+                for (size_t w = col >> 6; w < words; w++) matrix[r * words + w] ^= pivot_bits[w];
+            }
+        }
+        pivot_row[col] = (int)rank++;
+    }
+    result->rank = (int)rank;
+    result->nullity = (int)(unknowns - rank);
+    result->underdetermined = result->nullity > 0;
+
+    // Rows without a pivot read 0 = rhs; any set rhs bit has no solution
+    for (size_t r = rank; r < m; r++) {
+        for (int k = 0; k < checksum_bits; k++) {
+            if (GF2_TEST(&matrix[r * words], unknowns + (size_t)k)) result->inconsistent_bits |= 1ULL << k;
+        }
+    }
+    result->consistent = result->inconsistent_bits == 0;
+
+    // Particular solution (free unknowns = 0) and which coefficients the data pins down
+    bool* determined = calloc(unknowns, sizeof(bool));
+    if (determined) {
+        for (size_t col = 0; col < unknowns; col++) {
+            if (pivot_row[col] < 0) continue;
+            const uint64_t* row = &matrix[(size_t)pivot_row[col] * words];
+            determined[col] = true;
+            for (size_t f = 0; f < unknowns; f++) {
+                if (pivot_row[f] < 0 && GF2_TEST(row, f)) {
+                    determined[col] = false;
+                    break;
+                }
+            }
+            for (int k = 0; k < checksum_bits; k++) {
+                if (!GF2_TEST(row, unknowns + (size_t)k)) continue;
+                if (col == v) {
+                    result->offset |= 1ULL << k;
+                } else {
+                    GF2_SET(&result->coefficients[(size_t)k * result->coefficient_words], active[col]);
+                }
+            }
+        }
+
+        size_t j = 0;
+        for (size_t byte = 0; byte < length; byte++) {
+            bool any_active = false, relevant = false, ambiguous = false;
+            for (; j < v && active[j] / 8 == byte; j++) {
+                any_active = true;
+                if (!determined[j]) {
+                    ambiguous = true;
+                    continue;
+                }
+                for (int k = 0; k < checksum_bits; k++) {
+                    if (GF2_TEST(&result->coefficients[(size_t)k * result->coefficient_words], active[j])) relevant = true;
+                }
+            }
+            result->byte_relevance[byte] = !any_active ? GF2_BYTE_CONSTANT
+                                         : relevant ? GF2_BYTE_RELEVANT
+                                         : ambiguous ? GF2_BYTE_AMBIGUOUS : GF2_BYTE_UNUSED;
+        }
+    }
+
+    free(determined);
+    free(matrix);
+    free(pivot_row);
+    free(rows);
+    free(active);
+    return result;
+}
+
+void free_gf2_affine_result(gf2_affine_result_t* result) {
+    if (!result) return;
+    free(result->coefficients);
+    free(result->byte_relevance);
+    free(result);
+}
+
+bool gf2_affine_coefficient(const gf2_affine_result_t* result, int out_bit, size_t byte, int bit) {
+    if (!result || out_bit < 0 || out_bit >= result->checksum_bits || byte >= result->packet_length) return false;
+    const uint64_t* row = &result->coefficients[(size_t)out_bit * result->coefficient_words];
+    return GF2_TEST(row, byte * 8 + (size_t)bit);
+}
+
+bool gf2_affine_to_solution(const gf2_affine_result_t* result, checksum_solution_t* solution) {
+    if (!result || !result->consistent || result->checksum_bits != 8) return false;
+
+    memset(solution, 0, sizeof(*solution));
+    for (size_t byte = 0; byte < result->packet_length; byte++) {
+        int set = 0;
+        bool aligned = true;
+        for (int k = 0; k < 8; k++) {
+            for (int bit = 0; bit < 8; bit++) {
+                bool c = gf2_affine_coefficient(result, k, byte, bit);
+                if (c) set++;
+                if (c != (bit == k) && c) aligned = false;
+            }
+        }
+        if (set == 0) continue;
+        if (!aligned || set != 8 || solution->field_count >= CADS_MAX_FIELDS) return false;
+        solution->field_indices[solution->field_count++] = (uint8_t)byte;
+    }
+    if (solution->field_count == 0) return false;
+
+    for (int f = 1; f < solution->field_count; f++) {
+        solution->operations[solution->operation_count++] = OP_XOR;
+    }
+    if (result->offset != 0) {
+        solution->operations[solution->operation_count++] = OP_CONST_XOR;
+    }
+    solution->constant = result->offset;
+    solution->checksum_size = 1;
+    return true;
+}
+
+static void print_bytes_with(const gf2_affine_result_t* result, gf2_byte_relevance_t kind, const char* label) {
+    bool any = false;
+    for (size_t byte = 0; byte < result->packet_length; byte++) {
+        if (result->byte_relevance[byte] != kind) continue;
+        if (!any) printf("   %s:", label);
+        printf(" %zu", byte);
+        any = true;
+    }
+    if (any) printf("\n");
+}
+
+void print_gf2_affine_result(const gf2_affine_result_t* result, bool verbose) {
+    if (!result) return;
+    printf("🧮 GF(2) affine pre-phase: %zu packets of %zu bytes", result->packets_used, result->packet_length);
+    if (result->packets_skipped > 0) printf(" (%zu of other lengths skipped)", result->packets_skipped);
+    printf(", %d varying input bits, rank %d\n", result->active_bits, result->rank);
+
+    size_t redundant = result->packets_used - (size_t)result->rank;
+    if (!result->consistent) {
+        printf("   ❌ Not affine over GF(2): checksum bits 0x%llX have no solution\n",
+               (unsigned long long)result->inconsistent_bits);
+        return;
+    }
+    if (redundant == 0) {
+        printf("   ⚠️  Consistent, but no redundant packets: any checksum would fit\n");
+    } else {
+        printf("   ✅ Consistent affine model, confirmed by %zu redundant packet(s)\n", redundant);
+    }
+    if (result->underdetermined) {
+        printf("   Underdetermined: %d coefficient(s) not fixed by the dataset\n", result->nullity);
+    } else {
+        printf("   Fully determined\n");
+    }
+    print_bytes_with(result, GF2_BYTE_RELEVANT, "Relevant bytes");
+    print_bytes_with(result, GF2_BYTE_AMBIGUOUS, "Ambiguous bytes");
+    print_bytes_with(result, GF2_BYTE_CONSTANT, "Constant bytes");
+
+    if (verbose) {
+        for (int k = 0; k < result->checksum_bits; k++) {
+            printf("   c%-2d =", k);
+            bool any = false;
+            for (size_t byte = 0; byte < result->packet_length; byte++) {
+                for (int bit = 0; bit < 8; bit++) {
+                    if (gf2_affine_coefficient(result, k, byte, bit)) {
+                        printf("%s b%zu.%d", any ? " ^" : "", byte, bit);
+                        any = true;
+                    }
+                }
+            }
+            if ((result->offset >> k) & 1) {
+                printf("%s 1", any ? " ^" : "");
+                any = true;
+            }
+            printf("%s\n", any ? "" : " 0");
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef GF2_AFFINE_SOLVER_H
+#define GF2_AFFINE_SOLVER_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Affine model over GF(2): every checksum bit is an XOR of packet bits plus a constant.
+// Parity bytes, XOR-of-fields and CRCs over fixed-length frames all fit this model, so one
+// Gaussian elimination over the dataset either recovers the checksum or rules it out.
+
+typedef enum {
+    GF2_BYTE_UNUSED = 0,               // Every bit has a determined zero coefficient
+    GF2_BYTE_RELEVANT,                 // At least one bit has a determined non-zero coefficient
+    GF2_BYTE_AMBIGUOUS,                // Some coefficient is not pinned down by the dataset
+    GF2_BYTE_CONSTANT                  // Same value in every packet; folded into the offset
+} gf2_byte_relevance_t;
+
+typedef struct {
+    bool consistent;                   // Every checksum bit has an affine solution
+    bool underdetermined;              // More than one solution fits (nullity > 0)
+    size_t packet_length;              // Frame length solved for (most common length)
+    size_t packets_used;
+    size_t packets_skipped;            // Packets of another length
+    int active_bits;                   // Input bits that vary across the dataset
+    int rank;
+    int nullity;
+    int checksum_bits;
+    uint64_t inconsistent_bits;        // Checksum bits with no affine solution
+    size_t coefficient_words;          // uint64_t words per checksum bit row
+    uint64_t* coefficients;            // checksum_bits rows of one particular solution (free bits = 0)
+    uint64_t offset;                   // Affine constant, one bit per checksum bit
+    uint8_t* byte_relevance;           // gf2_byte_relevance_t per input byte
+} gf2_affine_result_t;
+
+// Returns NULL on allocation failure or an empty dataset
+gf2_affine_result_t* solve_gf2_affine(const packet_dataset_t* dataset, size_t checksum_size);
+void free_gf2_affine_result(gf2_affine_result_t* result);
+
+// Coefficient of input bit (byte, bit) in checksum bit out_bit of the particular solution
+bool gf2_affine_coefficient(const gf2_affine_result_t* result, int out_bit, size_t byte, int bit);
+
+// Express a determined 1-byte model of the form byte_i ^ byte_j ^ ... ^ K as an
+// XOR/C^ operation chain. Returns false for any other shape.
+bool gf2_affine_to_solution(const gf2_affine_result_t* result, checksum_solution_t* solution);
+
+void print_gf2_affine_result(const gf2_affine_result_t* result, bool verbose);
+
+#endif // GF2_AFFINE_SOLVER_H
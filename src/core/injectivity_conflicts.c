@@ -0,0 +1,123 @@
+#include "injectivity_conflicts.h"
+#include <stdlib.h>
+#include <string.h>
+
+static uint64_t mix_value(uint64_t parent, uint64_t value) {
+    uint64_t x = parent + value * 0x9E3779B97F4A7C15ULL + 0x632BE59BD9B4E019ULL;
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDULL;
+    x ^= x >> 29;
+    return x;
+}
+
+conflict_detector_t* create_conflict_detector(size_t packet_count, const uint64_t* expected) {
+    if (packet_count < 2 || packet_count > UINT32_MAX) return NULL;
+    size_t slots = 16;
+    while (slots < packet_count * 2) slots <<= 1;
+
+    conflict_detector_t* detector = calloc(1, sizeof(conflict_detector_t));
+    if (!detector) return NULL;
+    detector->packet_count = packet_count;
+    detector->expected = expected;
+    detector->slot_keys = malloc(slots * sizeof(uint64_t));
+    detector->slot_packets = malloc(slots * sizeof(uint32_t));
+    detector->slot_stamps = calloc(slots, sizeof(uint32_t));
+    detector->slot_mask = slots - 1;
+    detector->state_keys = malloc(packet_count * sizeof(uint64_t));
+    if (!detector->slot_keys || !detector->slot_packets || !detector->slot_stamps || !detector->state_keys) {
+        free_conflict_detector(detector);
+        return NULL;
+    }
+    return detector;
+}
+
+void free_conflict_detector(conflict_detector_t* detector) {
+    if (!detector) return;
+    free(detector->tuple_hashes);
+    free(detector->subset_collides);
+    free(detector->slot_keys);
+    free(detector->slot_packets);
+    free(detector->slot_stamps);
+    free(detector->state_keys);
+    free(detector);
+}
+
+// Shared probe for both checks: keys[p] buckets the packets, and a bucket mate with another
+// expected checksum that also agrees on the value and the subset's fields is a conflict.
+// Hash collisions between distinct tuples are checked exactly and never count.
+static bool find_conflict(conflict_detector_t* d, const uint64_t* keys, const uint64_t* values,
+                          uint64_t value_mask, uint32_t subset) {
+    if (++d->stamp == 0) {
+        memset(d->slot_stamps, 0, (d->slot_mask + 1) * sizeof(uint32_t));
+        d->stamp = 1;
+    }
+    for (size_t p = 0; p < d->packet_count; p++) {
+        size_t s = (size_t)(keys[p] >> 7) & d->slot_mask;
+        while (d->slot_stamps[s] == d->stamp && d->slot_keys[s] != keys[p]) s = (s + 1) & d->slot_mask;
+        if (d->slot_stamps[s] != d->stamp) {
+            d->slot_stamps[s] = d->stamp;
+            d->slot_keys[s] = keys[p];
+            d->slot_packets[s] = (uint32_t)p;
+            continue;
+        }
+        size_t q = d->slot_packets[s];
+        if (d->expected[q] == d->expected[p]) continue;
+        if (values && ((values[p] ^ values[q]) & value_mask)) continue;
+        bool same_tuple = true;
+        for (uint32_t m = subset; m && same_tuple; m &= m - 1) {
+            size_t f = (size_t)__builtin_ctz(m);
+            same_tuple = d->field_values[f * d->packet_count + p] == d->field_values[f * d->packet_count + q];
+        }
+        if (same_tuple) return true;
+    }
+    return false;
+}
+
+bool conflict_detector_set_fields(conflict_detector_t* detector, const uint64_t* field_values, int field_count) {
+    size_t subsets = (size_t)1 << field_count;
+    if (subsets > detector->subset_capacity) {
+        free(detector->tuple_hashes);
+        free(detector->subset_collides);
+        detector->tuple_hashes = malloc(subsets * detector->packet_count * sizeof(uint64_t));
+        detector->subset_collides = malloc(subsets * sizeof(bool));
+        detector->subset_capacity = subsets;
+        if (!detector->tuple_hashes || !detector->subset_collides) {
+            free(detector->tuple_hashes);
+            free(detector->subset_collides);
+            detector->tuple_hashes = NULL;
+            detector->subset_collides = NULL;
+            detector->subset_capacity = 0;
+            detector->field_count = 0;
+            return false;
+        }
+    }
+    detector->field_values = field_values;
+    detector->field_count = field_count;
+
+    // Each subset extends the subset without its highest field by that field's value
+    size_t n = detector->packet_count;
+    memset(detector->tuple_hashes, 0, n * sizeof(uint64_t));
+    detector->subset_collides[0] = true;
+    for (size_t subset = 1; subset < subsets; subset++) {
+        int top = 31 - __builtin_clz((uint32_t)subset);
+        const uint64_t* parent = &detector->tuple_hashes[(subset & ~((size_t)1 << top)) * n];
+        const uint64_t* values = &field_values[(size_t)top * n];
+        uint64_t* hashes = &detector->tuple_hashes[subset * n];
+        for (size_t p = 0; p < n; p++) hashes[p] = mix_value(parent[p], values[p]);
+        detector->subset_collides[subset] = find_conflict(detector, hashes, NULL, 0, (uint32_t)subset);
+    }
+    return true;
+}
+
+bool chain_state_conflicts(conflict_detector_t* detector, const uint64_t* values, uint64_t value_mask,
+                           uint32_t unread) {
+    if (unread >> detector->field_count || !detector->subset_collides) return false;
+    // Packets that already differ on the unread fields can never be merged by the value
+    if (!detector->subset_collides[unread]) return false;
+
+    size_t n = detector->packet_count;
+    const uint64_t* tuples = &detector->tuple_hashes[(size_t)unread * n];
+    uint64_t* keys = detector->state_keys;
+    for (size_t p = 0; p < n; p++) keys[p] = mix_value(tuples[p], values[p] & value_mask);
+    return find_conflict(detector, keys, values, value_mask, unread);
+}
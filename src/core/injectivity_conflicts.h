@@ -0,0 +1,41 @@
+#ifndef INJECTIVITY_CONFLICTS_H
+#define INJECTIVITY_CONFLICTS_H
+
+#include "../../include/cads_types.h"
+
+// Injectivity-conflict pruning for the recursive search. The rest of a chain only reads
+// the running value, the fields not read yet and the constant, so two packets that agree
+// on all of them end on the same checksum whatever the suffix, field order or constant.
+// If their expected checksums differ, the prefix cannot be completed and its subtree is
+// pruned. This is the field-dependency filter applied after every prefix instead of once
+// per field set.
+
+typedef struct {
+    size_t packet_count;
+    int field_count;
+    const uint64_t* field_values;      // field_count x packet_count, one row per mask field
+    const uint64_t* expected;
+    uint64_t* tuple_hashes;            // Per unread-field subset, a hash of each packet's fields in it
+    bool* subset_collides;             // Per subset: some pair agrees on it but expects different checksums
+    size_t subset_capacity;
+    uint64_t* slot_keys;               // Lookup table, reset per check with a generation stamp
+    uint32_t* slot_packets;
+    uint32_t* slot_stamps;
+    size_t slot_mask;
+    uint32_t stamp;
+    uint64_t* state_keys;              // Per-check scratch: hash of (value, unread tuple) per packet
+} conflict_detector_t;
+
+conflict_detector_t* create_conflict_detector(size_t packet_count, const uint64_t* expected);
+void free_conflict_detector(conflict_detector_t* detector);
+
+// Index the fields of a new mask. Returns false on allocation failure, after which every
+// check reports no conflict.
+bool conflict_detector_set_fields(conflict_detector_t* detector, const uint64_t* field_values, int field_count);
+
+// True when two packets with different expected checksums hold the same running value
+// (compared under value_mask) and agree on every field in unread (bit i = mask field i)
+bool chain_state_conflicts(conflict_detector_t* detector, const uint64_t* values, uint64_t value_mask,
+                           uint32_t unread);
+
+#endif // INJECTIVITY_CONFLICTS_H
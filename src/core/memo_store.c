@@ -0,0 +1,304 @@
+#include "memo_store.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static const char memo_magic[8] = {'C', 'A', 'D', 'S', 'M', 'E', 'M', 'O'};
+#define MEMO_STORE_VERSION 2
+#define MEMO_REGION_HEADER_BYTES 48
+#define MEMO_SOLUTION_BYTES (CADS_MAX_FIELDS + CADS_MAX_SOLUTION_OPS + CADS_MAX_CHAIN_CONSTANTS + 13)
+
+bool default_memo_path(char* path, size_t size) {
+    const char* file = getenv("CADS_MEMO_FILE");
+    if (file && *file) return (size_t)snprintf(path, size, "%s", file) < size;
+    const char* cache = getenv("XDG_CACHE_HOME");
+    if (cache && *cache) return (size_t)snprintf(path, size, "%s/cads/memo.bin", cache) < size;
+    const char* home = getenv("HOME");
+    if (home && *home) return (size_t)snprintf(path, size, "%s/.cache/cads/memo.bin", home) < size;
+    return false;
+}
+
+static void free_regions(memo_region_t* regions, size_t count) {
+    for (size_t i = 0; i < count; i++) free(regions[i].solutions);
+    free(regions);
+}
+
+static bool read_bytes(FILE* file, void* data, size_t size) {
+    return fread(data, 1, size, file) == size;
+}
+
+static bool read_solution(FILE* file, checksum_solution_t* solution) {
+    uint8_t record[MEMO_SOLUTION_BYTES];
+    if (!read_bytes(file, record, sizeof(record))) return false;
+    const uint8_t* p = record;
+    memset(solution, 0, sizeof(*solution));
+    solution->field_count = *p++;
+    memcpy(solution->field_indices, p, CADS_MAX_FIELDS);
+    p += CADS_MAX_FIELDS;
+    solution->operation_count = *p++;
+    for (int o = 0; o < CADS_MAX_SOLUTION_OPS; o++) solution->operations[o] = (operation_t)*p++;
+    memcpy(&solution->constant, p, sizeof(uint64_t));
+    p += sizeof(uint64_t);
+    solution->extra_constant_count = *p++;
+    memcpy(solution->extra_constants, p, CADS_MAX_CHAIN_CONSTANTS - 1);
+    p += CADS_MAX_CHAIN_CONSTANTS - 1;
+    solution->checksum_size = *p++;
+    solution->checksum_bytes = *p++;
+    solution->validated = *p != 0;
+    if (solution->field_count > CADS_MAX_FIELDS || solution->operation_count > CADS_MAX_SOLUTION_OPS ||
+        solution->extra_constant_count > CADS_MAX_CHAIN_CONSTANTS - 1) {
+        return false;
+    }
+    for (int o = 0; o < solution->operation_count; o++) {
+        if (solution->operations[o] >= NUM_OPS) return false;
+    }
+    return true;
+}
+
+static void write_solution(FILE* file, const checksum_solution_t* solution) {
+    uint8_t record[MEMO_SOLUTION_BYTES];
+    uint8_t* p = record;
+    *p++ = (uint8_t)solution->field_count;
+    memcpy(p, solution->field_indices, CADS_MAX_FIELDS);
+    p += CADS_MAX_FIELDS;
+    *p++ = (uint8_t)solution->operation_count;
+    for (int o = 0; o < CADS_MAX_SOLUTION_OPS; o++) *p++ = (uint8_t)solution->operations[o];
+    memcpy(p, &solution->constant, sizeof(uint64_t));
+    p += sizeof(uint64_t);
+    *p++ = (uint8_t)solution->extra_constant_count;
+    memcpy(p, solution->extra_constants, CADS_MAX_CHAIN_CONSTANTS - 1);
+    p += CADS_MAX_CHAIN_CONSTANTS - 1;
+    *p++ = (uint8_t)solution->checksum_size;
+    *p++ = solution->checksum_bytes;
+    *p = solution->validated;
+    fwrite(record, 1, sizeof(record), file);
+}
+
+// Layout fingerprint: a store written by a build with other limits is ignored
+static uint32_t memo_layout(void) {
+    return (uint32_t)MEMO_STORE_VERSION | (uint32_t)CADS_MAX_FIELDS << 8 | (uint32_t)NUM_OPS << 16 |
+           (uint32_t)CADS_MAX_CHAIN_CONSTANTS << 24;
+}
+
+static bool load_regions(memo_store_t* store, FILE* file) {
+    char magic[8];
+    uint32_t layout;
+    uint64_t count, clock;
+    if (!read_bytes(file, magic, sizeof(magic)) || memcmp(magic, memo_magic, sizeof(magic)) != 0 ||
+        !read_bytes(file, &layout, sizeof(layout)) || layout != memo_layout() ||
+        !read_bytes(file, &count, sizeof(count)) || !read_bytes(file, &clock, sizeof(clock)) ||
+        count > MEMO_STORE_MAX_REGIONS) {
+        return false;
+    }
+    memo_region_t* regions = calloc(count ? count : 1, sizeof(memo_region_t));
+    if (!regions) return false;
+    for (uint64_t r = 0; r < count; r++) {
+        memo_region_t* region = &regions[r];
+        uint64_t solution_count;
+        if (!read_bytes(file, &region->key, sizeof(region->key)) ||
+            !read_bytes(file, &region->packet_count, sizeof(region->packet_count)) ||
+            !read_bytes(file, &region->operations, sizeof(region->operations)) ||
+            !read_bytes(file, &region->max_fields, sizeof(region->max_fields)) ||
+            !read_bytes(file, &region->constant_count, sizeof(region->constant_count)) ||
+            !read_bytes(file, &region->last_used, sizeof(region->last_used)) ||
+            !read_bytes(file, &solution_count, sizeof(solution_count)) ||
+            solution_count > MEMO_STORE_BUDGET_BYTES / MEMO_SOLUTION_BYTES) {
+            free_regions(regions, r + 1);
+            return false;
+        }
+        region->solutions = malloc((solution_count ? solution_count : 1) * sizeof(checksum_solution_t));
+        if (!region->solutions) {
+            free_regions(regions, r + 1);
+            return false;
+        }
+        for (uint64_t s = 0; s < solution_count; s++) {
+            if (!read_solution(file, &region->solutions[s])) {
+                free_regions(regions, r + 1);
+                return false;
+            }
+        }
+        region->solution_count = (size_t)solution_count;
+    }
+    store->regions = regions;
+    store->region_count = (size_t)count;
+    store->clock = clock;
+    return true;
+}
+
+memo_store_t* open_memo_store(const char* path, size_t budget_bytes) {
+    memo_store_t* store = calloc(1, sizeof(memo_store_t));
+    if (!store) return NULL;
+    store->budget_bytes = budget_bytes;
+    store->path = strdup(path);
+    if (!store->path) {
+        free(store);
+        return NULL;
+    }
+    FILE* file = fopen(path, "rb");
+    if (file) {
+        load_regions(store, file);
+        fclose(file);
+    }
+    return store;
+}
+
+void free_memo_store(memo_store_t* store) {
+    if (!store) return;
+    free_regions(store->regions, store->region_count);
+    free(store->path);
+    free(store);
+}
+
+static size_t region_bytes(const memo_region_t* region) {
+    return MEMO_REGION_HEADER_BYTES + region->solution_count * MEMO_SOLUTION_BYTES;
+}
+
+static void remove_region(memo_store_t* store, size_t index) {
+    free(store->regions[index].solutions);
+    store->regions[index] = store->regions[--store->region_count];
+}
+
+// Create the directories above path, ignoring the ones that exist
+static void create_parent_directories(const char* path) {
+    char* copy = strdup(path);
+    if (!copy || !copy[0]) {
+        free(copy);
+        return;
+    }
+    for (char* p = copy + 1; *p; p++) {
+        if (*p != '/') continue;
+        *p = '\0';
+        if (mkdir(copy, 0755) != 0 && errno != EEXIST) break;
+        *p = '/';
+    }
+    free(copy);
+}
+
+bool save_memo_store(memo_store_t* store) {
+    size_t total = 0;
+    for (size_t i = 0; i < store->region_count; i++) total += region_bytes(&store->regions[i]);
+    while (store->region_count > 0 && (total > store->budget_bytes || store->region_count > MEMO_STORE_MAX_REGIONS)) {
+        size_t oldest = 0;
+        for (size_t i = 1; i < store->region_count; i++) {
+            if (store->regions[i].last_used < store->regions[oldest].last_used) oldest = i;
+        }
+        total -= region_bytes(&store->regions[oldest]);
+        remove_region(store, oldest);
+    }
+
+    create_parent_directories(store->path);
+    size_t length = strlen(store->path) + 16;
+    char* temporary = malloc(length);
+    if (!temporary) return false;
+    snprintf(temporary, length, "%s.%ld", store->path, (long)getpid());
+    FILE* file = fopen(temporary, "wb");
+    if (!file) {
+        free(temporary);
+        return false;
+    }
+    uint32_t layout = memo_layout();
+    uint64_t count = store->region_count;
+    fwrite(memo_magic, 1, sizeof(memo_magic), file);
+    fwrite(&layout, sizeof(layout), 1, file);
+    fwrite(&count, sizeof(count), 1, file);
+    fwrite(&store->clock, sizeof(store->clock), 1, file);
+    for (size_t r = 0; r < store->region_count; r++) {
+        const memo_region_t* region = &store->regions[r];
+        uint64_t solution_count = region->solution_count;
+        fwrite(&region->key, sizeof(region->key), 1, file);
+        fwrite(&region->packet_count, sizeof(region->packet_count), 1, file);
+        fwrite(&region->operations, sizeof(region->operations), 1, file);
+        fwrite(&region->max_fields, sizeof(region->max_fields), 1, file);
+        fwrite(&region->constant_count, sizeof(region->constant_count), 1, file);
+        fwrite(&region->last_used, sizeof(region->last_used), 1, file);
+        fwrite(&solution_count, sizeof(solution_count), 1, file);
+        for (size_t s = 0; s < region->solution_count; s++) write_solution(file, &region->solutions[s]);
+    }
+    bool written = !ferror(file);
+    written &= fclose(file) == 0;
+    written = written && rename(temporary, store->path) == 0;
+    if (!written) remove(temporary);
+    free(temporary);
+    return written;
+}
+
+static uint64_t mix_hash(uint64_t hash, uint64_t value) {
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    return hash * 0xFF51AFD7ED558CCDULL;
+}
+
+void memo_prefix_keys(const config_t* config, uint64_t* keys) {
+    const packet_dataset_t* dataset = config->dataset;
+    uint64_t hash = mix_hash(0xCBF29CE484222325ULL, config->checksum_size);
+    hash = mix_hash(hash, (uint64_t)config->chain_constants);
+    keys[0] = hash;
+    for (size_t p = 0; p < dataset->count; p++) {
+        const test_packet_t* packet = &dataset->packets[p];
+        hash = mix_hash(hash, packet->packet_length);
+        hash = mix_hash(hash, packet->expected_checksum);
+        hash = mix_hash(hash, packet->checksum_size);
+        for (size_t b = 0; b < packet->packet_length; b++) hash = mix_hash(hash, packet->packet_data[b]);
+        keys[p + 1] = mix_hash(hash, p + 1);
+    }
+}
+
+// Region recorded over the first region->packet_count packets of the dataset keys describe
+static bool region_on_prefix(const memo_region_t* region, const uint64_t* keys, size_t packet_count) {
+    return region->packet_count <= packet_count && region->key == keys[region->packet_count];
+}
+
+const memo_region_t* find_memo_region(memo_store_t* store, const uint64_t* keys, size_t packet_count,
+                                      uint32_t operations, int field_count, int constant_count) {
+    memo_region_t* best = NULL;
+    int best_shared = 0;
+    for (size_t i = 0; i < store->region_count; i++) {
+        memo_region_t* region = &store->regions[i];
+        if (!region_on_prefix(region, keys, packet_count) || region->max_fields < field_count ||
+            region->constant_count < constant_count) {
+            continue;
+        }
+        // Most shared ops first, then the fewest packets left to check
+        int shared = __builtin_popcount(region->operations & operations);
+        if (shared > best_shared || (best && shared == best_shared && region->packet_count > best->packet_count)) {
+            best = region;
+            best_shared = shared;
+        }
+    }
+    if (best) best->last_used = ++store->clock;
+    return best;
+}
+
+bool record_memo_region(memo_store_t* store, const uint64_t* keys, size_t packet_count, uint32_t operations,
+                        int max_fields, int constant_count, const checksum_solution_t* solutions,
+                        size_t solution_count) {
+    if (store->budget_bytes < MEMO_REGION_HEADER_BYTES ||
+        solution_count > (store->budget_bytes - MEMO_REGION_HEADER_BYTES) / MEMO_SOLUTION_BYTES) {
+        return false;
+    }
+    for (size_t i = store->region_count; i-- > 0;) {
+        const memo_region_t* region = &store->regions[i];
+        if (region_on_prefix(region, keys, packet_count) && (region->operations & ~operations) == 0 &&
+            region->max_fields <= max_fields && region->constant_count <= constant_count) {
+            remove_region(store, i);
+        }
+    }
+    memo_region_t* regions = realloc(store->regions, (store->region_count + 1) * sizeof(memo_region_t));
+    if (!regions) return false;
+    store->regions = regions;
+    memo_region_t* region = &regions[store->region_count];
+    region->solutions = malloc((solution_count ? solution_count : 1) * sizeof(checksum_solution_t));
+    if (!region->solutions) return false;
+    if (solution_count) memcpy(region->solutions, solutions, solution_count * sizeof(checksum_solution_t));
+    region->solution_count = solution_count;
+    region->key = keys[packet_count];
+    region->packet_count = packet_count;
+    region->operations = operations;
+    region->max_fields = max_fields;
+    region->constant_count = constant_count;
+    region->last_used = ++store->clock;
+    store->region_count++;
+    return true;
+}
@@ -0,0 +1,67 @@
+#ifndef MEMO_STORE_H
+#define MEMO_STORE_H
+
+#include "../../include/cads_types.h"
+#include "../../include/cads_config_loader.h"
+
+// On-disk memo of exhaustively searched regions. A region is every field set of up to
+// max_fields fields, searched with one op set and constants 0..constant_count-1, for one
+// dataset and the settings that change its solutions; it keeps the solutions found there.
+// A later run over the same dataset, or over it with packets appended, skips per field
+// count the chains a region already tested. Appending packets only removes solutions, so
+// the region's solutions are checked against the new packets and the survivors replayed.
+// Regions are evicted least recently used first once the store outgrows its byte budget.
+
+#define MEMO_STORE_BUDGET_BYTES (32u << 20)
+#define MEMO_STORE_MAX_REGIONS 1024
+
+typedef struct {
+    uint64_t key;                      // memo_prefix_keys entry of the packets and settings
+    uint64_t packet_count;             // Packets the region was searched over
+    uint32_t operations;               // Op set searched, bit i = operation i
+    int max_fields;                    // Every field set of 1..max_fields fields
+    int constant_count;
+    uint64_t last_used;                // Store clock at the last hit or insert
+    checksum_solution_t* solutions;
+    size_t solution_count;
+} memo_region_t;
+
+typedef struct {
+    memo_region_t* regions;
+    size_t region_count;
+    uint64_t clock;                    // Advances on every hit or insert
+    size_t budget_bytes;               // File size the store is kept under
+    char* path;
+} memo_store_t;
+
+// Store file: $CADS_MEMO_FILE, else $XDG_CACHE_HOME/cads/memo.bin, else
+// $HOME/.cache/cads/memo.bin. Writes at most size bytes; false when no location is known.
+bool default_memo_path(char* path, size_t size);
+
+// Load the store at path, to be kept under budget_bytes. A missing, foreign or damaged
+// file gives an empty store; NULL only on allocation failure.
+memo_store_t* open_memo_store(const char* path, size_t budget_bytes);
+void free_memo_store(memo_store_t* store);
+
+// Write the store back (through a temporary file, then rename), evicting least recently
+// used regions beyond the budget or MEMO_STORE_MAX_REGIONS.
+bool save_memo_store(memo_store_t* store);
+
+// keys[n] hashes the first n packets and the settings that change which chains match;
+// keys holds dataset->count + 1 entries
+void memo_prefix_keys(const config_t* config, uint64_t* keys);
+
+// Region searched over the first n of packet_count packets (keys from memo_prefix_keys),
+// covering field sets of field_count fields with at least constant_count constants, that
+// shares the most ops with operations, or NULL. Marks it used.
+const memo_region_t* find_memo_region(memo_store_t* store, const uint64_t* keys, size_t packet_count,
+                                      uint32_t operations, int field_count, int constant_count);
+
+// Add a region over packet_count packets, dropping the regions it covers entirely,
+// including those searched over fewer of the same packets. Copies the solutions. A region
+// larger than the whole budget is refused and leaves the store as it was.
+bool record_memo_region(memo_store_t* store, const uint64_t* keys, size_t packet_count, uint32_t operations,
+                        int max_fields, int constant_count, const checksum_solution_t* solutions,
+                        size_t solution_count);
+
+#endif // MEMO_STORE_H
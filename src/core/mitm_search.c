@@ -0,0 +1,470 @@
+// Meet-in-the-middle search for fixed-depth operation chains.
+//
+// A chain of depth D is split into a forward prefix of k = ceil(D/2) operations and a
+// backward suffix of D - k operations. Forward prefixes are evaluated from the first
+// field and stored in a hash table keyed on (field cursor, masked per-packet values).
+// Backward suffixes start from each packet's expected checksum and apply registry
+// inverses, consuming fields from the end of the permutation. A backward vector that
+// matches a forward entry joins into a full chain, which is then confirmed with the
+// canonical evaluator. Only operations with an inverse can appear in the suffix, and
+// chains that run out of fields are skipped (they equal a shorter chain).
+
+#include "checksum_engine.h"
+#include "../../include/algorithm_registry.h"
+#include "../../include/sequence_evaluator.h"
+#include "../utils/field_combiner.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define MITM_MAX_TABLE_ENTRIES (1u << 26)
+#define MITM_END UINT32_MAX
+
+void print_found_solutions(const search_results_t* results, const algorithm_registry_entry_t* algorithms, int algorithm_count);
+
+typedef struct {
+    uint8_t fields[CADS_MAX_FIELDS];
+    int field_count;
+} mitm_permutation_t;
+
+typedef struct {
+    uint64_t fingerprint;
+    uint32_t next;                     // Next entry in the bucket chain, MITM_END terminates
+    uint8_t cursor;
+} mitm_entry_t;
+
+// Forward prefix table for one (permutation, constant) context
+typedef struct {
+    mitm_entry_t* entries;
+    uint8_t* ops;                      // forward_depth algorithm indices per entry
+    uint32_t* buckets;
+    size_t capacity;
+    size_t bucket_mask;
+    size_t count;
+    int forward_depth;
+} mitm_table_t;
+
+typedef struct {
+    const config_t* config;
+    const algorithm_registry_entry_t* algorithms;
+    int algorithm_count;
+    const int* inverse_indices;        // Algorithms usable in the backward suffix
+    int inverse_count;
+    int forward_depth;
+    int backward_depth;
+    const mitm_permutation_t* permutations;
+    size_t permutation_count;
+    size_t* next_permutation;
+    pthread_mutex_t* work_mutex;
+    search_results_t* results;
+    pthread_mutex_t* results_mutex;
+    volatile bool* stop;
+
+    // Per-thread state
+    mitm_table_t table;
+    const mitm_permutation_t* permutation;
+    uint64_t* field_values;
+    uint64_t* expected;
+    chain_state_t forward[CADS_MAX_CHAIN_DEPTH + 1];
+    uint64_t* backward;                // (backward_depth + 1) x packet_count
+    size_t packet_count;
+    uint64_t mask;
+    uint8_t constant;
+    uint64_t tests;
+    uint64_t joins;
+} mitm_worker_t;
+
+static uint64_t fingerprint_values(const uint64_t* values, size_t packet_count, uint64_t mask, int cursor) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ (uint64_t)cursor;
+    for (size_t p = 0; p < packet_count; p++) {
+        h ^= values[p] & mask;
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    return h;
+}
+
+static bool create_mitm_table(mitm_table_t* table, size_t capacity, int forward_depth) {
+    size_t buckets = 1;
+    while (buckets < capacity * 2) buckets <<= 1;
+    table->entries = malloc(capacity * sizeof(mitm_entry_t));
+    table->ops = malloc(capacity * (size_t)forward_depth);
+    table->buckets = malloc(buckets * sizeof(uint32_t));
+    table->capacity = capacity;
+    table->bucket_mask = buckets - 1;
+    table->count = 0;
+    table->forward_depth = forward_depth;
+    return table->entries && table->ops && table->buckets;
+}
+
+static void free_mitm_table(mitm_table_t* table) {
+    free(table->entries);
+    free(table->ops);
+    free(table->buckets);
+}
+
+static size_t mitm_table_memory(const mitm_table_t* table) {
+    return table->capacity * (sizeof(mitm_entry_t) + (size_t)table->forward_depth) +
+           (table->bucket_mask + 1) * sizeof(uint32_t);
+}
+
+static void reset_mitm_table(mitm_table_t* table) {
+    memset(table->buckets, 0xFF, (table->bucket_mask + 1) * sizeof(uint32_t));
+    table->count = 0;
+}
+
+static void record_mitm_solution(mitm_worker_t* w, const operation_t* sequence, int depth) {
+    checksum_solution_t solution = {0};
+    for (int f = 0; f < w->permutation->field_count; f++) {
+        solution.field_indices[f] = w->permutation->fields[f];
+    }
+    solution.field_count = w->permutation->field_count;
+    for (int op = 0; op < depth; op++) {
+        solution.operations[op] = sequence[op];
+    }
+    solution.operation_count = depth;
+    solution.constant = w->constant;
+    solution.checksum_size = w->config->checksum_size;
+    solution.validated = true;
+
+    pthread_mutex_lock(w->results_mutex);
+    add_solution(w->results, &solution);
+    if (!should_continue_search(w->results, w->config)) {
+        *w->stop = true;
+        w->results->early_exit_triggered = true;
+    }
+    pthread_mutex_unlock(w->results_mutex);
+}
+
+static void mitm_forward(mitm_worker_t* w, int depth, uint8_t* prefix) {
+    const chain_state_t* state = &w->forward[depth];
+    if (depth == w->forward_depth) {
+        mitm_table_t* table = &w->table;
+        uint64_t fp = fingerprint_values(state->values, w->packet_count, w->mask, state->field_cursor);
+        size_t bucket = (size_t)(fp ^ (fp >> 32)) & table->bucket_mask;
+        mitm_entry_t* entry = &table->entries[table->count];
+        entry->fingerprint = fp;
+        entry->cursor = (uint8_t)state->field_cursor;
+        entry->next = table->buckets[bucket];
+        memcpy(&table->ops[table->count * (size_t)w->forward_depth], prefix, (size_t)w->forward_depth);
+        table->buckets[bucket] = (uint32_t)table->count++;
+        return;
+    }
+
+    int field_count = w->permutation->field_count;
+    for (int a = 0; a < w->algorithm_count; a++) {
+        const algorithm_registry_entry_t* algorithm = &w->algorithms[a];
+        if (get_operation_operand_kind(algorithm->op) == OPERAND_FIELD && state->field_cursor >= field_count) {
+            continue; // Would halt the chain
+        }
+        advance_chain_state(state, &w->forward[depth + 1], algorithm, w->field_values,
+                            field_count, w->packet_count, w->constant);
+        w->tests++;
+        prefix[depth] = (uint8_t)a;
+        mitm_forward(w, depth + 1, prefix);
+    }
+}
+
+static void mitm_join(mitm_worker_t* w, const uint64_t* values, int cursor, const uint8_t* suffix) {
+    mitm_table_t* table = &w->table;
+    uint64_t fp = fingerprint_values(values, w->packet_count, w->mask, cursor);
+    size_t bucket = (size_t)(fp ^ (fp >> 32)) & table->bucket_mask;
+    int depth = w->forward_depth + w->backward_depth;
+
+    for (uint32_t e = table->buckets[bucket]; e != MITM_END; e = table->entries[e].next) {
+        const mitm_entry_t* entry = &table->entries[e];
+        if (entry->fingerprint != fp || entry->cursor != cursor) continue;
+
+        operation_t sequence[CADS_MAX_CHAIN_DEPTH];
+        const uint8_t* prefix = &table->ops[(size_t)e * (size_t)w->forward_depth];
+        for (int i = 0; i < w->forward_depth; i++) sequence[i] = w->algorithms[prefix[i]].op;
+        for (int i = 0; i < w->backward_depth; i++) sequence[w->forward_depth + i] = w->algorithms[suffix[i]].op;
+
+        w->joins++;
+        if (evaluate_operation_sequence(w->config->dataset, w->config, w->permutation->fields,
+                                        w->permutation->field_count, sequence, depth, w->constant)) {
+            record_mitm_solution(w, sequence, depth);
+            if (*w->stop) return;
+        }
+    }
+}
+
+// Peel suffix operations off the expected checksums, last operation first.
+// cursor is the field cursor after the operations not yet peeled.
+static void mitm_backward(mitm_worker_t* w, int level, int cursor, uint8_t* suffix) {
+    const uint64_t* values = &w->backward[(size_t)level * w->packet_count];
+    if (level == w->backward_depth) {
+        mitm_join(w, values, cursor, suffix);
+        return;
+    }
+
+    uint64_t* preimage = &w->backward[(size_t)(level + 1) * w->packet_count];
+    for (int i = 0; i < w->inverse_count && !*w->stop; i++) {
+        int a = w->inverse_indices[i];
+        const algorithm_registry_entry_t* algorithm = &w->algorithms[a];
+        operand_kind_t kind = get_operation_operand_kind(algorithm->op);
+        const uint64_t* operand = NULL;
+        int previous_cursor = cursor;
+        if (kind == OPERAND_FIELD) {
+            if (cursor <= 1) continue; // Field 0 seeds the chain and cannot be consumed
+            previous_cursor = cursor - 1;
+            operand = &w->field_values[(size_t)previous_cursor * w->packet_count];
+        }
+        uint64_t c = (kind == OPERAND_CONSTANT) ? w->constant : 0;
+
+        bool invertible = true;
+        for (size_t p = 0; p < w->packet_count && invertible; p++) {
+            invertible = algorithm->inverse(values[p], operand ? operand[p] : 0, c, w->mask, &preimage[p]);
+        }
+        w->tests++;
+        if (!invertible) continue;
+
+        suffix[w->backward_depth - 1 - level] = (uint8_t)a;
+        mitm_backward(w, level + 1, previous_cursor, suffix);
+    }
+}
+
+static void* mitm_worker_thread(void* arg) {
+    mitm_worker_t* w = (mitm_worker_t*)arg;
+    uint8_t prefix[CADS_MAX_CHAIN_DEPTH];
+    uint8_t suffix[CADS_MAX_CHAIN_DEPTH];
+
+    while (!*w->stop) {
+        pthread_mutex_lock(w->work_mutex);
+        size_t index = (*w->next_permutation)++;
+        pthread_mutex_unlock(w->work_mutex);
+        if (index >= w->permutation_count) break;
+
+        w->permutation = &w->permutations[index];
+        int field_count = w->permutation->field_count;
+        extract_permutation_field_values(w->config->dataset, w->permutation->fields, field_count,
+                                         w->config->checksum_size, w->field_values);
+        init_chain_state(&w->forward[0], w->field_values, w->packet_count);
+
+        for (int constant = 0; constant < w->config->max_constants && !*w->stop; constant++) {
+            w->constant = (uint8_t)constant;
+            reset_mitm_table(&w->table);
+            mitm_forward(w, 0, prefix);
+
+            // Every end cursor: the chain may leave trailing fields unused
+            for (int end_cursor = 1; end_cursor <= field_count && !*w->stop; end_cursor++) {
+                memcpy(w->backward, w->expected, w->packet_count * sizeof(uint64_t));
+                mitm_backward(w, 0, end_cursor, suffix);
+            }
+        }
+    }
+    return NULL;
+}
+
+static mitm_permutation_t* collect_permutations(const config_t* config, size_t* count) {
+    size_t min_packet_length = SIZE_MAX;
+    for (size_t i = 0; i < config->dataset->count; i++) {
+        if (config->dataset->packets[i].packet_length < min_packet_length) {
+            min_packet_length = config->dataset->packets[i].packet_length;
+        }
+    }
+    if (min_packet_length > 63) min_packet_length = 63;
+
+    size_t capacity = 64;
+    mitm_permutation_t* permutations = malloc(capacity * sizeof(mitm_permutation_t));
+    *count = 0;
+    if (!permutations) return NULL;
+
+    // Same field order as the exhaustive engine: by field count, then mask, then permutation
+    for (int level = 1; level <= config->max_fields; level++) {
+        uint64_t max_mask = (1ULL << min_packet_length) - 1;
+        for (uint64_t field_mask = 1; field_mask <= max_mask; field_mask++) {
+            if (__builtin_popcountll(field_mask) != level) continue;
+            uint8_t fields[CADS_MAX_FIELDS];
+            int field_count = 0;
+            for (size_t i = 0; i < min_packet_length && field_count < CADS_MAX_FIELDS; i++) {
+                if (field_mask & (1ULL << i)) fields[field_count++] = (uint8_t)i;
+            }
+
+            uint8_t generated[24][CADS_MAX_FIELDS];
+            uint32_t perm_count = 0;
+            generate_all_permutations(fields, field_count, generated, &perm_count);
+            for (uint32_t p = 0; p < perm_count; p++) {
+                if (*count == capacity) {
+                    capacity *= 2;
+                    mitm_permutation_t* grown = realloc(permutations, capacity * sizeof(mitm_permutation_t));
+                    if (!grown) {
+                        free(permutations);
+                        return NULL;
+                    }
+                    permutations = grown;
+                }
+                memcpy(permutations[*count].fields, generated[p], CADS_MAX_FIELDS);
+                permutations[*count].field_count = field_count;
+                (*count)++;
+            }
+        }
+    }
+    return permutations;
+}
+
+bool execute_mitm_checksum_search(const config_t* config, search_results_t* results) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) {
+        return false;
+    }
+    if (config->mitm_depth < 2 || config->mitm_depth > CADS_MAX_CHAIN_DEPTH) {
+        fprintf(stderr, "❌ Error: mitm_depth must be between 2 and %d (got %d)\n",
+                CADS_MAX_CHAIN_DEPTH, config->mitm_depth);
+        return false;
+    }
+    if (!initialize_algorithm_registry()) {
+        return false;
+    }
+
+    int algorithm_count;
+    algorithm_registry_entry_t algorithms[32];
+    if (!select_search_algorithms(config, algorithms, &algorithm_count)) {
+        cleanup_algorithm_registry();
+        return false;
+    }
+    prepare_operation_tables(config, algorithms, algorithm_count);
+
+    size_t packet_count = config->dataset->count;
+    uint64_t mask = mask_checksum_to_size(UINT64_MAX, config->checksum_size);
+    int inverse_indices[32];
+    int inverse_count = 0;
+    for (int a = 0; a < algorithm_count; a++) {
+        uint64_t probe;
+        if (algorithms[a].inverse && algorithms[a].inverse(0, 0, 0, mask, &probe)) {
+            inverse_indices[inverse_count++] = a;
+        }
+    }
+
+    int backward_depth = config->mitm_depth / 2;
+    int forward_depth = config->mitm_depth - backward_depth;
+    size_t table_capacity = 1;
+    for (int d = 0; d < forward_depth; d++) {
+        table_capacity *= (size_t)algorithm_count;
+        if (table_capacity > MITM_MAX_TABLE_ENTRIES) {
+            fprintf(stderr, "❌ Error: mitm_depth %d needs more than %u forward entries; lower the depth or operation count\n",
+                    config->mitm_depth, MITM_MAX_TABLE_ENTRIES);
+            cleanup_algorithm_registry();
+            return false;
+        }
+    }
+
+    bool sizes_match = true;
+    for (size_t p = 0; p < packet_count; p++) {
+        if (config->dataset->packets[p].checksum_size != config->checksum_size) sizes_match = false;
+    }
+
+    size_t permutation_count = 0;
+    mitm_permutation_t* permutations = collect_permutations(config, &permutation_count);
+    if (!permutations) {
+        cleanup_algorithm_registry();
+        return false;
+    }
+    if (!sizes_match) permutation_count = 0; // Mixed checksum sizes never validate
+
+    int thread_count = config->threads > 1 ? config->threads
+                     : config->threads == 0 ? (int)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    if ((size_t)thread_count > permutation_count) thread_count = permutation_count > 0 ? (int)permutation_count : 1;
+
+    if (config->verbose) {
+        printf("🔀 Meet-in-the-middle search: depth %d (%d forward x %d backward)\n",
+               config->mitm_depth, forward_depth, backward_depth);
+        printf("   Forward operations: %d, invertible backward operations: %d\n", algorithm_count, inverse_count);
+        printf("   Field permutations: %zu, constants: %d, threads: %d\n",
+               permutation_count, config->max_constants, thread_count);
+    }
+
+    mitm_worker_t* workers = calloc((size_t)thread_count, sizeof(mitm_worker_t));
+    pthread_t* threads = malloc((size_t)thread_count * sizeof(pthread_t));
+    pthread_mutex_t work_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t results_mutex = PTHREAD_MUTEX_INITIALIZER;
+    size_t next_permutation = 0;
+    volatile bool stop = false;
+    bool ok = workers && threads;
+
+    for (int t = 0; ok && t < thread_count; t++) {
+        mitm_worker_t* w = &workers[t];
+        *w = (mitm_worker_t) {
+            .config = config,
+            .algorithms = algorithms,
+            .algorithm_count = algorithm_count,
+            .inverse_indices = inverse_indices,
+            .inverse_count = inverse_count,
+            .forward_depth = forward_depth,
+            .backward_depth = backward_depth,
+            .permutations = permutations,
+            .permutation_count = permutation_count,
+            .next_permutation = &next_permutation,
+            .work_mutex = &work_mutex,
+            .results = results,
+            .results_mutex = &results_mutex,
+            .stop = &stop,
+            .packet_count = packet_count,
+            .mask = mask
+        };
+        w->field_values = malloc((size_t)CADS_MAX_FIELDS * packet_count * sizeof(uint64_t));
+        w->expected = malloc(packet_count * sizeof(uint64_t));
+        w->backward = malloc((size_t)(backward_depth + 1) * packet_count * sizeof(uint64_t));
+        uint64_t* forward_values = malloc((size_t)(forward_depth + 1) * packet_count * sizeof(uint64_t));
+        w->forward[0].values = forward_values;
+        if (!create_mitm_table(&w->table, table_capacity, forward_depth) ||
+            !w->field_values || !w->expected || !w->backward || !forward_values) {
+            ok = false;
+            break;
+        }
+        for (int d = 0; d <= forward_depth; d++) {
+            w->forward[d].values = &forward_values[(size_t)d * packet_count];
+        }
+        for (size_t p = 0; p < packet_count; p++) {
+            w->expected[p] = mask_checksum_to_size(config->dataset->packets[p].expected_checksum, config->checksum_size);
+        }
+        results->mitm_table_bytes += mitm_table_memory(&w->table);
+    }
+
+    int started = 0;
+    if (ok) {
+        for (; started < thread_count; started++) {
+            if (pthread_create(&threads[started], NULL, mitm_worker_thread, &workers[started]) != 0) {
+                stop = true;
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    uint64_t joins = 0;
+    for (int t = 0; workers && t < thread_count; t++) {
+        results->tests_performed += workers[t].tests;
+        joins += workers[t].joins;
+        free_mitm_table(&workers[t].table);
+        free(workers[t].forward[0].values);
+        free(workers[t].field_values);
+        free(workers[t].expected);
+        free(workers[t].backward);
+    }
+    results->search_completed = ok && !stop;
+
+    if (ok && config->verbose) {
+        printf("   Chain evaluations: %llu, table joins verified: %llu\n",
+               (unsigned long long)results->tests_performed, (unsigned long long)joins);
+        printf("   Forward table memory: %.1f MB (%zu entries per thread)\n",
+               results->mitm_table_bytes / (1024.0 * 1024.0), table_capacity);
+    }
+
+    if (ok && results->solution_count > 0) {
+        sort_search_solutions(results);
+        print_found_solutions(results, algorithms, algorithm_count);
+    }
+
+    free(workers);
+    free(threads);
+    free(permutations);
+    pthread_mutex_destroy(&work_mutex);
+    pthread_mutex_destroy(&results_mutex);
+    cleanup_algorithm_registry();
+    return ok;
+}
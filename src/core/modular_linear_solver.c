@@ -0,0 +1,329 @@
+#include "modular_linear_solver.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// 2-adic valuation of x modulo 2^bits; zero counts as bits (i.e. "infinite")
+static int valuation(uint64_t x, int bits) {
+    if (x == 0) return bits;
+    int v = 0;
+    while (!(x & 1)) {
+        x >>= 1;
+        v++;
+    }
+    return v < bits ? v : bits;
+}
+
+// Inverse of an odd number modulo 2^64 by Newton iteration (each step doubles the precision)
+static uint64_t odd_inverse(uint64_t u) {
+    uint64_t x = u;
+    for (int i = 0; i < 5; i++) x *= 2 - u * x;
+    return x;
+}
+
+modular_linear_result_t* solve_modular_linear(const packet_dataset_t* dataset, size_t checksum_size) {
+    if (!dataset || dataset->count == 0 || checksum_size < 1 || checksum_size > CADS_MAX_CHECKSUM_SIZE) {
+        return NULL;
+    }
+
+    size_t used = 0;
+    size_t length = most_common_length(dataset, &used);
+    int bits = (int)checksum_size * 8;
+    uint64_t mask = bits == 64 ? UINT64_MAX : ((1ULL << bits) - 1);
+
+    modular_linear_result_t* result = calloc(1, sizeof(modular_linear_result_t));
+    if (!result) return NULL;
+    result->packet_length = length;
+    result->packets_used = used;
+    result->packets_skipped = dataset->count - used;
+    result->modulus_bits = bits;
+    result->weights = calloc(length ? length : 1, sizeof(uint64_t));
+    result->determined_bits = calloc(length ? length : 1, sizeof(int));
+    result->constant_bytes = calloc(length ? length : 1, sizeof(bool));
+
+    const test_packet_t** rows = malloc(used * sizeof(test_packet_t*));
+    size_t* active = malloc((length ? length : 1) * sizeof(size_t));
+    if (!result->weights || !result->determined_bits || !result->constant_bytes || !rows || !active) {
+        free(rows);
+        free(active);
+        free_modular_linear_result(result);
+        return NULL;
+    }
+    size_t m = 0;
+    for (size_t i = 0; i < dataset->count; i++) {
+        if (dataset->packets[i].packet_length == length) rows[m++] = &dataset->packets[i];
+    }
+
+    // Bytes that never change are indistinguishable from the constant c
+    size_t v = 0;
+    for (size_t byte = 0; byte < length; byte++) {
+        result->constant_bytes[byte] = true;
+        for (size_t r = 1; r < m; r++) {
+            if (rows[r]->packet_data[byte] != rows[0]->packet_data[byte]) {
+                result->constant_bytes[byte] = false;
+                active[v++] = byte;
+                break;
+            }
+        }
+        if (result->constant_bytes[byte]) result->determined_bits[byte] = bits;
+    }
+
+    // Columns: v active bytes, then the constant. V tracks the column operations.
+    size_t n = v + 1;
+    uint64_t* a = malloc(m * n * sizeof(uint64_t));
+    uint64_t* y = malloc(m * sizeof(uint64_t));
+    uint64_t* cols = calloc(n * n, sizeof(uint64_t));
+    int* invariant = malloc(n * sizeof(int));
+    if (!a || !y || !cols || !invariant) {
+        free(a);
+        free(y);
+        free(cols);
+        free(invariant);
+        free(rows);
+        free(active);
+        free_modular_linear_result(result);
+        return NULL;
+    }
+    for (size_t r = 0; r < m; r++) {
+        for (size_t j = 0; j < v; j++) a[r * n + j] = rows[r]->packet_data[active[j]];
+        a[r * n + v] = 1;
+        y[r] = rows[r]->expected_checksum & mask;
+    }
+    for (size_t j = 0; j < n; j++) cols[j * n + j] = 1;
+
+    // Smith normal form: Z/2^N is a local ring, so the entry of least 2-adic valuation
+    // divides every other entry and can clear its whole row and column
+    size_t rank = 0;
+    while (rank < n && rank < m) {
+        size_t pr = rank, pc = rank;
+        int best = bits;
+        for (size_t r = rank; r < m && best > 0; r++) {
+            for (size_t j = rank; j < n; j++) {
+                int val = valuation(a[r * n + j], bits);
+                if (val < best) {
+                    best = val;
+                    pr = r;
+                    pc = j;
+                    if (val == 0) break;
+                }
+            }
+        }
+        if (best == bits) break;
+
+        if (pr != rank) {
+            for (size_t j = 0; j < n; j++) {
+                uint64_t t = a[pr * n + j];
+                a[pr * n + j] = a[rank * n + j];
+                a[rank * n + j] = t;
+            }
+            uint64_t t = y[pr];
+            y[pr] = y[rank];
+            y[rank] = t;
+        }
+        if (pc != rank) {
+            for (size_t r = 0; r < m; r++) {
+                uint64_t t = a[r * n + pc];
+                a[r * n + pc] = a[r * n + rank];
+                a[r * n + rank] = t;
+            }
+            for (size_t i = 0; i < n; i++) {
+                uint64_t t = cols[i * n + pc];
+                cols[i * n + pc] = cols[i * n + rank];
+                cols[i * n + rank] = t;
+            }
+        }
+
+        // Scale the pivot row so the pivot is exactly 2^best
+        uint64_t* pivot = &a[rank * n];
+        uint64_t unit_inverse = odd_inverse(pivot[rank] >> best);
+        for (size_t j = rank; j < n; j++) pivot[j] = (pivot[j] * unit_inverse) & mask;
+        y[rank] = (y[rank] * unit_inverse) & mask;
+
+        for (size_t r = 0; r < m; r++) {
+            if (r == rank || a[r * n + rank] == 0) continue;
+            uint64_t q = a[r * n + rank] >> best;
+            for (size_t j = rank; j < n; j++) a[r * n + j] = (a[r * n + j] - q * pivot[j]) & mask;
+            y[r] = (y[r] - q * y[rank]) & mask;
+        }
+        for (size_t j = rank + 1; j < n; j++) {
+            if (pivot[j] == 0) continue;
+            uint64_t q = pivot[j] >> best;
+            pivot[j] = 0;
+            for (size_t i = 0; i < n; i++) cols[i * n + j] = (cols[i * n + j] - q * cols[i * n + rank]) & mask;
+        }
+        invariant[rank++] = best;
+    }
+    result->rank = (int)rank;
+
+    // Diagonal system 2^k_i * z_i = y_i: solvable iff every y_i is divisible by 2^k_i
+    // and the rows past the rank read 0 = 0
+    result->consistent = true;
+    for (size_t r = 0; r < m; r++) {
+        uint64_t low = r < rank ? y[r] & ((1ULL << invariant[r]) - 1) : y[r];
+        if (low != 0) result->consistent = false;
+    }
+
+    // Particular solution x = V z with the free parts of z set to zero
+    uint64_t* x = calloc(n, sizeof(uint64_t));
+    uint64_t* gens = malloc(n * (length + 1) * sizeof(uint64_t));
+    if (x && gens) {
+        for (size_t i = 0; i < rank; i++) {
+            uint64_t z = y[i] >> invariant[i];
+            for (size_t j = 0; j < n; j++) x[j] = (x[j] + cols[j * n + i] * z) & mask;
+        }
+        for (size_t j = 0; j < v; j++) result->weights[active[j]] = x[j];
+        result->offset = x[v];
+        // Constant bytes carry weight 0; their contribution lives in the offset
+
+        // Lattice generators: 2^(N - k_i) * V_i for each partial invariant, V_j for each
+        // zero invariant. Expressed over all bytes plus the offset.
+        result->solution_log2 = 0;
+        for (size_t i = 0; i < n; i++) {
+            int k = i < rank ? invariant[i] : bits;
+            if (k == 0) continue;
+            result->solution_log2 += k;
+            uint64_t scale = k == bits ? 1 : (1ULL << (bits - k));
+            uint64_t* g = &gens[(size_t)result->generator_count++ * (length + 1)];
+            memset(g, 0, (length + 1) * sizeof(uint64_t));
+            for (size_t j = 0; j < v; j++) g[active[j]] = (cols[j * n + i] * scale) & mask;
+            g[length] = (cols[v * n + i] * scale) & mask;
+        }
+        result->generators = gens;
+        gens = NULL;
+
+        for (size_t j = 0; j < v; j++) result->determined_bits[active[j]] = bits;
+        result->offset_determined_bits = bits;
+        for (int g = 0; g < result->generator_count; g++) {
+            const uint64_t* gen = &result->generators[(size_t)g * (length + 1)];
+            for (size_t j = 0; j < v; j++) {
+                int val = valuation(gen[active[j]], bits);
+                if (val < result->determined_bits[active[j]]) result->determined_bits[active[j]] = val;
+            }
+            int val = valuation(gen[length], bits);
+            if (val < result->offset_determined_bits) result->offset_determined_bits = val;
+        }
+    }
+
+    free(x);
+    free(gens);
+    free(a);
+    free(y);
+    free(cols);
+    free(invariant);
+    free(rows);
+    free(active);
+    return result;
+}
+
+void free_modular_linear_result(modular_linear_result_t* result) {
+    if (!result) return;
+    free(result->weights);
+    free(result->determined_bits);
+    free(result->constant_bytes);
+    free(result->generators);
+    free(result);
+}
+
+bool modular_linear_to_solution(const modular_linear_result_t* result, checksum_solution_t* solution) {
+    if (!result || !result->consistent || result->modulus_bits != 8 || result->solution_log2 != 0) return false;
+
+    // Fields with weight +1 first so the chain can start from one of them
+    memset(solution, 0, sizeof(*solution));
+    int negative = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        uint64_t wanted = pass == 0 ? 0x01 : 0xFF;
+        for (size_t byte = 0; byte < result->packet_length; byte++) {
+            uint64_t w = result->weights[byte];
+            if (w == 0) continue;
+            if (w != 0x01 && w != 0xFF) return false;
+            if (w != wanted) continue;
+            if (solution->field_count >= CADS_MAX_FIELDS) return false;
+            solution->field_indices[solution->field_count++] = (uint8_t)byte;
+            if (pass == 1) negative++;
+        }
+    }
+    if (solution->field_count == 0 || negative == solution->field_count) return false;
+
+    for (int f = 1; f < solution->field_count; f++) {
+        solution->operations[solution->operation_count++] = f < solution->field_count - negative ? OP_ADD : OP_SUB;
+    }
+    if (result->offset != 0) {
+        solution->operations[solution->operation_count++] = OP_CONST_ADD;
+    }
+    solution->constant = result->offset;
+    solution->checksum_size = 1;
+    return true;
+}
+
+static void print_term(uint64_t w, const char* name, int bits, bool* any) {
+    uint64_t half = 1ULL << (bits - 1);
+    bool minus = w >= half;
+    uint64_t magnitude = minus ? ((~w + 1) & (bits == 64 ? UINT64_MAX : ((1ULL << bits) - 1))) : w;
+    printf("%s ", minus ? " -" : (*any ? " +" : ""));
+    if (magnitude != 1) printf("%llu*", (unsigned long long)magnitude);
+    printf("%s", name);
+    *any = true;
+}
+
+void print_modular_linear_result(const modular_linear_result_t* result, bool verbose) {
+    if (!result) return;
+    printf("➗ Z/2^%d weighted-sum pre-phase: %zu packets of %zu bytes", result->modulus_bits,
+           result->packets_used, result->packet_length);
+    if (result->packets_skipped > 0) printf(" (%zu of other lengths skipped)", result->packets_skipped);
+    printf(", rank %d\n", result->rank);
+
+    if (!result->consistent) {
+        printf("   ❌ Not a weighted byte sum modulo 2^%d\n", result->modulus_bits);
+        return;
+    }
+
+    size_t redundant = result->packets_used - (size_t)result->rank;
+    printf("   checksum =");
+    bool any = false;
+    char name[24];
+    for (size_t byte = 0; byte < result->packet_length; byte++) {
+        if (result->weights[byte] == 0) continue;
+        snprintf(name, sizeof(name), "b%zu", byte);
+        print_term(result->weights[byte], name, result->modulus_bits, &any);
+    }
+    printf(" %s0x%llX (mod 2^%d)\n", any ? "+ " : "", (unsigned long long)result->offset, result->modulus_bits);
+    if (redundant == 0) {
+        printf("   ⚠️  Consistent, but no redundant packets: any checksum would fit\n");
+    } else {
+        printf("   ✅ Consistent weighted sum, confirmed by %zu redundant packet(s)\n", redundant);
+    }
+
+    if (result->solution_log2 == 0) {
+        printf("   Unique solution\n");
+        return;
+    }
+    printf("   Solution lattice: 2^%d solutions spanned by %d generator(s)\n", result->solution_log2,
+           result->generator_count);
+    bool header = false;
+    for (size_t byte = 0; byte < result->packet_length; byte++) {
+        int k = result->determined_bits[byte];
+        if (k >= result->modulus_bits || result->constant_bytes[byte]) continue;
+        if (!header) printf("   Partially fixed weights:");
+        printf(" b%zu (mod 2^%d)", byte, k);
+        header = true;
+    }
+    if (header) printf("\n");
+
+    if (verbose) {
+        for (int g = 0; g < result->generator_count; g++) {
+            const uint64_t* gen = &result->generators[(size_t)g * (result->packet_length + 1)];
+            printf("   g%-2d =", g);
+            any = false;
+            for (size_t byte = 0; byte <= result->packet_length; byte++) {
+                if (gen[byte] == 0) continue;
+                if (byte == result->packet_length) {
+                    snprintf(name, sizeof(name), "c");
+                } else {
+                    snprintf(name, sizeof(name), "b%zu", byte);
+                }
+                print_term(gen[byte], name, result->modulus_bits, &any);
+            }
+            printf("%s\n", any ? "" : " 0");
+        }
+    }
+}
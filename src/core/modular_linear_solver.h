@@ -0,0 +1,40 @@
+#ifndef MODULAR_LINEAR_SOLVER_H
+#define MODULAR_LINEAR_SOLVER_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Weighted-sum model over Z/2^N (N = 8 * checksum_size):
+//   checksum = sum(w_i * byte_i) + c  (mod 2^N)
+// Plain byte sums, position-weighted sums and Fletcher-style second sums all fit. The
+// system is brought to Smith normal form with unimodular row/column operations, which
+// yields every consistent (w, c) as a particular solution plus a lattice of generators.
+
+typedef struct {
+    bool consistent;
+    size_t packet_length;              // Frame length solved for (most common length)
+    size_t packets_used;
+    size_t packets_skipped;            // Packets of another length
+    int modulus_bits;                  // N
+    int rank;                          // Non-zero Smith invariants
+    int solution_log2;                 // log2 of the number of (w, c) solutions
+    uint64_t* weights;                 // Particular solution, one weight per byte
+    uint64_t offset;                   // Particular solution constant c
+    int* determined_bits;              // Per byte: weight fixed modulo 2^k (k == N: unique)
+    int offset_determined_bits;
+    bool* constant_bytes;              // Same value in every packet; folded into c
+    int generator_count;
+    uint64_t* generators;              // generator_count x (packet_length + 1); last entry is c
+} modular_linear_result_t;
+
+// Returns NULL on allocation failure or an empty dataset
+modular_linear_result_t* solve_modular_linear(const packet_dataset_t* dataset, size_t checksum_size);
+void free_modular_linear_result(modular_linear_result_t* result);
+
+// Express a unique 1-byte solution with weights of +1/-1 as an ADD/SUB/C+ operation chain.
+// Returns false for any other shape.
+bool modular_linear_to_solution(const modular_linear_result_t* result, checksum_solution_t* solution);
+
+void print_modular_linear_result(const modular_linear_result_t* result, bool verbose);
+
+#endif // MODULAR_LINEAR_SOLVER_H
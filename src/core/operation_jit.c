@@ -0,0 +1,297 @@
+// x86-64 code generation for per-operation packet loops.
+//
+// The interpreter calls algorithm_func_t once per packet and op. A compiled kernel runs the
+// whole packet vector for one op with the op inlined, two packets per iteration and the
+// running values in registers. Prefix states use the advance kernel; leaves use the match
+// kernel, which folds the masked comparison in and stops at the first mismatching pair.
+//
+// Register use inside a kernel:
+//   rsi in, rdx operand, r8 constant, r9 packet index, rbx packet count (saved)
+//   rdi out (advance) or expected (match), r12 mask (match, saved)
+//   rax / r11 the two lanes; r10 and rcx are scratch (multiplier, shift count)
+
+#include "operation_jit.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+enum { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSI = 6, RDI = 7, R8 = 8, R9 = 9, R10 = 10, R11 = 11, R12 = 12 };
+
+#define JIT_KERNEL_MAX 512   // Upper bound on one kernel's size
+
+typedef struct {
+    uint8_t* code;
+    size_t length;
+} emitter_t;
+
+static uint8_t* jit_buffer = NULL;
+static size_t jit_buffer_size = 0;
+
+static void emit(emitter_t* e, uint8_t byte) { e->code[e->length++] = byte; }
+
+static void emit_u32(emitter_t* e, uint32_t value) {
+    for (int i = 0; i < 4; i++) emit(e, (uint8_t)(value >> (8 * i)));
+}
+
+// op r, [base + r9*8 + disp] (or the reverse direction, by opcode)
+static void emit_mem(emitter_t* e, uint8_t opcode, int reg, int base, int8_t disp) {
+    emit(e, (uint8_t)(0x48 | ((reg >> 3) << 2) | ((R9 >> 3) << 1) | (base >> 3)));
+    emit(e, opcode);
+    emit(e, (uint8_t)(0x44 | ((reg & 7) << 3)));          // mod=01 (disp8), rm=SIB
+    emit(e, (uint8_t)(0xC0 | ((R9 & 7) << 3) | (base & 7)));  // scale 8
+    emit(e, (uint8_t)disp);
+}
+
+// op rm, reg on two registers
+static void emit_rr(emitter_t* e, uint8_t opcode, int reg, int rm) {
+    emit(e, (uint8_t)(0x48 | ((reg >> 3) << 2) | (rm >> 3)));
+    emit(e, opcode);
+    emit(e, (uint8_t)(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+}
+
+// Group opcode with a /digit extension on one register
+static void emit_ext(emitter_t* e, uint8_t opcode, int digit, int rm) {
+    emit_rr(e, opcode, digit, rm);
+}
+
+static void emit_add_imm8(emitter_t* e, int rm, int8_t imm) {
+    emit_ext(e, 0x83, 0, rm);
+    emit(e, (uint8_t)imm);
+}
+
+static void emit_imul(emitter_t* e, int reg, int rm) {
+    emit(e, (uint8_t)(0x48 | ((reg >> 3) << 2) | (rm >> 3)));
+    emit(e, 0x0F);
+    emit(e, 0xAF);
+    emit(e, (uint8_t)(0xC0 | ((reg & 7) << 3) | (rm & 7)));
+}
+
+// Jumps are emitted with rel32 placeholders and patched once the target is known
+static size_t emit_jcc(emitter_t* e, uint8_t condition) {
+    emit(e, 0x0F);
+    emit(e, condition);
+    emit_u32(e, 0);
+    return e->length;
+}
+
+static size_t emit_jmp(emitter_t* e) {
+    emit(e, 0xE9);
+    emit_u32(e, 0);
+    return e->length;
+}
+
+static void patch(emitter_t* e, size_t jump_end, size_t target) {
+    uint32_t rel = (uint32_t)((int64_t)target - (int64_t)jump_end);
+    memcpy(&e->code[jump_end - 4], &rel, 4);
+}
+
+static void emit_jmp_back(emitter_t* e, size_t target) {
+    size_t end = emit_jmp(e);
+    patch(e, end, target);
+}
+
+#define JCC_JA  0x87
+#define JCC_JAE 0x83
+#define JCC_JNE 0x85
+
+static bool op_supported(operation_t op) {
+    switch (op) {
+        case OP_ADD: case OP_SUB: case OP_XOR: case OP_AND: case OP_OR: case OP_IDENTITY:
+        case OP_NOT: case OP_LSHIFT: case OP_RSHIFT: case OP_MUL: case OP_NEGATE:
+        case OP_CONST_ADD: case OP_CONST_XOR: case OP_CONST_SUB:
+        case OP_ONES_COMPLEMENT: case OP_TWOS_COMPLEMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// lane = op(lane, operand[r9 + disp/8], r8), matching the C implementations bit for bit
+static void emit_op(emitter_t* e, operation_t op, int lane, int8_t disp) {
+    switch (op) {
+        case OP_ADD: emit_mem(e, 0x03, lane, RDX, disp); break;
+        case OP_SUB: emit_mem(e, 0x2B, lane, RDX, disp); break;
+        case OP_XOR: emit_mem(e, 0x33, lane, RDX, disp); break;
+        case OP_AND: emit_mem(e, 0x23, lane, RDX, disp); break;
+        case OP_OR:  emit_mem(e, 0x0B, lane, RDX, disp); break;
+        case OP_IDENTITY: break;
+        case OP_NOT:
+        case OP_ONES_COMPLEMENT:  // ~(a + 0): the evaluator never passes a field to it
+            emit_ext(e, 0xF7, 2, lane);
+            break;
+        case OP_NEGATE: emit_ext(e, 0xF7, 3, lane); break;
+        case OP_TWOS_COMPLEMENT:
+            emit_mem(e, 0x03, lane, RDX, disp);
+            emit_ext(e, 0xF7, 3, lane);
+            break;
+        case OP_LSHIFT:
+        case OP_RSHIFT:           // The hardware masks the count to 6 bits, as the C does
+            emit_mem(e, 0x8B, RCX, RDX, disp);
+            emit_ext(e, 0xD3, op == OP_LSHIFT ? 4 : 5, lane);
+            break;
+        case OP_MUL: {            // a * (b ? b : 1)
+            emit_mem(e, 0x8B, R10, RDX, disp);
+            emit_rr(e, 0x85, R10, R10);
+            emit(e, 0x75);
+            emit(e, 7);
+            emit_ext(e, 0xC7, 0, R10);
+            emit_u32(e, 1);
+            emit_imul(e, lane, R10);
+            break;
+        }
+        case OP_CONST_ADD: emit_rr(e, 0x01, R8, lane); break;
+        case OP_CONST_XOR: emit_rr(e, 0x31, R8, lane); break;
+        case OP_CONST_SUB: emit_rr(e, 0x29, R8, lane); break;
+        default: break;
+    }
+}
+
+static void emit_lane(emitter_t* e, operation_t op, int lane, int8_t disp) {
+    emit_mem(e, 0x8B, lane, RSI, disp);
+    emit_op(e, op, lane, disp);
+}
+
+// Jump to the returned patch site when fewer than two packets remain
+static size_t emit_pair_check(emitter_t* e) {
+    emit_rr(e, 0x89, R9, R10);
+    emit_add_imm8(e, R10, 2);
+    emit_rr(e, 0x39, RBX, R10);
+    return emit_jcc(e, JCC_JA);
+}
+
+// void advance(out, in, operand, count, constant)
+static void emit_advance_kernel(emitter_t* e, operation_t op) {
+    emit(e, 0x53);                          // push rbx
+    emit_rr(e, 0x89, RCX, RBX);
+    emit_rr(e, 0x31, R9, R9);
+    size_t pair = e->length;
+    size_t to_single = emit_pair_check(e);
+    emit_lane(e, op, RAX, 0);
+    emit_lane(e, op, R11, 8);
+    emit_mem(e, 0x89, RAX, RDI, 0);
+    emit_mem(e, 0x89, R11, RDI, 8);
+    emit_add_imm8(e, R9, 2);
+    emit_jmp_back(e, pair);
+
+    patch(e, to_single, e->length);
+    emit_rr(e, 0x39, RBX, R9);
+    size_t to_done = emit_jcc(e, JCC_JAE);
+    emit_lane(e, op, RAX, 0);
+    emit_mem(e, 0x89, RAX, RDI, 0);
+
+    patch(e, to_done, e->length);
+    emit(e, 0x5B);                          // pop rbx
+    emit(e, 0xC3);
+}
+
+// bool match(expected, in, operand, count, constant, mask)
+static void emit_match_kernel(emitter_t* e, operation_t op) {
+    emit(e, 0x53);                          // push rbx
+    emit(e, 0x41);                          // push r12
+    emit(e, 0x54);
+    emit_rr(e, 0x89, RCX, RBX);
+    emit_rr(e, 0x89, R9, R12);
+    emit_rr(e, 0x31, R9, R9);
+    size_t pair = e->length;
+    size_t to_single = emit_pair_check(e);
+    emit_lane(e, op, RAX, 0);
+    emit_mem(e, 0x33, RAX, RDI, 0);
+    emit_lane(e, op, R11, 8);
+    emit_mem(e, 0x33, R11, RDI, 8);
+    emit_rr(e, 0x09, R11, RAX);
+    emit_rr(e, 0x85, R12, RAX);
+    size_t pair_fail = emit_jcc(e, JCC_JNE);
+    emit_add_imm8(e, R9, 2);
+    emit_jmp_back(e, pair);
+
+    patch(e, to_single, e->length);
+    emit_rr(e, 0x39, RBX, R9);
+    size_t to_ok = emit_jcc(e, JCC_JAE);
+    emit_lane(e, op, RAX, 0);
+    emit_mem(e, 0x33, RAX, RDI, 0);
+    emit_rr(e, 0x85, R12, RAX);
+    size_t single_fail = emit_jcc(e, JCC_JNE);
+
+    patch(e, to_ok, e->length);
+    emit(e, 0xB8);                          // mov eax, 1
+    emit_u32(e, 1);
+    size_t to_out = emit_jmp(e);
+    patch(e, pair_fail, e->length);
+    patch(e, single_fail, e->length);
+    emit_rr(e, 0x31, RAX, RAX);
+    patch(e, to_out, e->length);
+    emit(e, 0x41);                          // pop r12
+    emit(e, 0x5C);
+    emit(e, 0x5B);                          // pop rbx
+    emit(e, 0xC3);
+}
+
+bool operation_jit_available(void) { return true; }
+
+bool compile_operation_kernels(algorithm_registry_entry_t* algorithms, int count, jit_summary_t* summary) {
+    release_operation_kernels();
+    if (summary) *summary = (jit_summary_t) {0, 0};
+
+    long page = sysconf(_SC_PAGESIZE);
+    size_t size = (size_t)(count > 0 ? count : 1) * 2 * JIT_KERNEL_MAX;
+    size = (size + (size_t)page - 1) / (size_t)page * (size_t)page;
+    // Written while writable, then flipped to read + execute before any kernel runs
+    void* buffer = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED) return false;
+
+    emitter_t e = {buffer, 0};
+    size_t advance_at[32], match_at[32];
+    int compiled = 0;
+    for (int a = 0; a < count && a < 32; a++) {
+        advance_at[a] = match_at[a] = SIZE_MAX;
+        if (!op_supported(algorithms[a].op)) continue;
+        e.length = (e.length + 15) & ~(size_t)15;
+        advance_at[a] = e.length;
+        emit_advance_kernel(&e, algorithms[a].op);
+        e.length = (e.length + 15) & ~(size_t)15;
+        match_at[a] = e.length;
+        emit_match_kernel(&e, algorithms[a].op);
+        compiled++;
+    }
+    if (mprotect(buffer, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(buffer, size);
+        return false;
+    }
+    jit_buffer = buffer;
+    jit_buffer_size = size;
+
+    for (int a = 0; a < count && a < 32; a++) {
+        if (advance_at[a] == SIZE_MAX) continue;
+        // Object-to-function pointer conversion through memcpy keeps ISO C quiet
+        void* advance = jit_buffer + advance_at[a];
+        void* match = jit_buffer + match_at[a];
+        memcpy(&algorithms[a].jit_advance, &advance, sizeof(advance));
+        memcpy(&algorithms[a].jit_match, &match, sizeof(match));
+    }
+    if (summary) *summary = (jit_summary_t) {compiled, e.length};
+    return true;
+}
+
+void release_operation_kernels(void) {
+    if (jit_buffer) munmap(jit_buffer, jit_buffer_size);
+    jit_buffer = NULL;
+    jit_buffer_size = 0;
+}
+
+#else
+
+bool operation_jit_available(void) { return false; }
+
+bool compile_operation_kernels(algorithm_registry_entry_t* algorithms, int count, jit_summary_t* summary) {
+    (void)algorithms;
+    (void)count;
+    if (summary) *summary = (jit_summary_t) {0, 0};
+    return false;
+}
+
+void release_operation_kernels(void) {}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef OPERATION_JIT_H
+#define OPERATION_JIT_H
+
+#include "../../include/algorithm_registry.h"
+
+// Native packet-loop kernels for the active operations (--jit). Each supported op gets an
+// advance kernel for prefix states and a match kernel for leaves, written into one
+// executable buffer; the entries' jit_advance / jit_match point into it. Ops without a
+// native encoding, and every op on other architectures, keep the portable loops.
+
+typedef struct {
+    int compiled;          // Entries that received kernels
+    size_t code_bytes;     // Machine code emitted
+} jit_summary_t;
+
+// Compile kernels for algorithms[0..count) and fill their jit pointers. Returns false when
+// no executable buffer is available; the entries are then left untouched. Call before
+// worker threads start. The buffer lives until release_operation_kernels.
+bool compile_operation_kernels(algorithm_registry_entry_t* algorithms, int count, jit_summary_t* summary);
+void release_operation_kernels(void);
+
+// True when this build can emit native code
+bool operation_jit_available(void);
+
+#endif // OPERATION_JIT_H
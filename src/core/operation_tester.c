@@ -44,7 +44,7 @@ bool test_operation_sequence(const packet_dataset_t* dataset,
                 solution.field_indices[f] = field_permutation[f];
             }
             solution.field_count = field_count;
-            for (int op = 0; op < max_depth && op < 4; op++) {
+            for (int op = 0; op < max_depth && op < CADS_MAX_SOLUTION_OPS; op++) {
                 solution.operations[op] = operation_sequence[op];
             }
             solution.operation_count = max_depth;
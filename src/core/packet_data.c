@@ -260,7 +260,8 @@ bool load_packets_from_json(packet_dataset_t* dataset, const char* filename) {
         return false;
     }
     
-    char line[1024];
+    // Room for a full-size frame in hex plus the checksum, description and JSON around them
+    char line[2 * CADS_MAX_PACKET_SIZE + 512];
     size_t line_number = 0;
     size_t packets_loaded = 0;
     
@@ -275,7 +276,7 @@ bool load_packets_from_json(packet_dataset_t* dataset, const char* filename) {
         // Parse JSON line - simple parsing for our specific format
         // Expected: {"packet": "9c3001000000", "checksum": "31", "description": "CH1"}
         
-        char packet_hex[256] = {0};
+        char packet_hex[2 * CADS_MAX_PACKET_SIZE + 1] = {0};
         char checksum_hex[16] = {0};
         char description[128] = {0};
         
@@ -288,7 +289,7 @@ bool load_packets_from_json(packet_dataset_t* dataset, const char* filename) {
                 if (quote_start) {
                     quote_start++; // Skip opening quote
                     const char* quote_end = strchr(quote_start, '"');
-                    if (quote_end && (size_t)(quote_end - quote_start) < sizeof(packet_hex) - 1) {
+                    if (quote_end && (size_t)(quote_end - quote_start) < sizeof(packet_hex)) {
                         strncpy(packet_hex, quote_start, quote_end - quote_start);
                     }
                 }
@@ -362,3 +363,114 @@ bool validate_packet_format(const test_packet_t* packet) {
     if (!packet->description) return false;
     return true;
 }
+
+typedef struct {
+    uint64_t hash;                     // Hash of the frame bytes only
+    size_t index;
+} frame_key_t;
+
+static int compare_frame_keys(const void* a, const void* b) {
+    const frame_key_t* x = (const frame_key_t*)a;
+    const frame_key_t* y = (const frame_key_t*)b;
+    if (x->hash != y->hash) return x->hash < y->hash ? -1 : 1;
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+static bool same_frame(const test_packet_t* a, const test_packet_t* b) {
+    return a->packet_length == b->packet_length &&
+           memcmp(a->packet_data, b->packet_data, a->packet_length) == 0;
+}
+
+static bool same_checksum(const test_packet_t* a, const test_packet_t* b) {
+    if (a->checksum_size != b->checksum_size) return false;
+    uint64_t mask = a->checksum_size >= 8 ? UINT64_MAX : ((1ULL << (a->checksum_size * 8)) - 1);
+    return ((a->expected_checksum ^ b->expected_checksum) & mask) == 0;
+}
+
+// Remove exact duplicate packets, keeping the first occurrence and the original order
+size_t remove_duplicate_packets(packet_dataset_t* dataset, size_t* conflicting_packets) {
+    if (conflicting_packets) *conflicting_packets = 0;
+    if (!dataset || dataset->count < 2) return 0;
+
+    size_t n = dataset->count;
+    frame_key_t* keys = malloc(n * sizeof(frame_key_t));
+    bool* drop = calloc(n, sizeof(bool));
+    bool* conflict = calloc(n, sizeof(bool));
+    if (!keys || !drop || !conflict) {
+        free(keys);
+        free(drop);
+        free(conflict);
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        const test_packet_t* packet = &dataset->packets[i];
+        uint64_t h = 1469598103934665603ULL ^ packet->packet_length;
+        for (size_t b = 0; b < packet->packet_length; b++) {
+            h ^= packet->packet_data[b];
+            h *= 1099511628211ULL;
+        }
+        keys[i].hash = h;
+        keys[i].index = i;
+    }
+    qsort(keys, n, sizeof(frame_key_t), compare_frame_keys);
+
+    // Within a hash group, compare every pair exactly: groups are tiny outside of
+    // degenerate captures, and collisions never merge distinct frames
+    for (size_t start = 0; start < n;) {
+        size_t end = start + 1;
+        while (end < n && keys[end].hash == keys[start].hash) end++;
+        for (size_t i = start; i < end; i++) {
+            const test_packet_t* a = &dataset->packets[keys[i].index];
+            for (size_t j = i + 1; j < end; j++) {
+                const test_packet_t* b = &dataset->packets[keys[j].index];
+                if (drop[keys[j].index] || !same_frame(a, b)) continue;
+                if (same_checksum(a, b)) {
+                    if (!drop[keys[i].index]) drop[keys[j].index] = true;
+                } else {
+                    conflict[keys[i].index] = true;
+                    conflict[keys[j].index] = true;
+                }
+            }
+        }
+        start = end;
+    }
+
+    size_t kept = 0, conflicts = 0;
+    for (size_t i = 0; i < n; i++) {
+        test_packet_t* packet = &dataset->packets[i];
+        if (drop[i]) {
+            free(packet->packet_data);
+            free((char*)packet->description);
+            continue;
+        }
+        if (conflict[i]) conflicts++;
+        dataset->packets[kept++] = *packet;
+    }
+    dataset->count = kept;
+    if (conflicting_packets) *conflicting_packets = conflicts;
+
+    free(keys);
+    free(drop);
+    free(conflict);
+    return n - kept;
+}
+
+// Ties go to the longer length
+size_t most_common_length(const packet_dataset_t* dataset, size_t* count) {
+    size_t best_length = 0;
+    size_t best_count = 0;
+    for (size_t i = 0; i < dataset->count; i++) {
+        size_t length = dataset->packets[i].packet_length;
+        if (length == best_length) continue;
+        size_t n = 0;
+        for (size_t j = 0; j < dataset->count; j++) {
+            if (dataset->packets[j].packet_length == length) n++;
+        }
+        if (n > best_count || (n == best_count && length > best_length)) {
+            best_length = length;
+            best_count = n;
+        }
+    }
+    *count = best_count;
+    return best_length;
+}
@@ -33,4 +33,12 @@ uint64_t extract_checksum_from_packet(const uint8_t* full_packet, size_t packet_
                                      size_t checksum_size, bool little_endian);
 bool validate_packet_format(const test_packet_t* packet);
 
+// Drop exact duplicate packets (same bytes and checksum) in place, keeping the first copy.
+// Returns the number removed; conflicting_packets counts packets that share their bytes
+// with a packet of a different checksum.
+size_t remove_duplicate_packets(packet_dataset_t* dataset, size_t* conflicting_packets);
+
+// Frame length most packets share; count receives how many do
+size_t most_common_length(const packet_dataset_t* dataset, size_t* count);
+
 #endif // PACKET_DATA_H
\ No newline at end of file
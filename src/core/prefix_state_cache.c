@@ -0,0 +1,128 @@
+#include "prefix_state_cache.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define PREFIX_STATE_PROBE_LIMIT 4
+#define PREFIX_STATE_MIN_CAPACITY 64
+#define PREFIX_STATE_FLAG_HALTED 0x01
+#define PREFIX_STATE_FLAG_SOLUTIONS 0x02
+
+static uint64_t hash_chain_state(const chain_state_t* state, size_t packet_count, int depth, uint32_t field_set) {
+    uint64_t h = 0x9E3779B97F4A7C15ULL ^ ((uint64_t)depth << 40) ^ ((uint64_t)field_set << 16) ^
+                 ((uint64_t)state->field_cursor << 8) ^ (uint64_t)state->halted;
+    for (size_t p = 0; p < packet_count; p++) {
+        h ^= state->values[p];
+        h *= 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    return h;
+}
+
+static bool entry_matches(const prefix_state_cache_t* cache, size_t slot, uint64_t hash,
+                          const chain_state_t* state, int depth, uint32_t field_set) {
+    const prefix_state_entry_t* entry = &cache->entries[slot];
+    if (entry->epoch != cache->epoch || entry->hash != hash || entry->depth != depth) return false;
+    if (entry->field_set != field_set) return false;
+    if (entry->field_cursor != state->field_cursor) return false;
+    if (((entry->flags & PREFIX_STATE_FLAG_HALTED) != 0) != state->halted) return false;
+    return memcmp(&cache->values[slot * cache->packet_count], state->values,
+                  cache->packet_count * sizeof(uint64_t)) == 0;
+}
+
+prefix_state_cache_t* create_prefix_state_cache(size_t memory_bytes, size_t packet_count) {
+    if (packet_count == 0) return NULL;
+    size_t entry_bytes = sizeof(prefix_state_entry_t) + packet_count * sizeof(uint64_t);
+    size_t capacity = PREFIX_STATE_MIN_CAPACITY;
+    if (memory_bytes / entry_bytes < capacity) return NULL;
+    while (capacity * 2 <= memory_bytes / entry_bytes) capacity *= 2;
+
+    prefix_state_cache_t* cache = calloc(1, sizeof(prefix_state_cache_t));
+    if (!cache) return NULL;
+    cache->entries = calloc(capacity, sizeof(prefix_state_entry_t));
+    cache->values = malloc(capacity * packet_count * sizeof(uint64_t));
+    if (!cache->entries || !cache->values) {
+        free_prefix_state_cache(cache);
+        return NULL;
+    }
+    cache->capacity = capacity;
+    cache->packet_count = packet_count;
+    cache->epoch = 1;
+    return cache;
+}
+
+void free_prefix_state_cache(prefix_state_cache_t* cache) {
+    if (!cache) return;
+    free(cache->entries);
+    free(cache->values);
+    free(cache);
+}
+
+size_t prefix_state_cache_memory(const prefix_state_cache_t* cache) {
+    if (!cache) return 0;
+    return cache->capacity * (sizeof(prefix_state_entry_t) + cache->packet_count * sizeof(uint64_t));
+}
+
+void prefix_state_cache_new_context(prefix_state_cache_t* cache) {
+    if (!cache) return;
+    cache->epoch++;
+    if (cache->epoch == 0) {
+        // Epoch counter wrapped: stale entries could alias, so clear them once
+        memset(cache->entries, 0, cache->capacity * sizeof(prefix_state_entry_t));
+        cache->epoch = 1;
+    }
+}
+
+prefix_state_status_t prefix_state_cache_visit(prefix_state_cache_t* cache,
+                                               const chain_state_t* state,
+                                               int depth,
+                                               uint32_t field_set,
+                                               size_t* slot) {
+    uint64_t hash = hash_chain_state(state, cache->packet_count, depth, field_set);
+    size_t mask = cache->capacity - 1;
+    size_t home = (size_t)(hash ^ (hash >> 29)) & mask;
+    size_t free_slot = SIZE_MAX;
+
+    for (size_t probe = 0; probe < PREFIX_STATE_PROBE_LIMIT; probe++) {
+        size_t s = (home + probe) & mask;
+        if (cache->entries[s].epoch != cache->epoch) {
+            if (free_slot == SIZE_MAX) free_slot = s;
+            continue;
+        }
+        if (entry_matches(cache, s, hash, state, depth, field_set)) {
+            *slot = s;
+            if (cache->entries[s].flags & PREFIX_STATE_FLAG_SOLUTIONS) {
+                cache->equivalent_hits++;
+                return PREFIX_STATE_SEEN_WITH_SOLUTIONS;
+            }
+            cache->hits++;
+            return PREFIX_STATE_SEEN;
+        }
+    }
+
+    // Miss: take a free slot in the probe window, otherwise evict the home slot
+    if (free_slot == SIZE_MAX) {
+        free_slot = home;
+        cache->evictions++;
+    }
+    prefix_state_entry_t* entry = &cache->entries[free_slot];
+    entry->hash = hash;
+    entry->epoch = cache->epoch;
+    entry->field_set = field_set;
+    entry->depth = (uint16_t)depth;
+    entry->field_cursor = (uint8_t)state->field_cursor;
+    entry->flags = state->halted ? PREFIX_STATE_FLAG_HALTED : 0;
+    memcpy(&cache->values[free_slot * cache->packet_count], state->values,
+           cache->packet_count * sizeof(uint64_t));
+    *slot = free_slot;
+    return PREFIX_STATE_NEW;
+}
+
+void prefix_state_cache_mark_solutions(prefix_state_cache_t* cache, size_t slot,
+                                       const chain_state_t* state, int depth, uint32_t field_set) {
+    if (!cache || slot >= cache->capacity) return;
+    uint64_t hash = hash_chain_state(state, cache->packet_count, depth, field_set);
+    // The slot may have been evicted while the subtree was explored; then there is nothing to mark
+    if (entry_matches(cache, slot, hash, state, depth, field_set)) {
+        cache->entries[slot].flags |= PREFIX_STATE_FLAG_SOLUTIONS;
+    }
+}
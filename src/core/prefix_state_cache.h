@@ -0,0 +1,59 @@
+#ifndef PREFIX_STATE_CACHE_H
+#define PREFIX_STATE_CACHE_H
+
+#include "../../include/cads_types.h"
+#include "../../include/sequence_evaluator.h"
+
+// Observational-equivalence pruning for the recursive search.
+// Within one field-mask context, two op prefixes that leave every packet with the same
+// running value, field cursor and depth, and have read the same set of fields, have
+// identical subtrees. The cache remembers states already explored so the second prefix
+// can be skipped.
+
+typedef enum {
+    PREFIX_STATE_NEW = 0,                // First visit; caller explores and may mark solutions
+    PREFIX_STATE_SEEN,                   // Explored before without solutions; prune
+    PREFIX_STATE_SEEN_WITH_SOLUTIONS     // Explored before and solutions were found; re-explore
+} prefix_state_status_t;
+
+typedef struct {
+    uint64_t hash;
+    uint32_t epoch;                      // Entry is live only when it matches the cache epoch
+    uint32_t field_set;                  // Mask fields read so far, by position
+    uint16_t depth;
+    uint8_t field_cursor;
+    uint8_t flags;
+} prefix_state_entry_t;
+
+typedef struct {
+    prefix_state_entry_t* entries;
+    uint64_t* values;                    // capacity x packet_count running values
+    size_t capacity;                     // Power of two
+    size_t packet_count;
+    uint32_t epoch;
+    uint64_t hits;                       // Prefixes pruned
+    uint64_t equivalent_hits;            // Prefixes re-explored because their twin had solutions
+    uint64_t evictions;
+} prefix_state_cache_t;
+
+// Returns NULL when memory_bytes cannot hold a useful number of entries
+prefix_state_cache_t* create_prefix_state_cache(size_t memory_bytes, size_t packet_count);
+void free_prefix_state_cache(prefix_state_cache_t* cache);
+size_t prefix_state_cache_memory(const prefix_state_cache_t* cache);
+
+// Start a new field-mask context; previous entries become stale
+void prefix_state_cache_new_context(prefix_state_cache_t* cache);
+
+// Look up (and on a miss, insert) a chain state. slot receives the entry index for
+// prefix_state_cache_mark_solutions().
+prefix_state_status_t prefix_state_cache_visit(prefix_state_cache_t* cache,
+                                               const chain_state_t* state,
+                                               int depth,
+                                               uint32_t field_set,
+                                               size_t* slot);
+
+// Record that the subtree under a NEW state produced solutions
+void prefix_state_cache_mark_solutions(prefix_state_cache_t* cache, size_t slot,
+                                       const chain_state_t* state, int depth, uint32_t field_set);
+
+#endif // PREFIX_STATE_CACHE_H
@@ -0,0 +1,426 @@
+// Range reductions: sums, XORs, Internet checksums, Fletcher and Adler over a contiguous
+// byte range.
+//
+// These checksums are folds over a span of the frame, which the operation-chain engine can
+// only approximate with a handful of fields. Every packet gets prefix tables instead: byte
+// sums, XORs, sums of even-position bytes and position-weighted sums. Any span
+// [start, length - trim) then reduces in O(1):
+// - 16-bit words split into the bytes at the span's even and odd offsets,
+// - Fletcher and Adler second sums are sum((end - i) * d_i) = end * sum(d) - sum(i * d_i).
+// Each (span, reduction) pair solves its finaliser constant from the first packet and is
+// checked against the rest, so whole 1024-byte frames are covered exhaustively.
+
+#include "range_reduction.h"
+#include "../../include/checksum_engine.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define RANGE_FINALISER_COUNT 3
+
+static const char* reduction_names[NUM_RANGE_REDUCTIONS] = {
+    "byte-sum", "byte-xor", "word-sum", "internet", "fletcher16", "adler32"
+};
+
+// Bits the reduction produces; 0 means the checksum width
+static const int reduction_widths[NUM_RANGE_REDUCTIONS] = {0, 8, 0, 16, 16, 32};
+
+const char* range_reduction_name(range_reduction_t reduction) {
+    return reduction < NUM_RANGE_REDUCTIONS ? reduction_names[reduction] : "unknown";
+}
+
+static uint64_t fold_ones_complement(uint64_t sum) {
+    while (sum >> 16) sum = (sum & 0xFFFF) + (sum >> 16);
+    return sum;
+}
+
+static uint64_t apply_finaliser(range_finaliser_t finaliser, uint64_t reduced, uint64_t constant, uint64_t mask) {
+    switch (finaliser) {
+        case RANGE_FINAL_XOR: return (reduced ^ constant) & mask;
+        case RANGE_FINAL_NEG_ADD: return (constant - reduced) & mask;
+        default: return (reduced + constant) & mask;
+    }
+}
+
+// The one constant that maps reduced to checksum
+static uint64_t solve_finaliser(range_finaliser_t finaliser, uint64_t reduced, uint64_t checksum, uint64_t mask) {
+    switch (finaliser) {
+        case RANGE_FINAL_XOR: return (checksum ^ reduced) & mask;
+        case RANGE_FINAL_NEG_ADD: return (checksum + reduced) & mask;
+        default: return (checksum - reduced) & mask;
+    }
+}
+
+uint64_t range_model_compute(const range_model_t* model, const uint8_t* data, size_t length, size_t checksum_size) {
+    size_t start = model->data_start;
+    size_t end = length > model->data_end_trim ? length - model->data_end_trim : 0;
+    if (end < start) end = start;
+
+    uint64_t value = 0;
+    uint64_t sum1 = 0, sum2 = 0;
+    uint64_t a = 1, b = 0;
+    for (size_t i = start; i < end; i++) {
+        switch (model->reduction) {
+            case RANGE_BYTE_SUM: value += data[i]; break;
+            case RANGE_BYTE_XOR: value ^= data[i]; break;
+            case RANGE_WORD_SUM:
+            case RANGE_INTERNET: value += ((i - start) & 1) ? data[i] : (uint64_t)data[i] << 8; break;
+            case RANGE_FLETCHER16:
+                sum1 = (sum1 + data[i]) % 255;
+                sum2 = (sum2 + sum1) % 255;
+                break;
+            case RANGE_ADLER32:
+                a = (a + data[i]) % 65521;
+                b = (b + a) % 65521;
+                break;
+            default: break;
+        }
+    }
+    if (model->reduction == RANGE_INTERNET) value = fold_ones_complement(value);
+    if (model->reduction == RANGE_FLETCHER16) value = (sum2 << 8) | sum1;
+    if (model->reduction == RANGE_ADLER32) value = (b << 16) | a;
+    uint64_t mask = mask_checksum_to_size(UINT64_MAX, checksum_size);
+    return apply_finaliser(model->finaliser, value & mask, model->constant, mask);
+}
+
+bool range_model_matches_dataset(const range_model_t* model, const packet_dataset_t* dataset, size_t checksum_size) {
+    for (size_t i = 0; i < dataset->count; i++) {
+        const test_packet_t* packet = &dataset->packets[i];
+        if (packet->packet_length <= model->data_start + model->data_end_trim) return false;
+        if (range_model_compute(model, packet->packet_data, packet->packet_length, checksum_size) !=
+            mask_checksum_to_size(packet->expected_checksum, checksum_size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_range_model(const range_model_t* model, size_t checksum_size) {
+    int digits = (int)checksum_size * 2;
+    uint64_t mask = mask_checksum_to_size(UINT64_MAX, checksum_size);
+    unsigned long long constant = (unsigned long long)model->constant;
+    printf("%s over data=[%zu, len-%zu), checksum = ", range_reduction_name(model->reduction),
+           model->data_start, model->data_end_trim);
+    switch (model->finaliser) {
+        case RANGE_FINAL_XOR:
+            if (model->constant == mask) printf("~r\n");
+            else printf("r ^ 0x%0*llx\n", digits, constant);
+            break;
+        case RANGE_FINAL_NEG_ADD:
+            if (model->constant == 0) printf("-r\n");
+            else printf("0x%0*llx - r\n", digits, constant);
+            break;
+        default:
+            if (model->constant == 0) printf("r\n");
+            else printf("r + 0x%0*llx\n", digits, constant);
+            break;
+    }
+}
+
+// Per-packet prefix tables; entry i of a packet covers data[0, i)
+typedef struct {
+    size_t count;
+    size_t* offsets;                   // First entry of each packet (length + 1 entries each)
+    size_t* lengths;
+    uint64_t* sums;
+    uint64_t* weighted;                // sum of j * data[j]
+    uint64_t* even_sums;               // sum of data[j] for even j
+    uint8_t* xors;
+    uint64_t* expected;                // Masked to the checksum size
+} range_prefix_t;
+
+static void free_range_prefix(range_prefix_t* t) {
+    free(t->offsets);
+    free(t->lengths);
+    free(t->sums);
+    free(t->weighted);
+    free(t->even_sums);
+    free(t->xors);
+    free(t->expected);
+}
+
+static bool build_range_prefix(range_prefix_t* t, const packet_dataset_t* dataset, size_t checksum_size) {
+    memset(t, 0, sizeof(*t));
+    t->count = dataset->count;
+    size_t entries = 0;
+    for (size_t p = 0; p < dataset->count; p++) entries += dataset->packets[p].packet_length + 1;
+
+    t->offsets = malloc(dataset->count * sizeof(size_t));
+    t->lengths = malloc(dataset->count * sizeof(size_t));
+    t->expected = malloc(dataset->count * sizeof(uint64_t));
+    t->sums = malloc(entries * sizeof(uint64_t));
+    t->weighted = malloc(entries * sizeof(uint64_t));
+    t->even_sums = malloc(entries * sizeof(uint64_t));
+    t->xors = malloc(entries);
+    if (!t->offsets || !t->lengths || !t->expected || !t->sums || !t->weighted || !t->even_sums || !t->xors) {
+        free_range_prefix(t);
+        return false;
+    }
+
+    size_t base = 0;
+    for (size_t p = 0; p < dataset->count; p++) {
+        const test_packet_t* packet = &dataset->packets[p];
+        t->offsets[p] = base;
+        t->lengths[p] = packet->packet_length;
+        t->expected[p] = mask_checksum_to_size(packet->expected_checksum, checksum_size);
+        t->sums[base] = t->weighted[base] = t->even_sums[base] = 0;
+        t->xors[base] = 0;
+        for (size_t i = 0; i < packet->packet_length; i++) {
+            uint8_t d = packet->packet_data[i];
+            t->sums[base + i + 1] = t->sums[base + i] + d;
+            t->weighted[base + i + 1] = t->weighted[base + i] + (uint64_t)i * d;
+            t->even_sums[base + i + 1] = t->even_sums[base + i] + ((i & 1) ? 0 : d);
+            t->xors[base + i + 1] = t->xors[base + i] ^ d;
+        }
+        base += packet->packet_length + 1;
+    }
+    return true;
+}
+
+// O(1) reduction of packet p's data[start, end), before masking
+static uint64_t reduce_range(const range_prefix_t* t, size_t p, range_reduction_t reduction, size_t start, size_t end) {
+    size_t base = t->offsets[p];
+    uint64_t sum = t->sums[base + end] - t->sums[base + start];
+    switch (reduction) {
+        case RANGE_BYTE_SUM:
+            return sum;
+        case RANGE_BYTE_XOR:
+            return (uint64_t)(t->xors[base + end] ^ t->xors[base + start]);
+        case RANGE_WORD_SUM:
+        case RANGE_INTERNET: {
+            // High bytes sit at even offsets from start
+            uint64_t even = t->even_sums[base + end] - t->even_sums[base + start];
+            uint64_t high = (start & 1) ? sum - even : even;
+            uint64_t words = (high << 8) + (sum - high);
+            return reduction == RANGE_INTERNET ? fold_ones_complement(words) : words;
+        }
+        case RANGE_FLETCHER16: {
+            uint64_t second = end * sum - (t->weighted[base + end] - t->weighted[base + start]);
+            return ((second % 255) << 8) | (sum % 255);
+        }
+        case RANGE_ADLER32: {
+            uint64_t second = end * sum - (t->weighted[base + end] - t->weighted[base + start]);
+            return (((end - start + second) % 65521) << 16) | ((1 + sum) % 65521);
+        }
+        default:
+            return 0;
+    }
+}
+
+typedef struct {
+    const config_t* config;
+    const range_prefix_t* prefix;
+    size_t min_length;
+    bool reductions[NUM_RANGE_REDUCTIONS];  // Reductions that fit the checksum size
+    size_t* next_start;
+    pthread_mutex_t* work_mutex;
+    search_results_t* results;
+    pthread_mutex_t* results_mutex;
+    volatile bool* stop;
+    uint64_t candidates_checked;
+} range_worker_t;
+
+static void record_model(range_worker_t* w, const range_model_t* model) {
+    pthread_mutex_lock(w->results_mutex);
+    add_range_model(w->results, model);
+    if (w->config->early_exit) {
+        w->results->early_exit_triggered = true;
+        *w->stop = true;
+    }
+    pthread_mutex_unlock(w->results_mutex);
+}
+
+// Every span starting at start, every reduction, every finaliser
+static void run_start(range_worker_t* w, size_t start) {
+    const range_prefix_t* t = w->prefix;
+    uint64_t mask = mask_checksum_to_size(UINT64_MAX, w->config->checksum_size);
+    for (size_t trim = 0; start + trim < w->min_length && !*w->stop; trim++) {
+        for (int r = 0; r < NUM_RANGE_REDUCTIONS; r++) {
+            if (!w->reductions[r]) continue;
+            range_reduction_t reduction = (range_reduction_t)r;
+            w->candidates_checked += RANGE_FINALISER_COUNT;
+
+            uint64_t reduced = reduce_range(t, 0, reduction, start, t->lengths[0] - trim) & mask;
+            uint64_t constants[RANGE_FINALISER_COUNT];
+            unsigned alive = (1u << RANGE_FINALISER_COUNT) - 1;
+            for (int f = 0; f < RANGE_FINALISER_COUNT; f++) {
+                constants[f] = solve_finaliser((range_finaliser_t)f, reduced, t->expected[0], mask);
+            }
+            // r ^ 0 is r + 0, and mask - r is r ^ mask
+            if (constants[RANGE_FINAL_XOR] == 0) alive &= ~(1u << RANGE_FINAL_XOR);
+            if (constants[RANGE_FINAL_NEG_ADD] == mask) alive &= ~(1u << RANGE_FINAL_NEG_ADD);
+            for (size_t p = 1; p < t->count && alive; p++) {
+                reduced = reduce_range(t, p, reduction, start, t->lengths[p] - trim) & mask;
+                for (int f = 0; f < RANGE_FINALISER_COUNT; f++) {
+                    if ((alive & (1u << f)) &&
+                        apply_finaliser((range_finaliser_t)f, reduced, constants[f], mask) != t->expected[p]) {
+                        alive &= ~(1u << f);
+                    }
+                }
+            }
+            for (int f = 0; f < RANGE_FINALISER_COUNT; f++) {
+                if (!(alive & (1u << f))) continue;
+                range_model_t model = {reduction, (range_finaliser_t)f, constants[f], start, trim};
+                record_model(w, &model);
+            }
+        }
+    }
+}
+
+static void* range_worker_thread(void* arg) {
+    range_worker_t* w = (range_worker_t*)arg;
+    while (!*w->stop) {
+        pthread_mutex_lock(w->work_mutex);
+        size_t start = (*w->next_start)++;
+        pthread_mutex_unlock(w->work_mutex);
+        if (start >= w->min_length) break;
+        run_start(w, start);
+    }
+    return NULL;
+}
+
+static int compare_range_models(const void* a, const void* b) {
+    const range_model_t* x = (const range_model_t*)a;
+    const range_model_t* y = (const range_model_t*)b;
+    if (x->reduction != y->reduction) return (int)x->reduction - (int)y->reduction;
+    if (x->data_start != y->data_start) return x->data_start < y->data_start ? -1 : 1;
+    if (x->data_end_trim != y->data_end_trim) return x->data_end_trim < y->data_end_trim ? -1 : 1;
+    if (x->finaliser != y->finaliser) return (int)x->finaliser - (int)y->finaliser;
+    return x->constant < y->constant ? -1 : x->constant > y->constant;
+}
+
+// Same model first, widest span first
+static int compare_range_coverage(const void* a, const void* b) {
+    const range_model_t* x = (const range_model_t*)a;
+    const range_model_t* y = (const range_model_t*)b;
+    if (x->reduction != y->reduction) return (int)x->reduction - (int)y->reduction;
+    if (x->finaliser != y->finaliser) return (int)x->finaliser - (int)y->finaliser;
+    if (x->constant != y->constant) return x->constant < y->constant ? -1 : 1;
+    size_t x_skip = x->data_start + x->data_end_trim, y_skip = y->data_start + y->data_end_trim;
+    if (x_skip != y_skip) return x_skip < y_skip ? -1 : 1;
+    return x->data_start < y->data_start ? -1 : x->data_start > y->data_start;
+}
+
+// Spans that only differ by bytes the reduction ignores (zero padding) give the same
+// model. Within one model, a span is dropped when a wider one kept shares its start or
+// its end.
+static void drop_covered_spans(search_results_t* results, size_t min_length) {
+    if (results->range_model_count < 2) return;
+    qsort(results->range_models, results->range_model_count, sizeof(range_model_t), compare_range_coverage);
+    bool* start_kept = calloc(min_length, sizeof(bool));
+    bool* trim_kept = calloc(min_length, sizeof(bool));
+    if (!start_kept || !trim_kept) {
+        free(start_kept);
+        free(trim_kept);
+        return;
+    }
+    size_t kept = 0, group_kept = 0;
+    range_model_t group = results->range_models[0];
+    for (size_t i = 0; i < results->range_model_count; i++) {
+        range_model_t model = results->range_models[i];
+        if (model.reduction != group.reduction || model.finaliser != group.finaliser ||
+            model.constant != group.constant) {
+            // New model: clear the marks of the previous group's kept spans
+            for (size_t k = group_kept; k < kept; k++) {
+                start_kept[results->range_models[k].data_start] = false;
+                trim_kept[results->range_models[k].data_end_trim] = false;
+            }
+            group = model;
+            group_kept = kept;
+        }
+        if (start_kept[model.data_start] || trim_kept[model.data_end_trim]) continue;
+        start_kept[model.data_start] = trim_kept[model.data_end_trim] = true;
+        results->range_models[kept++] = model;
+    }
+    results->range_model_count = kept;
+    free(start_kept);
+    free(trim_kept);
+}
+
+bool execute_range_reduction_search(const config_t* config, search_results_t* results) {
+    if (!config || !results || !config->dataset || config->dataset->count == 0) return false;
+    const packet_dataset_t* dataset = config->dataset;
+    size_t min_length = SIZE_MAX;
+    for (size_t p = 0; p < dataset->count; p++) {
+        if (dataset->packets[p].packet_length < min_length) min_length = dataset->packets[p].packet_length;
+    }
+
+    range_prefix_t prefix;
+    if (!build_range_prefix(&prefix, dataset, config->checksum_size)) return false;
+
+    int thread_count = config->threads > 1 ? config->threads
+                     : config->threads == 0 ? (int)sysconf(_SC_NPROCESSORS_ONLN) : 1;
+    if ((size_t)thread_count > min_length) thread_count = min_length > 0 ? (int)min_length : 1;
+
+    bool reductions[NUM_RANGE_REDUCTIONS];
+    int reduction_count = 0;
+    for (int r = 0; r < NUM_RANGE_REDUCTIONS; r++) {
+        int width = reduction_widths[r];
+        reductions[r] = r == RANGE_WORD_SUM ? config->checksum_size >= 2 : width <= (int)config->checksum_size * 8;
+        reduction_count += reductions[r];
+    }
+    if (config->verbose) {
+        printf("📏 Range reduction: %zu spans, %d reductions, %d finalisers, threads: %d\n",
+               min_length * (min_length + 1) / 2, reduction_count, RANGE_FINALISER_COUNT, thread_count);
+    }
+
+    range_worker_t* workers = calloc((size_t)thread_count, sizeof(range_worker_t));
+    pthread_t* threads = malloc((size_t)thread_count * sizeof(pthread_t));
+    pthread_mutex_t work_mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_mutex_t results_mutex = PTHREAD_MUTEX_INITIALIZER;
+    size_t next_start = 0;
+    volatile bool stop = false;
+    bool ok = workers && threads;
+
+    for (int t = 0; ok && t < thread_count; t++) {
+        workers[t] = (range_worker_t) {
+            .config = config,
+            .prefix = &prefix,
+            .min_length = min_length,
+            .next_start = &next_start,
+            .work_mutex = &work_mutex,
+            .results = results,
+            .results_mutex = &results_mutex,
+            .stop = &stop
+        };
+        memcpy(workers[t].reductions, reductions, sizeof(reductions));
+    }
+
+    int started = 0;
+    if (ok) {
+        for (; started < thread_count; started++) {
+            if (pthread_create(&threads[started], NULL, range_worker_thread, &workers[started]) != 0) {
+                stop = true;
+                ok = false;
+                break;
+            }
+        }
+    }
+    for (int t = 0; t < started; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    uint64_t checked = 0;
+    for (int t = 0; workers && t < thread_count; t++) {
+        checked += workers[t].candidates_checked;
+    }
+    results->tests_performed += checked;
+    results->search_completed = ok && (!stop || results->early_exit_triggered);
+
+    drop_covered_spans(results, min_length);
+    if (results->range_model_count > 1) {
+        qsort(results->range_models, results->range_model_count, sizeof(range_model_t), compare_range_models);
+    }
+    if (ok && config->verbose) {
+        printf("   Span candidates checked: %llu\n", (unsigned long long)checked);
+    }
+
+    free(workers);
+    free(threads);
+    free_range_prefix(&prefix);
+    pthread_mutex_destroy(&work_mutex);
+    pthread_mutex_destroy(&results_mutex);
+    return ok;
+}
@@ -0,0 +1,19 @@
+#ifndef RANGE_REDUCTION_H
+#define RANGE_REDUCTION_H
+
+#include "../../include/cads_types.h"
+#include "packet_data.h"
+
+// Reference byte-by-byte evaluation of a range model over data[model->data_start,
+// length - model->data_end_trim), masked to checksum_size. Empty ranges reduce to the
+// reduction's initial value.
+uint64_t range_model_compute(const range_model_t* model, const uint8_t* data, size_t length, size_t checksum_size);
+
+// True when the model reproduces every packet's expected checksum
+bool range_model_matches_dataset(const range_model_t* model, const packet_dataset_t* dataset, size_t checksum_size);
+
+const char* range_reduction_name(range_reduction_t reduction);
+
+void print_range_model(const range_model_t* model, size_t checksum_size);
+
+#endif // RANGE_REDUCTION_H
@@ -1,8 +1,45 @@
 #include "checksum_engine.h"
+#include "chain_bytecode.h"
 #include "../../include/sequence_evaluator.h"
 #include "../../include/algorithm_registry.h"
 
-// Core unified evaluation logic extracted from previous duplicated implementations.
+operand_kind_t get_operation_operand_kind(operation_t op) {
+    switch (op) {
+        case OP_ONES_COMPLEMENT:
+            return OPERAND_NONE;
+        case OP_CONST_ADD:
+        case OP_CONST_SUB:
+        case OP_CONST_XOR:
+        case OP_POLY_CRC:
+        case OP_CHECKSUM_VARIANT:
+            return OPERAND_CONSTANT;
+        default:
+            return OPERAND_FIELD;
+    }
+}
+
+bool operation_is_t_function(operation_t op) {
+    switch (op) {
+        case OP_ADD:
+        case OP_SUB:
+        case OP_XOR:
+        case OP_AND:
+        case OP_OR:
+        case OP_IDENTITY:
+        case OP_NOT:
+        case OP_NEGATE:
+        case OP_CONST_ADD:
+        case OP_CONST_SUB:
+        case OP_CONST_XOR:
+        case OP_ONES_COMPLEMENT:
+        case OP_TWOS_COMPLEMENT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Core unified evaluation logic: the chain is compiled once to bytecode and run per packet.
 bool evaluate_operation_sequence(const packet_dataset_t* dataset,
                                  const config_t* config,
                                  const uint8_t* field_permutation,
@@ -11,38 +48,288 @@ bool evaluate_operation_sequence(const packet_dataset_t* dataset,
                                  int operation_count,
                                  uint8_t constant) {
     if (!dataset || !config || !field_permutation || !operation_sequence) return false;
+    chain_program_t program;
+    uint64_t constants[1] = {constant};
+    if (!compile_chain_program(&program, field_permutation, field_count, operation_sequence, operation_count,
+                               constants, 1, config->checksum_size)) {
+        return false;
+    }
     for (size_t packet_idx = 0; packet_idx < dataset->count; packet_idx++) {
         const test_packet_t* packet = &dataset->packets[packet_idx];
         if (packet->checksum_size != config->checksum_size) return false; // mismatch invalidates sequence
-        // Field bounds check
-        for (int f = 0; f < field_count; f++) {
-            if (field_permutation[f] >= packet->packet_length) return false;
-        }
-        uint64_t calculated = extract_packet_field_value(packet->packet_data,
-                                                         packet->packet_length,
-                                                         field_permutation[0],
-                                                         config->checksum_size);
-        int field_idx = 1;
-        for (int op_idx = 0; op_idx < operation_count; op_idx++) {
-            operation_t op = operation_sequence[op_idx];
-            if (op == OP_ONES_COMPLEMENT) {
-                calculated = execute_algorithm(op, calculated, 0, 0);
-            } else if (op == OP_CONST_ADD || op == OP_CONST_SUB || op == OP_CONST_XOR || op == OP_POLY_CRC || op == OP_CHECKSUM_VARIANT) {
-                calculated = execute_algorithm(op, calculated, 0, constant);
-            } else if (field_idx < field_count) {
-                uint64_t next_val = extract_packet_field_value(packet->packet_data,
-                                                               packet->packet_length,
-                                                               field_permutation[field_idx],
-                                                               config->checksum_size);
-                calculated = execute_algorithm(op, calculated, next_val, 0);
-                field_idx++;
-            } else {
-                break; // No more fields available
+        if (packet->packet_length < (size_t)program.field_limit) return false; // Field bounds check
+        uint64_t expected = mask_checksum_to_size(packet->expected_checksum, config->checksum_size);
+        if (run_chain_program(&program, packet->packet_data, packet->packet_length) != expected) return false;
+    }
+    return true;
+}
+
+void extract_permutation_field_values(const packet_dataset_t* dataset,
+                                      const uint8_t* field_permutation,
+                                      int field_count,
+                                      size_t checksum_size,
+                                      uint64_t* field_values) {
+    for (int f = 0; f < field_count; f++) {
+        for (size_t p = 0; p < dataset->count; p++) {
+            const test_packet_t* packet = &dataset->packets[p];
+            field_values[(size_t)f * dataset->count + p] =
+                extract_packet_field_value(packet->packet_data, packet->packet_length,
+                                           field_permutation[f], checksum_size);
+        }
+    }
+}
+
+void init_chain_state(chain_state_t* state, const uint64_t* field_values, size_t packet_count) {
+    for (size_t p = 0; p < packet_count; p++) {
+        state->values[p] = field_values[p];
+    }
+    state->field_cursor = 1;
+    state->halted = false;
+}
+
+void advance_chain_state(const chain_state_t* from,
+                         chain_state_t* to,
+                         const algorithm_registry_entry_t* algorithm,
+                         const uint64_t* field_values,
+                         int field_count,
+                         size_t packet_count,
+                         uint64_t constant) {
+    to->field_cursor = from->field_cursor;
+    to->halted = from->halted;
+    operand_kind_t kind = get_operation_operand_kind(algorithm->op);
+
+    if (!from->halted && kind == OPERAND_FIELD && from->field_cursor >= field_count) {
+        to->halted = true;
+    }
+    if (to->halted) {
+        for (size_t p = 0; p < packet_count; p++) to->values[p] = from->values[p];
+        return;
+    }
+
+    algorithm_func_t func = algorithm->func;
+    if (kind == OPERAND_FIELD) {
+        const uint64_t* operand = &field_values[(size_t)from->field_cursor * packet_count];
+        if (algorithm->jit_advance) {
+            algorithm->jit_advance(to->values, from->values, operand, packet_count, 0);
+        } else {
+            for (size_t p = 0; p < packet_count; p++) to->values[p] = func(from->values[p], operand[p], 0);
+        }
+        to->field_cursor++;
+    } else {
+        uint64_t c = (kind == OPERAND_CONSTANT) ? constant : 0;
+        if (algorithm->jit_advance) {
+            algorithm->jit_advance(to->values, from->values, NULL, packet_count, c);
+        } else {
+            for (size_t p = 0; p < packet_count; p++) to->values[p] = func(from->values[p], 0, c);
+        }
+    }
+}
+
+bool chain_step_matches(const chain_state_t* from,
+                        const algorithm_registry_entry_t* algorithm,
+                        const uint64_t* field_values,
+                        int field_count,
+                        size_t packet_count,
+                        uint64_t constant,
+                        const uint64_t* expected,
+                        size_t checksum_size) {
+    operand_kind_t kind = get_operation_operand_kind(algorithm->op);
+    bool skip = from->halted || (kind == OPERAND_FIELD && from->field_cursor >= field_count);
+    algorithm_func_t func = algorithm->func;
+    const uint64_t* operand = (kind == OPERAND_FIELD && !skip)
+                              ? &field_values[(size_t)from->field_cursor * packet_count] : NULL;
+    uint64_t c = (kind == OPERAND_CONSTANT) ? constant : 0;
+    if (!skip && algorithm->jit_match) {
+        return algorithm->jit_match(expected, from->values, operand, packet_count, c,
+                                    mask_checksum_to_size(UINT64_MAX, checksum_size));
+    }
+
+    for (size_t p = 0; p < packet_count; p++) {
+        uint64_t value = from->values[p];
+        if (!skip) value = func(value, operand ? operand[p] : 0, c);
+        if (mask_checksum_to_size(value, checksum_size) != expected[p]) return false;
+    }
+    return true;
+}
+
+void build_chain_tail(chain_tail_t* tail,
+                      const chain_state_t* from,
+                      const algorithm_registry_entry_t* const* algorithms,
+                      int operation_count,
+                      int field_count,
+                      int max_slots) {
+    tail->algorithms = algorithms;
+    tail->operation_count = 0;
+    tail->slot_count = 0;
+    if (from->halted) return;
+    if (max_slots < 1) max_slots = 1;
+
+    int cursor = from->field_cursor;
+    int constant_ops = 0;
+    for (int op = 0; op < operation_count; op++) {
+        operand_kind_t kind = get_operation_operand_kind(algorithms[op]->op);
+        tail->kinds[op] = kind;
+        tail->fields[op] = -1;
+        tail->slots[op] = -1;
+        if (kind == OPERAND_FIELD) {
+            if (cursor >= field_count) break;
+            tail->fields[op] = cursor++;
+        } else if (kind == OPERAND_CONSTANT) {
+            tail->slots[op] = constant_ops < max_slots ? constant_ops : max_slots - 1;
+            constant_ops++;
+        }
+        tail->operation_count = op + 1;
+    }
+    tail->slot_count = constant_ops < max_slots ? constant_ops : max_slots;
+}
+
+// Second and third arguments of each op for one packet; free_slot reads 0 and is filled
+// in per candidate by the caller
+static void gather_tail_operands(const chain_tail_t* tail,
+                                 const uint64_t* field_values,
+                                 size_t packet_count,
+                                 size_t packet,
+                                 const uint64_t* slot_values,
+                                 int free_slot,
+                                 uint64_t* operands,
+                                 uint64_t* constants) {
+    for (int op = 0; op < tail->operation_count; op++) {
+        int field = tail->fields[op];
+        int slot = tail->slots[op];
+        operands[op] = field >= 0 ? field_values[(size_t)field * packet_count + packet] : 0;
+        constants[op] = (slot >= 0 && slot != free_slot) ? slot_values[slot] : 0;
+    }
+}
+
+bool chain_tail_matches(const chain_tail_t* tail,
+                        const chain_state_t* from,
+                        const uint64_t* field_values,
+                        size_t packet_count,
+                        const uint64_t* slot_values,
+                        const uint64_t* expected,
+                        uint64_t bit_mask) {
+    uint64_t constants[CADS_MAX_CHAIN_DEPTH];
+    for (int op = 0; op < tail->operation_count; op++) {
+        constants[op] = tail->slots[op] >= 0 ? slot_values[tail->slots[op]] : 0;
+    }
+    for (size_t p = 0; p < packet_count; p++) {
+        uint64_t value = from->values[p];
+        for (int op = 0; op < tail->operation_count; op++) {
+            int field = tail->fields[op];
+            uint64_t operand = field >= 0 ? field_values[(size_t)field * packet_count + p] : 0;
+            value = tail->algorithms[op]->func(value, operand, constants[op]);
+        }
+        if ((value ^ expected[p]) & bit_mask) return false;
+    }
+    return true;
+}
+
+bool chain_tail_filter_constants(const chain_tail_t* tail,
+                                 const chain_state_t* from,
+                                 const uint64_t* field_values,
+                                 size_t packet_count,
+                                 size_t packet,
+                                 const uint64_t* slot_values,
+                                 int free_slot,
+                                 uint64_t expected,
+                                 size_t checksum_size,
+                                 uint64_t candidates[CONSTANT_SET_WORDS]) {
+    // The operands do not depend on the candidate, so they are gathered once per packet
+    uint64_t operands[CADS_MAX_CHAIN_DEPTH];
+    uint64_t constants[CADS_MAX_CHAIN_DEPTH];
+    gather_tail_operands(tail, field_values, packet_count, packet, slot_values, free_slot, operands, constants);
+
+    uint64_t start = from->values[packet];
+    uint64_t any = 0;
+    for (int w = 0; w < CONSTANT_SET_WORDS; w++) {
+        for (uint64_t bits = candidates[w]; bits; bits &= bits - 1) {
+            int bit = __builtin_ctzll(bits);
+            uint64_t candidate = (uint64_t)(w * 64 + bit);
+            uint64_t value = start;
+            for (int op = 0; op < tail->operation_count; op++) {
+                uint64_t c = tail->slots[op] == free_slot ? candidate : constants[op];
+                value = tail->algorithms[op]->func(value, operands[op], c);
             }
+            if (mask_checksum_to_size(value, checksum_size) != expected) candidates[w] &= ~(1ULL << bit);
+        }
+        any |= candidates[w];
+    }
+    return any != 0;
+}
+
+// Op that reads the last slot when it is the only one doing so, else -1
+static int last_slot_reader(const chain_tail_t* tail) {
+    int reader = -1;
+    for (int op = 0; op < tail->operation_count; op++) {
+        if (tail->slots[op] != tail->slot_count - 1) continue;
+        if (reader >= 0) return -1;
+        reader = op;
+    }
+    return reader;
+}
+
+bool chain_tail_peelable(const chain_tail_t* tail) {
+    if (tail->slot_count == 0) return false;
+    int reader = last_slot_reader(tail);
+    if (reader < 0) return false;
+    operation_t op = tail->algorithms[reader]->op;
+    if (op != OP_CONST_ADD && op != OP_CONST_SUB && op != OP_CONST_XOR) return false;
+    for (int i = reader + 1; i < tail->operation_count; i++) {
+        switch (tail->algorithms[i]->op) {
+            case OP_ADD:
+            case OP_SUB:
+            case OP_XOR:
+            case OP_IDENTITY:
+            case OP_NOT:
+            case OP_NEGATE:
+            case OP_ONES_COMPLEMENT:
+            case OP_TWOS_COMPLEMENT:
+                break;
+            default:
+                return false;
         }
-        calculated = mask_checksum_to_size(calculated, config->checksum_size);
-        uint64_t expected = mask_checksum_to_size(packet->expected_checksum, config->checksum_size);
-        if (calculated != expected) return false;
     }
     return true;
 }
+
+uint64_t chain_tail_peel_constant(const chain_tail_t* tail,
+                                  const chain_state_t* from,
+                                  const uint64_t* field_values,
+                                  size_t packet_count,
+                                  size_t packet,
+                                  const uint64_t* slot_values,
+                                  uint64_t expected,
+                                  size_t checksum_size) {
+    uint64_t operands[CADS_MAX_CHAIN_DEPTH];
+    uint64_t constants[CADS_MAX_CHAIN_DEPTH];
+    int reader = last_slot_reader(tail);
+    gather_tail_operands(tail, field_values, packet_count, packet, slot_values, tail->slot_count - 1,
+                         operands, constants);
+
+    uint64_t value = from->values[packet];
+    for (int op = 0; op < reader; op++) {
+        value = tail->algorithms[op]->func(value, operands[op], constants[op]);
+    }
+    // Every op involved is a T-function, so working mod 2^64 and masking at the end is exact
+    uint64_t target = expected;
+    for (int op = tail->operation_count - 1; op > reader; op--) {
+        uint64_t b = operands[op];
+        switch (tail->algorithms[op]->op) {
+            case OP_ADD: target -= b; break;
+            case OP_SUB: target += b; break;
+            case OP_XOR: target ^= b; break;
+            case OP_NOT:
+            case OP_ONES_COMPLEMENT: target = ~target; break;
+            case OP_NEGATE: target = (uint64_t)0 - target; break;
+            case OP_TWOS_COMPLEMENT: target = (uint64_t)0 - target - b; break;
+            default: break;     // OP_IDENTITY
+        }
+    }
+    uint64_t constant;
+    switch (tail->algorithms[reader]->op) {
+        case OP_CONST_ADD: constant = target - value; break;
+        case OP_CONST_SUB: constant = value - target; break;
+        default: constant = target ^ value; break;
+    }
+    return mask_checksum_to_size(constant, checksum_size);
+}
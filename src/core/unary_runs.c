@@ -0,0 +1,154 @@
+#include "unary_runs.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define UNARY_RUN_INDEX_SLOTS (2 * UNARY_RUN_MAX_MAPPINGS)
+
+bool operation_is_unary(operation_t op) {
+    switch (op) {
+        case OP_IDENTITY:
+        case OP_NOT:
+        case OP_NEGATE:
+        case OP_ONES_COMPLEMENT:    // NONE kind, so b is always 0
+        case OP_SWAP_NIBBLES:
+        case OP_REVERSE_BITS:
+        case OP_LOOKUP_TABLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool operation_is_byte_closed(operation_t op) {
+    switch (op) {
+        case OP_RSHIFT:
+        case OP_DIV:
+        case OP_MOD:
+            return false;
+        default:
+            return op < NUM_OPS;
+    }
+}
+
+static uint64_t hash_mapping(const uint8_t* mapping) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (int x = 0; x < 256; x++) {
+        h ^= mapping[x];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
+// Index of mapping, adding it when there is room; UNARY_RUN_UNKNOWN when there is not
+static uint16_t intern_mapping(uint8_t (*mappings)[256], int* count, uint16_t* index, const uint8_t* mapping) {
+    size_t slot = hash_mapping(mapping) & (UNARY_RUN_INDEX_SLOTS - 1);
+    while (index[slot] != UNARY_RUN_UNKNOWN) {
+        if (memcmp(mappings[index[slot]], mapping, 256) == 0) return index[slot];
+        slot = (slot + 1) & (UNARY_RUN_INDEX_SLOTS - 1);
+    }
+    if (*count >= UNARY_RUN_MAX_MAPPINGS) return UNARY_RUN_UNKNOWN;
+    memcpy(mappings[*count], mapping, 256);
+    index[slot] = (uint16_t)*count;
+    return (uint16_t)(*count)++;
+}
+
+unary_run_table_t* build_unary_run_table(const algorithm_registry_entry_t* algorithms, int algorithm_count,
+                                         size_t checksum_size, int max_length) {
+    if (checksum_size != 1) return NULL;
+    int8_t unary_index[NUM_OPS];
+    memset(unary_index, -1, sizeof(unary_index));
+    uint8_t op_tables[NUM_OPS][256];
+    int unary_count = 0;
+    for (int a = 0; a < algorithm_count; a++) {
+        operation_t op = algorithms[a].op;
+        if (!operation_is_byte_closed(op)) return NULL;
+        if (!operation_is_unary(op) || unary_index[op] >= 0) continue;
+        for (int x = 0; x < 256; x++) {
+            op_tables[unary_count][x] = (uint8_t)algorithms[a].func((uint64_t)x, 0, 0);
+        }
+        unary_index[op] = (int8_t)unary_count++;
+    }
+    if (unary_count < 2) return NULL;
+
+    unary_run_table_t* table = calloc(1, sizeof(unary_run_table_t));
+    uint8_t (*mappings)[256] = malloc(UNARY_RUN_MAX_MAPPINGS * sizeof(*mappings));
+    uint16_t* index = malloc(UNARY_RUN_INDEX_SLOTS * sizeof(uint16_t));
+    uint16_t* next = malloc((size_t)UNARY_RUN_MAX_MAPPINGS * unary_count * sizeof(uint16_t));
+    if (!table || !mappings || !index || !next) {
+        free(table);
+        free(mappings);
+        free(index);
+        free(next);
+        return NULL;
+    }
+    memset(index, 0xFF, UNARY_RUN_INDEX_SLOTS * sizeof(uint16_t));
+    memset(next, 0xFF, (size_t)UNARY_RUN_MAX_MAPPINGS * unary_count * sizeof(uint16_t));
+
+    uint8_t mapping[256];
+    for (int x = 0; x < 256; x++) mapping[x] = (uint8_t)x;
+    int count = 0;
+    intern_mapping(mappings, &count, index, mapping);
+
+    // Breadth first by run length: [begin, end) holds the mappings first reached at length
+    int begin = 0, end = 1;
+    for (int length = 0; length < max_length && begin < end; length++) {
+        for (int m = begin; m < end; m++) {
+            for (int u = 0; u < unary_count; u++) {
+                for (int x = 0; x < 256; x++) mapping[x] = op_tables[u][mappings[m][x]];
+                next[(size_t)m * unary_count + u] = intern_mapping(mappings, &count, index, mapping);
+            }
+        }
+        begin = end;
+        end = count;
+    }
+
+    memcpy(table->unary_index, unary_index, sizeof(unary_index));
+    table->unary_count = unary_count;
+    table->mapping_count = count;
+    table->next = next;
+    free(mappings);
+    free(index);
+    return table;
+}
+
+void free_unary_run_table(unary_run_table_t* table) {
+    if (!table) return;
+    free(table->next);
+    free(table);
+}
+
+uint64_t unary_run_key(uint16_t mapping, int depth, int field_cursor, bool halted, uint32_t field_set) {
+    return (uint64_t)mapping | ((uint64_t)depth << 12) | ((uint64_t)field_cursor << 17) | ((uint64_t)halted << 22) |
+           ((uint64_t)field_set << 23);
+}
+
+void unary_run_set_reset(unary_run_set_t* set) {
+    set->epoch++;
+    set->used = 0;
+}
+
+prefix_state_status_t unary_run_set_visit(unary_run_set_t* set, uint64_t key, size_t* slot) {
+    size_t i = (size_t)((key * 0x9E3779B97F4A7C15ULL) >> 32) & (UNARY_RUN_SET_CAPACITY - 1);
+    while (set->entries[i].epoch == set->epoch) {
+        if (set->entries[i].key == key) {
+            *slot = i;
+            return set->entries[i].solutions ? PREFIX_STATE_SEEN_WITH_SOLUTIONS : PREFIX_STATE_SEEN;
+        }
+        i = (i + 1) & (UNARY_RUN_SET_CAPACITY - 1);
+    }
+    // Keep a quarter free so probes stay short
+    if (set->used >= UNARY_RUN_SET_CAPACITY / 4 * 3) {
+        *slot = SIZE_MAX;
+        return PREFIX_STATE_NEW;
+    }
+    set->entries[i].key = key;
+    set->entries[i].epoch = set->epoch;
+    set->entries[i].solutions = false;
+    set->used++;
+    *slot = i;
+    return PREFIX_STATE_NEW;
+}
+
+void unary_run_set_mark_solutions(unary_run_set_t* set, size_t slot) {
+    set->entries[slot].solutions = true;
+}
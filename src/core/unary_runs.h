@@ -0,0 +1,70 @@
+#ifndef UNARY_RUNS_H
+#define UNARY_RUNS_H
+
+#include "../../include/algorithm_registry.h"
+#include "prefix_state_cache.h"
+
+// Run collapse for 1-byte searches. ID, NOT, NEG, 1COMP, SWAP, REVB and LUT ignore their
+// operand, so a run of them placed back to back sends the value before the run through
+// one fixed function. When every selected op's low byte depends only on its inputs' low
+// bytes, that function is a 256-entry table, and runs from the same state that compose
+// to the same table leave identical subtrees. The distinct tables are numbered once per
+// search; the engine follows a run through the transition table and explores only the
+// first run per (start depth, end depth, mapping, fields read).
+
+#define UNARY_RUN_MAX_MAPPINGS 4096
+#define UNARY_RUN_IDENTITY 0
+#define UNARY_RUN_UNKNOWN 0xFFFF          // Past the mapping cap; never deduplicated
+
+typedef struct {
+    int8_t unary_index[NUM_OPS];          // Column in next, -1 for ops that read an operand
+    int unary_count;
+    int mapping_count;
+    uint16_t* next;                       // mapping_count x unary_count: mapping after one more op
+} unary_run_table_t;
+
+// Op ignores both its operand and the constant
+bool operation_is_unary(operation_t op);
+
+// Low byte of the result depends only on the low bytes of the value, operand and constant
+bool operation_is_byte_closed(operation_t op);
+
+// Number the mappings of every run up to max_length ops. NULL unless checksum_size is 1,
+// every op is byte-closed and at least two are unary.
+unary_run_table_t* build_unary_run_table(const algorithm_registry_entry_t* algorithms, int algorithm_count,
+                                         size_t checksum_size, int max_length);
+void free_unary_run_table(unary_run_table_t* table);
+
+static inline uint16_t unary_run_step(const unary_run_table_t* table, uint16_t mapping, operation_t op) {
+    if (mapping == UNARY_RUN_UNKNOWN) return UNARY_RUN_UNKNOWN;
+    return table->next[(size_t)mapping * table->unary_count + table->unary_index[op]];
+}
+
+// Runs already explored from one start state
+#define UNARY_RUN_SET_CAPACITY 2048
+
+typedef struct {
+    uint64_t key;
+    uint32_t epoch;
+    bool solutions;
+} unary_run_entry_t;
+
+typedef struct {
+    unary_run_entry_t entries[UNARY_RUN_SET_CAPACITY];
+    uint32_t epoch;
+    size_t used;
+} unary_run_set_t;
+
+// field_set holds the mask fields read so far, by position
+uint64_t unary_run_key(uint16_t mapping, int depth, int field_cursor, bool halted, uint32_t field_set);
+
+// Forget every run; call when the start state changes
+void unary_run_set_reset(unary_run_set_t* set);
+
+// Look up (and on a miss, insert) a run. slot is SIZE_MAX when the set is full and the
+// run was not stored.
+prefix_state_status_t unary_run_set_visit(unary_run_set_t* set, uint64_t key, size_t* slot);
+
+void unary_run_set_mark_solutions(unary_run_set_t* set, size_t slot);
+
+#endif // UNARY_RUNS_H
@@ -11,6 +11,19 @@
 // Forward declarations
 static bool parse_packets_section(config_t* config, FILE* file);
 
+// Long-only CLI options (values outside the short-option character range)
+enum {
+    OPT_STATE_CACHE_MB = 256,
+    OPT_STRATEGY,
+    OPT_MITM_DEPTH,
+    OPT_NO_PREPHASE,
+    OPT_CHAIN_CONSTANTS,
+    OPT_JIT,
+    OPT_KERNEL,
+    OPT_ESCALATE,
+    OPT_NO_MEMO
+};
+
 static char* trim_whitespace(char* str) {
     char* end;
     while (isspace((unsigned char)*str)) str++;
@@ -28,6 +41,20 @@ static complexity_level_t parse_complexity_level(const char* str) {
     return COMPLEXITY_INTERMEDIATE;
 }
 
+static search_strategy_t parse_search_strategy(const char* str) {
+    if (strcasecmp(str, "mitm") == 0) return STRATEGY_MITM;
+    if (strcasecmp(str, "crc") == 0) return STRATEGY_CRC;
+    if (strcasecmp(str, "bytes") == 0) return STRATEGY_BYTES;
+    if (strcasecmp(str, "range") == 0) return STRATEGY_RANGE;
+    return STRATEGY_EXHAUSTIVE;
+}
+
+static evaluation_kernel_t parse_evaluation_kernel(const char* str) {
+    if (strcasecmp(str, "bytewise") == 0) return KERNEL_BYTEWISE;
+    if (strcasecmp(str, "bitsliced") == 0) return KERNEL_BITSLICED;
+    return KERNEL_AUTO;
+}
+
 static operation_t parse_operation(const char* str) {
     if (strcasecmp(str, "identity") == 0) return OP_IDENTITY;
     if (strcasecmp(str, "add") == 0) return OP_ADD;
@@ -90,6 +117,24 @@ static bool parse_config_section(config_t* config, FILE* file) {
             config->verbose = parse_bool(value);
         } else if (strcmp(key, "threads") == 0) {
             config->threads = atoi(value);
+        } else if (strcmp(key, "state_cache_mb") == 0) {
+            config->state_cache_mb = atoi(value);
+        } else if (strcmp(key, "strategy") == 0) {
+            config->strategy = parse_search_strategy(value);
+        } else if (strcmp(key, "mitm_depth") == 0) {
+            config->mitm_depth = atoi(value);
+        } else if (strcmp(key, "chain_constants") == 0) {
+            config->chain_constants = atoi(value);
+        } else if (strcmp(key, "algebraic_prephase") == 0) {
+            config->algebraic_prephase = parse_bool(value);
+        } else if (strcmp(key, "jit") == 0) {
+            config->jit = parse_bool(value);
+        } else if (strcmp(key, "kernel") == 0) {
+            config->kernel = parse_evaluation_kernel(value);
+        } else if (strcmp(key, "escalate") == 0) {
+            config->escalate = parse_bool(value);
+        } else if (strcmp(key, "memo") == 0) {
+            config->memo = parse_bool(value);
         } else if (strcmp(key, "operations") == 0) {
             char* operations_str = strdup(value);
             char* token = strtok(operations_str, ",");
@@ -232,6 +277,16 @@ config_t* create_default_cads_config(void) {
     config->progress_interval = 250;
     config->verbose = false;
     config->threads = 1;
+    config->state_cache_mb = 64;
+    config->strategy = STRATEGY_EXHAUSTIVE;
+    config->mitm_depth = 6;
+    config->chain_constants = 1;
+    config->algebraic_prephase = true;
+    config->jit = false;
+    config->kernel = KERNEL_AUTO;
+    config->escalate = false;
+    config->covered_operations = 0;
+    config->memo = true;
     config->custom_operations = NULL;
     config->custom_operation_count = 0;
     config->dataset = NULL;
@@ -259,6 +314,15 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
         {"verbose", no_argument, 0, 'v'},
         {"threads", required_argument, 0, 't'},
         {"threading", no_argument, 0, 'T'},
+        {"state-cache-mb", required_argument, 0, OPT_STATE_CACHE_MB},
+        {"strategy", required_argument, 0, OPT_STRATEGY},
+        {"mitm-depth", required_argument, 0, OPT_MITM_DEPTH},
+        {"chain-constants", required_argument, 0, OPT_CHAIN_CONSTANTS},
+        {"no-prephase", no_argument, 0, OPT_NO_PREPHASE},
+        {"jit", no_argument, 0, OPT_JIT},
+        {"kernel", required_argument, 0, OPT_KERNEL},
+        {"escalate", no_argument, 0, OPT_ESCALATE},
+        {"no-memo", no_argument, 0, OPT_NO_MEMO},
         {"help", no_argument, 0, 'h'},
         {0, 0, 0, 0}
     };
@@ -301,6 +365,33 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
             case 'T':
                 config->threads = 0; // Auto-detect thread count
                 break;
+            case OPT_STATE_CACHE_MB:
+                config->state_cache_mb = atoi(optarg);
+                break;
+            case OPT_STRATEGY:
+                config->strategy = parse_search_strategy(optarg);
+                break;
+            case OPT_MITM_DEPTH:
+                config->mitm_depth = atoi(optarg);
+                break;
+            case OPT_CHAIN_CONSTANTS:
+                config->chain_constants = atoi(optarg);
+                break;
+            case OPT_NO_PREPHASE:
+                config->algebraic_prephase = false;
+                break;
+            case OPT_JIT:
+                config->jit = true;
+                break;
+            case OPT_KERNEL:
+                config->kernel = parse_evaluation_kernel(optarg);
+                break;
+            case OPT_ESCALATE:
+                config->escalate = true;
+                break;
+            case OPT_NO_MEMO:
+                config->memo = false;
+                break;
             case 'h':
                 free_cads_config(config);
                 return NULL; // Signal help requested
@@ -321,6 +412,15 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
         bool cli_early_exit = config->early_exit;
         int cli_max_solutions = config->max_solutions;
         int cli_progress_interval = config->progress_interval;
+        int cli_state_cache_mb = config->state_cache_mb;
+        search_strategy_t cli_strategy = config->strategy;
+        int cli_mitm_depth = config->mitm_depth;
+        int cli_chain_constants = config->chain_constants;
+        bool cli_algebraic_prephase = config->algebraic_prephase;
+        bool cli_jit = config->jit;
+        evaluation_kernel_t cli_kernel = config->kernel;
+        bool cli_escalate = config->escalate;
+        bool cli_memo = config->memo;
         
         // Track which CLI options were explicitly provided
         bool provided_threads = false;
@@ -331,6 +431,15 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
         bool provided_early_exit = false;
         bool provided_max_solutions = false;
         bool provided_progress_interval = false;
+        bool provided_state_cache_mb = false;
+        bool provided_strategy = false;
+        bool provided_mitm_depth = false;
+        bool provided_chain_constants = false;
+        bool provided_no_prephase = false;
+        bool provided_jit = false;
+        bool provided_kernel = false;
+        bool provided_escalate = false;
+        bool provided_no_memo = false;
         
         // Re-scan to detect which args were provided
         optind = 1;
@@ -346,6 +455,15 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
                 case 'v': provided_verbose = true; break;
                 case 't': provided_threads = true; break;
                 case 'T': provided_threads = true; break;
+                case OPT_STATE_CACHE_MB: provided_state_cache_mb = true; break;
+                case OPT_STRATEGY: provided_strategy = true; break;
+                case OPT_MITM_DEPTH: provided_mitm_depth = true; break;
+                case OPT_CHAIN_CONSTANTS: provided_chain_constants = true; break;
+                case OPT_NO_PREPHASE: provided_no_prephase = true; break;
+                case OPT_JIT: provided_jit = true; break;
+                case OPT_KERNEL: provided_kernel = true; break;
+                case OPT_ESCALATE: provided_escalate = true; break;
+                case OPT_NO_MEMO: provided_no_memo = true; break;
             }
         }
         
@@ -368,6 +486,15 @@ config_t* create_cads_config_from_cli(int argc, char* argv[]) {
         }
         if (provided_max_solutions) file_config->max_solutions = cli_max_solutions;
         if (provided_progress_interval) file_config->progress_interval = cli_progress_interval;
+        if (provided_state_cache_mb) file_config->state_cache_mb = cli_state_cache_mb;
+        if (provided_strategy) file_config->strategy = cli_strategy;
+        if (provided_mitm_depth) file_config->mitm_depth = cli_mitm_depth;
+        if (provided_chain_constants) file_config->chain_constants = cli_chain_constants;
+        if (provided_no_prephase) file_config->algebraic_prephase = cli_algebraic_prephase;
+        if (provided_jit) file_config->jit = cli_jit;
+        if (provided_kernel) file_config->kernel = cli_kernel;
+        if (provided_escalate) file_config->escalate = cli_escalate;
+        if (provided_no_memo) file_config->memo = cli_memo;
         
         free_cads_config(config);
         return file_config;
@@ -19,7 +19,17 @@ config_t create_default_search_config(void) {
         .custom_operations = NULL,
         .custom_operation_count = 0,
         .dataset = NULL,
-        .threads = 1
+        .threads = 1,
+        .state_cache_mb = 64,
+        .strategy = STRATEGY_EXHAUSTIVE,
+        .mitm_depth = 6,
+        .chain_constants = 1,
+        .algebraic_prephase = true,
+        .jit = false,
+        .kernel = KERNEL_AUTO,
+        .escalate = false,
+        .covered_operations = 0,
+        .memo = false
     };
     return config;
 }
@@ -112,6 +122,9 @@ bool validate_search_config(const config_t* config) {
     if (config->max_constants < 1 || config->max_constants > CADS_MAX_CONSTANTS) return false;
     if (config->checksum_size < 1 || config->checksum_size > CADS_MAX_CHECKSUM_SIZE) return false;
     if (config->progress_interval < 10) return false;  // Minimum 10ms
+    if (config->strategy == STRATEGY_MITM &&
+        (config->mitm_depth < 2 || config->mitm_depth > CADS_MAX_SOLUTION_OPS)) return false;
+    if (config->chain_constants < 1 || config->chain_constants > CADS_MAX_CHAIN_CONSTANTS) return false;
     
     if (config->custom_operation_count > 0) {
         if (!config->custom_operations) return false;
@@ -0,0 +1,101 @@
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/checksum_engine.h"
+#include "../../src/utils/config.h"
+#include "../../src/core/packet_data.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+// 4-byte frames with a 2-byte checksum built by checksum(data)
+static packet_dataset_t* create_dataset(frame_checksum_t checksum) {
+    return create_random_dataset(77, 4, 24, checksum, 2);
+}
+
+static config_t create_bytes_config(packet_dataset_t* dataset) {
+    config_t cfg = create_default_search_config();
+    cfg.dataset = dataset;
+    cfg.checksum_size = 2;
+    cfg.complexity = COMPLEXITY_BASIC;
+    cfg.max_fields = 2;
+    cfg.strategy = STRATEGY_BYTES;
+    cfg.threads = 2;
+    disable_early_exit(&cfg);
+    return cfg;
+}
+
+static bool has_solution(const search_results_t* results, uint8_t bytes, operation_t op, uint8_t f0, uint8_t f1) {
+    for (size_t i = 0; i < results->solution_count; i++) {
+        const checksum_solution_t* s = &results->solutions[i];
+        if (s->checksum_bytes == bytes && s->field_count == 2 && s->field_indices[0] == f0 &&
+            s->field_indices[1] == f1 && s->operation_count >= 1 && s->operations[0] == op) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static size_t count_covering(const search_results_t* results, uint8_t bytes) {
+    size_t count = 0;
+    for (size_t i = 0; i < results->solution_count; i++) {
+        count += results->solutions[i].checksum_bytes == bytes;
+    }
+    return count;
+}
+
+// High byte b0 + b2, low byte b1 ^ b3
+static uint64_t sum_xor_pair(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint16_t)(((uint8_t)(data[0] + data[2]) << 8) | (data[1] ^ data[3]));
+}
+
+// 16-bit sum of two big-endian words; the high byte takes the low byte's carry
+static uint64_t word_sum(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint16_t)(((data[0] << 8) | data[1]) + ((data[2] << 8) | data[3]));
+}
+
+// Test that independent checksum bytes are each solved as 1-byte problems
+void test_independent_bytes(void) {
+    packet_dataset_t* dataset = create_dataset(sum_xor_pair);
+    config_t config = create_bytes_config(dataset);
+    search_results_t* results = create_search_results(16);
+
+    TEST_ASSERT(execute_byte_lane_search(&config, results));
+    TEST_ASSERT(has_solution(results, 0x1, OP_XOR, 1, 3));
+    TEST_ASSERT(has_solution(results, 0x2, OP_ADD, 0, 2));
+    TEST_ASSERT_EQUAL(0, (int)count_covering(results, 0x3));
+    TEST_ASSERT(results->search_completed);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Test that a byte needing a carry falls back to the joint wide search
+void test_carry_needs_joint_search(void) {
+    packet_dataset_t* dataset = create_dataset(word_sum);
+    config_t config = create_bytes_config(dataset);
+    search_results_t* results = create_search_results(16);
+
+    TEST_ASSERT(execute_byte_lane_search(&config, results));
+    TEST_ASSERT(has_solution(results, 0x1, OP_ADD, 1, 3));
+    TEST_ASSERT_EQUAL(0, (int)count_covering(results, 0x2));
+    TEST_ASSERT(has_solution(results, 0x3, OP_ADD, 0, 2));
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_independent_bytes);
+    RUN_TEST(test_carry_needs_joint_search);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,156 @@
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/checksum_engine.h"
+#include "../../src/utils/config.h"
+#include "../../src/core/packet_data.h"
+#include "../../src/core/crc_recovery.h"
+
+static const crc_model_t crc16_ccitt_false = {.width = 16, .poly = 0x1021, .init = 0xFFFF};
+static const crc_model_t crc32_iso_hdlc = {.width = 32, .poly = 0x04C11DB7, .init = 0xFFFFFFFF, .xorout = 0xFFFFFFFF,
+                                          .refin = true, .refout = true};
+static const crc_model_t crc16_arc = {.width = 16, .poly = 0x8005, .refin = true, .refout = true};
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+// Frames of min_length..min_length+3 bytes with a constant 0x7E header byte
+static packet_dataset_t* create_crc_dataset(const crc_model_t* model, size_t checksum_size, size_t min_length,
+                                            bool variable_length) {
+    packet_dataset_t* dataset = create_packet_dataset(48);
+    uint32_t seed = 4242;
+    for (int i = 0; i < 48; i++) {
+        uint8_t data[32];
+        size_t length = min_length + (variable_length ? (size_t)(i % 4) : 0);
+        data[0] = 0x7E;
+        fill_random_bytes(&seed, data + 1, length - 1);
+        add_packet_from_bytes(dataset, data, length, crc_model_compute(model, data, length), checksum_size, "synthetic");
+    }
+    return dataset;
+}
+
+static config_t create_crc_config(packet_dataset_t* dataset, size_t checksum_size) {
+    config_t cfg = create_default_search_config();
+    cfg.dataset = dataset;
+    cfg.checksum_size = checksum_size;
+    cfg.strategy = STRATEGY_CRC;
+    cfg.threads = 2;
+    disable_early_exit(&cfg);
+    return cfg;
+}
+
+static const crc_model_t* find_model(const search_results_t* results, int width, uint64_t poly, bool refin) {
+    for (size_t i = 0; i < results->crc_model_count; i++) {
+        const crc_model_t* m = &results->crc_models[i];
+        if (m->width == width && m->poly == poly && m->refin == refin) return m;
+    }
+    return NULL;
+}
+
+// Test the reference implementation against the published check values
+void test_reference_check_values(void) {
+    const uint8_t check[] = "123456789";
+    TEST_ASSERT_EQUAL(0x29B1, (int)crc_model_compute(&crc16_ccitt_false, check, 9));
+    TEST_ASSERT_EQUAL(0xBB3D, (int)crc_model_compute(&crc16_arc, check, 9));
+    TEST_ASSERT(crc_model_compute(&crc32_iso_hdlc, check, 9) == 0xCBF43926u);
+}
+
+// Test recovery of an unreflected CRC-16 with init from variable-length frames. Its generator
+// has an (x + 1) factor, so the lengths leave one init bit open and the 0xFFFF/0x0000 convention decides.
+void test_recovers_crc16_with_init(void) {
+    packet_dataset_t* dataset = create_crc_dataset(&crc16_ccitt_false, 2, 12, true);
+    config_t cfg = create_crc_config(dataset, 2);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_crc_recovery_search(&cfg, results));
+    const crc_model_t* m = find_model(results, 16, 0x1021, false);
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT_EQUAL(0, (int)m->data_start);
+    TEST_ASSERT_EQUAL(0, (int)m->data_end_trim);
+    TEST_ASSERT_EQUAL(0xFFFF, (int)m->init);
+    TEST_ASSERT_EQUAL(0x0000, (int)m->xorout);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Test a reflected CRC-32 over a data range that skips a trailer byte
+void test_recovers_reflected_crc32_range(void) {
+    crc_model_t model = crc32_iso_hdlc;
+    model.data_end_trim = 1;
+    packet_dataset_t* dataset = create_crc_dataset(&model, 4, 16, true);
+    config_t cfg = create_crc_config(dataset, 4);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_crc_recovery_search(&cfg, results));
+    const crc_model_t* m = find_model(results, 32, 0x04C11DB7, true);
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT(m->refout);
+    TEST_ASSERT_EQUAL(1, (int)m->data_end_trim);
+    TEST_ASSERT(m->init == 0xFFFFFFFFu);
+    TEST_ASSERT(m->xorout == 0xFFFFFFFFu);
+    TEST_ASSERT(!m->init_ambiguous);
+    TEST_ASSERT(crc_model_matches_dataset(m, dataset));
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Test that a single frame length leaves init/xorout ambiguous but still yields a valid model
+void test_single_length_is_ambiguous(void) {
+    const crc_model_t crc8 = {.width = 8, .poly = 0x07, .xorout = 0x55};
+    packet_dataset_t* dataset = create_crc_dataset(&crc8, 1, 10, false);
+    config_t cfg = create_crc_config(dataset, 1);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_crc_recovery_search(&cfg, results));
+    const crc_model_t* m = find_model(results, 8, 0x07, false);
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT(m->init_ambiguous);
+    TEST_ASSERT(crc_model_matches_dataset(m, dataset));
+    TEST_ASSERT(find_model(results, 16, 0x1021, false) == NULL);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Test that the catalogue sweep names a standard CRC whose header is too long for recovery
+void test_catalogue_finds_long_header(void) {
+    const crc_model_t modbus = {.width = 16, .poly = 0x8005, .init = 0xFFFF, .refin = true, .refout = true};
+    packet_dataset_t* dataset = create_packet_dataset(16);
+    uint32_t seed = 99;
+    for (int i = 0; i < 16; i++) {
+        uint8_t data[56];
+        fill_random_bytes(&seed, data, sizeof(data));
+        add_packet_from_bytes(dataset, data, sizeof(data), crc_model_compute(&modbus, data + 40, 16), 2, "synthetic");
+    }
+    config_t cfg = create_crc_config(dataset, 2);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_crc_recovery_search(&cfg, results));
+    const crc_model_t* m = find_model(results, 16, 0x8005, true);
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT_NOT_NULL(m->name);
+    TEST_ASSERT_EQUAL_STRING("CRC-16/MODBUS", m->name);
+    TEST_ASSERT_EQUAL(40, (int)m->data_start);
+    TEST_ASSERT_EQUAL(0, (int)m->data_end_trim);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_reference_check_values);
+    RUN_TEST(test_recovers_crc16_with_init);
+    RUN_TEST(test_recovers_reflected_crc32_range);
+    RUN_TEST(test_single_length_is_ambiguous);
+    RUN_TEST(test_catalogue_finds_long_header);
+
+    return TEST_SUMMARY();
+}
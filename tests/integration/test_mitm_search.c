@@ -0,0 +1,117 @@
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/checksum_engine.h"
+#include "../../include/sequence_evaluator.h"
+#include "../../src/utils/config.h"
+#include "../../src/core/packet_data.h"
+
+#define MITM_TEST_CONSTANT 0x2A
+
+static uint8_t rotl8(uint8_t v, int n) {
+    n &= 7;
+    return n ? (uint8_t)((v << n) | (v >> (8 - n))) : v;
+}
+
+// ROTL(((b0 + b1) ^ b2) + K, b3) - K: a depth-5 chain over four fields
+static uint64_t depth5_checksum(const uint8_t* data, size_t length) {
+    (void)length;
+    uint8_t value = (uint8_t)(((uint8_t)(data[0] + data[1]) ^ data[2]) + MITM_TEST_CONSTANT);
+    return (uint8_t)(rotl8(value, data[3]) - MITM_TEST_CONSTANT);
+}
+
+static packet_dataset_t* create_depth5_dataset(void) {
+    return create_random_dataset(12345, 5, 16, depth5_checksum, 1);
+}
+
+static bool is_full_length_chain(const checksum_solution_t* s, int depth) {
+    if (s->operation_count != depth) return false;
+    int field_ops = 0;
+    for (int o = 0; o < s->operation_count; o++) {
+        if (get_operation_operand_kind(s->operations[o]) == OPERAND_FIELD) field_ops++;
+    }
+    return field_ops <= s->field_count - 1;
+}
+
+static bool same_solution(const checksum_solution_t* A, const checksum_solution_t* B) {
+    if (A->field_count != B->field_count || A->operation_count != B->operation_count) return false;
+    if (A->constant != B->constant) return false;
+    for (int f = 0; f < A->field_count; f++) if (A->field_indices[f] != B->field_indices[f]) return false;
+    for (int o = 0; o < A->operation_count; o++) if (A->operations[o] != B->operations[o]) return false;
+    return true;
+}
+
+static config_t create_depth5_config(packet_dataset_t* dataset) {
+    static operation_t ops[] = {OP_ADD, OP_SUB, OP_XOR, OP_CONST_ADD, OP_CONST_SUB, OP_ROTLEFT};
+    config_t cfg = create_custom_operation_config(ops, 6);
+    cfg.dataset = dataset;
+    cfg.max_fields = 4;
+    cfg.max_constants = 64;
+    cfg.threads = 2;
+    cfg.progress_interval = 20;
+    disable_early_exit(&cfg);
+    return cfg;
+}
+
+void test_mitm_finds_depth5_chain(void) {
+    packet_dataset_t* dataset = create_depth5_dataset();
+    config_t cfg = create_depth5_config(dataset);
+    cfg.strategy = STRATEGY_MITM;
+    cfg.mitm_depth = 5;
+
+    search_results_t* results = create_search_results(8);
+    TEST_ASSERT(execute_mitm_checksum_search(&cfg, results));
+    TEST_ASSERT(results->solution_count > 0);
+    TEST_ASSERT(results->mitm_table_bytes > 0);
+
+    bool found = false;
+    for (size_t i = 0; i < results->solution_count; i++) {
+        const checksum_solution_t* s = &results->solutions[i];
+        TEST_ASSERT_EQUAL(5, s->operation_count);
+        if (s->operations[0] == OP_ADD && s->operations[1] == OP_XOR && s->operations[2] == OP_CONST_ADD &&
+            s->operations[3] == OP_ROTLEFT && s->operations[4] == OP_CONST_SUB &&
+            s->constant == MITM_TEST_CONSTANT) {
+            found = true;
+        }
+    }
+    TEST_ASSERT(found);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Every depth-5 chain the exhaustive engine finds without running out of fields
+// must be reported by the meet-in-the-middle search, and nothing else
+void test_mitm_matches_exhaustive(void) {
+    packet_dataset_t* dataset = create_depth5_dataset();
+    config_t cfg = create_depth5_config(dataset);
+
+    search_results_t* exhaustive = create_search_results(8);
+    TEST_ASSERT(execute_weighted_checksum_search(&cfg, exhaustive, NULL));
+    sort_search_solutions(exhaustive);
+
+    cfg.strategy = STRATEGY_MITM;
+    cfg.mitm_depth = 5;
+    search_results_t* mitm = create_search_results(8);
+    TEST_ASSERT(execute_mitm_checksum_search(&cfg, mitm));
+
+    size_t matched = 0;
+    for (size_t i = 0; i < exhaustive->solution_count; i++) {
+        const checksum_solution_t* expected = &exhaustive->solutions[i];
+        if (!is_full_length_chain(expected, 5)) continue;
+        TEST_ASSERT(matched < mitm->solution_count);
+        TEST_ASSERT(same_solution(expected, &mitm->solutions[matched]));
+        matched++;
+    }
+    TEST_ASSERT_EQUAL(mitm->solution_count, matched);
+
+    free_search_results(exhaustive);
+    free_search_results(mitm);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+    RUN_TEST(test_mitm_finds_depth5_chain);
+    RUN_TEST(test_mitm_matches_exhaustive);
+    return TEST_SUMMARY();
+}
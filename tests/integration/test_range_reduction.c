@@ -0,0 +1,108 @@
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/checksum_engine.h"
+#include "../../src/utils/config.h"
+#include "../../src/core/packet_data.h"
+#include "../../src/core/range_reduction.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+static config_t create_range_config(packet_dataset_t* dataset, size_t checksum_size) {
+    config_t cfg = create_default_search_config();
+    cfg.dataset = dataset;
+    cfg.checksum_size = checksum_size;
+    cfg.strategy = STRATEGY_RANGE;
+    cfg.threads = 4;
+    disable_early_exit(&cfg);
+    return cfg;
+}
+
+static const range_model_t* find_model(const search_results_t* results, range_reduction_t reduction,
+                                       range_finaliser_t finaliser, uint64_t constant) {
+    for (size_t i = 0; i < results->range_model_count; i++) {
+        const range_model_t* m = &results->range_models[i];
+        if (m->reduction == reduction && m->finaliser == finaliser && m->constant == constant) return m;
+    }
+    return NULL;
+}
+
+// Frames of min_length..min_length+3 bytes, checksummed by model
+static packet_dataset_t* create_range_dataset(const range_model_t* model, size_t checksum_size, size_t min_length) {
+    packet_dataset_t* dataset = create_packet_dataset(24);
+    static uint8_t data[1100];
+    uint32_t seed = 99;
+    for (int i = 0; i < 24; i++) {
+        size_t length = min_length + (size_t)(i % 4);
+        fill_random_bytes(&seed, data, length);
+        add_packet_from_bytes(dataset, data, length, range_model_compute(model, data, length, checksum_size),
+                              checksum_size, "range");
+    }
+    return dataset;
+}
+
+// Test the reference implementation against published values
+void test_reference_values(void) {
+    range_model_t fletcher = {RANGE_FLETCHER16, RANGE_FINAL_ADD, 0, 0, 0};
+    range_model_t adler = {RANGE_ADLER32, RANGE_FINAL_ADD, 0, 0, 0};
+    range_model_t internet = {RANGE_INTERNET, RANGE_FINAL_XOR, 0xFFFF, 0, 0};
+    const uint8_t rfc1071[] = {0x00, 0x01, 0xF2, 0x03, 0xF4, 0xF5, 0xF6, 0xF7};
+
+    TEST_ASSERT_EQUAL(0xC8F0, (int)range_model_compute(&fletcher, (const uint8_t*)"abcde", 5, 2));
+    TEST_ASSERT(range_model_compute(&adler, (const uint8_t*)"Wikipedia", 9, 4) == 0x11E60398u);
+    TEST_ASSERT_EQUAL(0x220D, (int)range_model_compute(&internet, rfc1071, sizeof(rfc1071), 2));
+}
+
+// Test that an Internet checksum over 1024-byte frames behind a 4-byte header is found
+void test_internet_checksum_full_frames(void) {
+    range_model_t truth = {RANGE_INTERNET, RANGE_FINAL_XOR, 0xFFFF, 4, 0};
+    packet_dataset_t* dataset = create_range_dataset(&truth, 2, 1024);
+    config_t config = create_range_config(dataset, 2);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_range_reduction_search(&config, results));
+    const range_model_t* found = find_model(results, RANGE_INTERNET, RANGE_FINAL_XOR, 0xFFFF);
+    TEST_ASSERT_NOT_NULL(found);
+    TEST_ASSERT_EQUAL(4, (int)found->data_start);
+    TEST_ASSERT_EQUAL(0, (int)found->data_end_trim);
+    TEST_ASSERT_NULL(find_model(results, RANGE_INTERNET, RANGE_FINAL_NEG_ADD, 0xFFFF));  // Same as XOR 0xFFFF
+    for (size_t i = 0; i < results->range_model_count; i++) {
+        TEST_ASSERT(range_model_matches_dataset(&results->range_models[i], dataset, 2));
+    }
+    TEST_ASSERT(results->search_completed);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+// Test a Fletcher-16 that skips a header byte and a trailer byte, plus a constant
+void test_fletcher_with_trailer(void) {
+    range_model_t truth = {RANGE_FLETCHER16, RANGE_FINAL_ADD, 0x1234, 1, 1};
+    packet_dataset_t* dataset = create_range_dataset(&truth, 2, 20);
+    config_t config = create_range_config(dataset, 2);
+    search_results_t* results = create_search_results(4);
+
+    TEST_ASSERT(execute_range_reduction_search(&config, results));
+    const range_model_t* found = find_model(results, RANGE_FLETCHER16, RANGE_FINAL_ADD, 0x1234);
+    TEST_ASSERT_NOT_NULL(found);
+    TEST_ASSERT_EQUAL(1, (int)found->data_start);
+    TEST_ASSERT_EQUAL(1, (int)found->data_end_trim);
+
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_reference_values);
+    RUN_TEST(test_internet_checksum_full_frames);
+    RUN_TEST(test_fletcher_with_trailer);
+
+    return TEST_SUMMARY();
+}
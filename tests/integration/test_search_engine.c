@@ -1,10 +1,12 @@
 /* Integration test for search engine with custom operations */
 
 #include "../unity.h"
+#include "../test_data.h"
 #include "../../include/checksum_engine.h"
 #include "../../src/core/packet_data.h"
 #include "../../src/core/progress_tracker.h" // retained for potential future assertions
 #include "../../src/utils/config.h"
+#include <unistd.h>
 
 void setUp(void) {
     // No setup needed - search engine initializes its own registry
@@ -141,6 +143,273 @@ void test_early_exit_conditions(void) {
     TEST_ASSERT(!should_continue_search(&results, &config));
 }
 
+static uint64_t sum_xor_a7(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)(data[1] + data[3]) ^ 0xA7;
+}
+
+// Test that the bit-serial T-function constant solver reports the same solutions as
+// the constant-bitmap solver, which a non-T-function op (MUL) forces
+void test_t_function_kernel_equivalence(void) {
+    packet_dataset_t* dataset = create_random_dataset(5, 4, 16, sum_xor_a7, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t t_ops[] = {OP_ADD, OP_XOR, OP_CONST_XOR, OP_CONST_SUB, OP_IDENTITY};
+    operation_t mixed_ops[] = {OP_ADD, OP_XOR, OP_CONST_XOR, OP_CONST_SUB, OP_IDENTITY, OP_MUL};
+    search_results_t* results[2];
+    for (int run = 0; run < 2; run++) {
+        config_t config = run == 0 ? create_custom_operation_config(t_ops, 5)
+                                   : create_custom_operation_config(mixed_ops, 6);
+        config.dataset = dataset;
+        config.max_fields = 2;
+        config.max_constants = 200;
+        config.threads = 1;
+        disable_early_exit(&config);
+        results[run] = create_search_results(16);
+        TEST_ASSERT(execute_weighted_checksum_search(&config, results[run], NULL));
+    }
+
+    // Drop the MUL chains and compare the rest
+    size_t kept = 0;
+    for (size_t i = 0; i < results[1]->solution_count; i++) {
+        checksum_solution_t* solution = &results[1]->solutions[i];
+        bool uses_mul = false;
+        for (int op = 0; op < solution->operation_count; op++) uses_mul |= solution->operations[op] == OP_MUL;
+        if (!uses_mul) results[1]->solutions[kept++] = *solution;
+    }
+    results[1]->solution_count = kept;
+
+    TEST_ASSERT(results[0]->solution_count > 0);
+    TEST_ASSERT_EQUAL(results[1]->solution_count, results[0]->solution_count);
+    bool found_constant = false;
+    for (size_t i = 0; i < results[0]->solution_count; i++) {
+        checksum_solution_t* a = &results[0]->solutions[i];
+        checksum_solution_t* b = &results[1]->solutions[i];
+        TEST_ASSERT_EQUAL(a->field_count, b->field_count);
+        for (int f = 0; f < a->field_count; f++) TEST_ASSERT_EQUAL(a->field_indices[f], b->field_indices[f]);
+        TEST_ASSERT_EQUAL(a->operation_count, b->operation_count);
+        for (int op = 0; op < a->operation_count; op++) TEST_ASSERT_EQUAL(a->operations[op], b->operations[op]);
+        TEST_ASSERT_EQUAL(a->constant, b->constant);
+        found_constant |= a->constant == 0xA7;
+    }
+    TEST_ASSERT(found_constant);
+
+    free_search_results(results[0]);
+    free_search_results(results[1]);
+    free_packet_dataset(dataset);
+}
+
+static uint64_t sum_add_3c_xor_a7(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)(data[1] + data[3] + 0x3C) ^ 0xA7;
+}
+
+// Test that each constant op gets its own constant with --chain-constants 2, on both the
+// bit-serial path and the enumerate-then-peel path
+void test_independent_chain_constants(void) {
+    packet_dataset_t* dataset = create_random_dataset(11, 4, 16, sum_add_3c_xor_a7, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t t_ops[] = {OP_ADD, OP_CONST_ADD, OP_CONST_XOR, OP_IDENTITY};
+    operation_t mixed_ops[] = {OP_ADD, OP_CONST_ADD, OP_CONST_XOR, OP_IDENTITY, OP_MUL};
+    for (int run = 0; run < 2; run++) {
+        config_t config = run == 0 ? create_custom_operation_config(t_ops, 4)
+                                   : create_custom_operation_config(mixed_ops, 5);
+        config.dataset = dataset;
+        config.max_fields = 2;
+        config.chain_constants = 2;
+        config.threads = 1;
+        disable_early_exit(&config);
+        search_results_t* results = create_search_results(16);
+        TEST_ASSERT(execute_weighted_checksum_search(&config, results, NULL));
+
+        bool found = false;
+        for (size_t i = 0; i < results->solution_count; i++) {
+            checksum_solution_t* solution = &results->solutions[i];
+            if (solution->operation_count == 3 && solution->operations[1] == OP_CONST_ADD &&
+                solution->operations[2] == OP_CONST_XOR) {
+                TEST_ASSERT_EQUAL(1, solution->extra_constant_count);
+                found |= solution->constant == 0x3C && solution->extra_constants[0] == 0xA7;
+            }
+        }
+        TEST_ASSERT(found);
+        free_search_results(results);
+    }
+    free_packet_dataset(dataset);
+}
+
+// (f0 ^ f2) rotl f5 over big-endian 16-bit fields
+static uint64_t rotl16_fields(const uint8_t* data, size_t length) {
+    (void)length;
+    uint16_t value = (uint16_t)(((data[0] << 8) | data[1]) ^ ((data[2] << 8) | data[3]));
+    unsigned shift = (unsigned)(((data[5] << 8) | data[6]) & 0x3F) % 16;
+    return shift ? (uint16_t)((value << shift) | (value >> (16 - shift))) : value;
+}
+
+// Test that ROTL on a 2-byte checksum rotates all 16 bits: ((f0 ^ f2) rotl f5) over
+// big-endian 16-bit fields, which the byte-wide rotate cannot produce
+void test_rotate_at_checksum_width(void) {
+    packet_dataset_t* dataset = create_random_dataset(29, 8, 24, rotl16_fields, 2);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t ops[] = {OP_ADD, OP_XOR, OP_ROTLEFT, OP_ROTRIGHT};
+    config_t config = create_custom_operation_config(ops, 4);
+    config.dataset = dataset;
+    config.checksum_size = 2;
+    config.max_fields = 3;
+    config.max_constants = 1;
+    config.threads = 1;
+    disable_early_exit(&config);
+    search_results_t* results = create_search_results(16);
+    TEST_ASSERT(execute_weighted_checksum_search(&config, results, NULL));
+
+    bool found = false;
+    for (size_t i = 0; i < results->solution_count; i++) {
+        const checksum_solution_t* solution = &results->solutions[i];
+        found |= solution->field_count == 3 && solution->field_indices[2] == 5 &&
+                 solution->operation_count >= 2 && solution->operations[0] == OP_XOR &&
+                 solution->operations[1] == OP_ROTLEFT;
+    }
+    TEST_ASSERT(found);
+    free_search_results(results);
+    free_packet_dataset(dataset);
+}
+
+static search_results_t* run_complexity_search(packet_dataset_t* dataset, complexity_level_t complexity,
+                                               bool escalate, bool memo) {
+    config_t config = create_default_search_config();
+    config.dataset = dataset;
+    config.complexity = complexity;
+    config.max_fields = 2;
+    config.max_constants = 4;
+    config.threads = 1;
+    config.escalate = escalate;
+    config.memo = memo;
+    disable_early_exit(&config);
+    search_results_t* results = create_search_results(16);
+    TEST_ASSERT_NOT_NULL(results);
+    TEST_ASSERT(escalate ? execute_escalating_checksum_search(&config, results, NULL)
+                         : execute_weighted_checksum_search(&config, results, NULL));
+    sort_search_solutions(results);
+    return results;
+}
+
+static uint64_t not_sum_02(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)~(data[0] + data[2]);
+}
+
+static uint64_t xor_02(const uint8_t* data, size_t length) {
+    (void)length;
+    return data[0] ^ data[2];
+}
+
+// Test that --escalate costs what the top level alone costs and finds the same chains
+// when the lower level fails, and that it stops at the first level with a solution
+void test_complexity_escalation(void) {
+    for (int run = 0; run < 2; run++) {
+        // NOT needs an intermediate op; XOR is found at basic
+        packet_dataset_t* dataset = create_random_dataset(5, 4, 16, run == 0 ? not_sum_02 : xor_02, 1);
+        TEST_ASSERT_NOT_NULL(dataset);
+
+        search_results_t* ladder = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, true, false);
+        search_results_t* single = run_complexity_search(dataset, run == 0 ? COMPLEXITY_INTERMEDIATE
+                                                                           : COMPLEXITY_BASIC, false, false);
+        TEST_ASSERT(ladder->solution_count > 0);
+        TEST_ASSERT(ladder->tests_performed == single->tests_performed);
+        TEST_ASSERT_EQUAL(single->solution_count, ladder->solution_count);
+        for (size_t i = 0; i < single->solution_count; i++) {
+            TEST_ASSERT_EQUAL(single->solutions[i].operation_count, ladder->solutions[i].operation_count);
+            TEST_ASSERT(memcmp(single->solutions[i].operations, ladder->solutions[i].operations,
+                               sizeof(single->solutions[i].operations)) == 0);
+            TEST_ASSERT(memcmp(single->solutions[i].field_indices, ladder->solutions[i].field_indices,
+                               sizeof(single->solutions[i].field_indices)) == 0);
+        }
+        free_search_results(ladder);
+        free_search_results(single);
+        free_packet_dataset(dataset);
+    }
+}
+
+static uint64_t xor_13(const uint8_t* data, size_t length) {
+    (void)length;
+    return data[1] ^ data[3];
+}
+
+// Sixteen random frames whose checksum is the XOR of bytes 1 and 3
+static packet_dataset_t* create_xor_dataset(void) {
+    packet_dataset_t* dataset = create_random_dataset(11, 4, 16, xor_13, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+    return dataset;
+}
+
+// Point the memo store at an empty file of this test run
+static void use_test_memo_file(char* path, size_t size) {
+    snprintf(path, size, "/tmp/cads_test_memo_%ld.bin", (long)getpid());
+    remove(path);
+    setenv("CADS_MEMO_FILE", path, 1);
+}
+
+static void assert_same_solutions(const search_results_t* expected, const search_results_t* actual) {
+    TEST_ASSERT_EQUAL(expected->solution_count, actual->solution_count);
+    for (size_t i = 0; i < expected->solution_count; i++) {
+        TEST_ASSERT_EQUAL(expected->solutions[i].constant, actual->solutions[i].constant);
+        TEST_ASSERT(memcmp(expected->solutions[i].operations, actual->solutions[i].operations,
+                           sizeof(expected->solutions[i].operations)) == 0);
+        TEST_ASSERT(memcmp(expected->solutions[i].field_indices, actual->solutions[i].field_indices,
+                           sizeof(expected->solutions[i].field_indices)) == 0);
+    }
+}
+
+// Test that a search over a dataset the memo store has seen tests only the chains no
+// earlier search covered, replays the rest, and reports what a fresh search reports
+void test_memo_reuse(void) {
+    char memo_path[64];
+    use_test_memo_file(memo_path, sizeof(memo_path));
+    packet_dataset_t* dataset = create_xor_dataset();
+
+    search_results_t* fresh = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, false);
+    search_results_t* basic = run_complexity_search(dataset, COMPLEXITY_BASIC, false, true);
+    search_results_t* reused = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, true);
+    search_results_t* repeated = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, true);
+    TEST_ASSERT(fresh->solution_count > 0);
+    TEST_ASSERT(reused->memo_solutions_replayed > 0);
+    TEST_ASSERT(reused->tests_performed == fresh->tests_performed - basic->tests_performed);
+    TEST_ASSERT(repeated->tests_performed == 0);
+    assert_same_solutions(fresh, reused);
+    assert_same_solutions(fresh, repeated);
+    free_search_results(fresh);
+    free_search_results(basic);
+    free_search_results(reused);
+    free_search_results(repeated);
+    free_packet_dataset(dataset);
+    unsetenv("CADS_MEMO_FILE");
+    remove(memo_path);
+}
+
+// Test that appending packets re-checks the remembered solutions instead of searching again
+void test_memo_appended_packets(void) {
+    char memo_path[64];
+    use_test_memo_file(memo_path, sizeof(memo_path));
+    packet_dataset_t* dataset = create_xor_dataset();
+
+    search_results_t* fresh = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, false);
+    dataset->count = 2;
+    search_results_t* first_batch = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, true);
+    dataset->count = 16;
+    search_results_t* appended = run_complexity_search(dataset, COMPLEXITY_INTERMEDIATE, false, true);
+    TEST_ASSERT(first_batch->solution_count > fresh->solution_count);
+    TEST_ASSERT(appended->tests_performed == 0);
+    TEST_ASSERT(appended->memo_solutions_dropped > 0);
+    assert_same_solutions(fresh, appended);
+    free_search_results(fresh);
+    free_search_results(first_batch);
+    free_search_results(appended);
+    free_packet_dataset(dataset);
+    unsetenv("CADS_MEMO_FILE");
+    remove(memo_path);
+}
+
 int main(void) {
     TEST_SETUP();
     
@@ -148,6 +417,12 @@ int main(void) {
     RUN_TEST(test_standard_complexity_search);
     RUN_TEST(test_search_results_validation);
     RUN_TEST(test_early_exit_conditions);
+    RUN_TEST(test_t_function_kernel_equivalence);
+    RUN_TEST(test_independent_chain_constants);
+    RUN_TEST(test_rotate_at_checksum_width);
+    RUN_TEST(test_complexity_escalation);
+    RUN_TEST(test_memo_reuse);
+    RUN_TEST(test_memo_appended_packets);
     
     return TEST_SUMMARY();
 }
@@ -1,4 +1,5 @@
 #include "../unity.h"
+#include "../test_data.h"
 #include "../../include/checksum_engine.h"
 #include "../../src/utils/config.h"
 #include "../../src/core/packet_data.h"
@@ -13,6 +14,53 @@ static void collect_solutions(config_t base, int threads, search_results_t** out
     *out_results = results;
 }
 
+static void assert_same_solutions(const search_results_t* a, const search_results_t* b) {
+    TEST_ASSERT_EQUAL(a->solution_count, b->solution_count);
+    size_t n = a->solution_count;
+    for (size_t i=0;i<n;i++) {
+        checksum_solution_t *A=&a->solutions[i];
+        checksum_solution_t *B=&b->solutions[i];
+        TEST_ASSERT_EQUAL(A->field_count, B->field_count);
+        for (int f=0; f<A->field_count; f++) TEST_ASSERT_EQUAL(A->field_indices[f], B->field_indices[f]);
+        TEST_ASSERT_EQUAL(A->operation_count, B->operation_count);
+        for (int o=0;o<A->operation_count;o++) TEST_ASSERT_EQUAL(A->operations[o], B->operations[o]);
+        TEST_ASSERT_EQUAL(A->constant, B->constant);
+    }
+}
+
+static config_t create_equivalence_config(packet_dataset_t* dataset, operation_t* ops, int op_count,
+                                          int max_constants) {
+    config_t cfg = create_custom_operation_config(ops, op_count);
+    cfg.dataset = dataset;
+    cfg.max_fields = 3;
+    cfg.max_constants = max_constants;
+    cfg.threads = 2;
+    disable_early_exit(&cfg);
+    return cfg;
+}
+
+// Run the search once per config, each with its own thread count, and check that every
+// later run reports the chains of the first after dropping the ones keep rejects (keep may
+// be NULL). Results land in out for the test's own checks.
+static void compare_runs(const config_t* configs, int count, bool (*keep)(const checksum_solution_t*),
+                         search_results_t** out) {
+    for (int r = 0; r < count; r++) collect_solutions(configs[r], configs[r].threads, &out[r]);
+    for (int r = 1; r < count; r++) {
+        if (keep) {
+            size_t kept = 0;
+            for (size_t i = 0; i < out[r]->solution_count; i++) {
+                if (keep(&out[r]->solutions[i])) out[r]->solutions[kept++] = out[r]->solutions[i];
+            }
+            out[r]->solution_count = kept;
+        }
+        assert_same_solutions(out[0], out[r]);
+    }
+}
+
+static void free_runs(search_results_t** runs, int count) {
+    for (int r = 0; r < count; r++) free_search_results(runs[r]);
+}
+
 void test_thread_equivalence_small_domain(void) {
     packet_dataset_t* dataset = create_packet_dataset(8);
     TEST_ASSERT_NOT_NULL(dataset);
@@ -47,8 +95,176 @@ void test_thread_equivalence_small_domain(void) {
     free_packet_dataset(dataset);
 }
 
+// ((b0 ^ b3) * b1) + 5
+static uint64_t xor_mul_add5(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)(((data[0] ^ data[3]) * (data[1] ? data[1] : 1)) + 5);
+}
+
+// --jit must find exactly what the interpreter finds, including ops it leaves to the interpreter
+void test_jit_equivalence(void) {
+    packet_dataset_t* dataset = create_random_dataset(1234, 6, 12, xor_mul_add5, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t ops[] = {OP_ADD, OP_XOR, OP_MUL, OP_LSHIFT, OP_NOT, OP_DIV, OP_CONST_ADD, OP_TWOS_COMPLEMENT};
+    config_t runs[2];
+    runs[0] = runs[1] = create_equivalence_config(dataset, ops, 8, 16);
+    runs[1].jit = true;
+
+    search_results_t* results[2];
+    compare_runs(runs, 2, NULL, results);
+    TEST_ASSERT(results[0]->solution_count > 0);
+    TEST_ASSERT(results[0]->tests_performed == results[1]->tests_performed);
+
+    free_runs(results, 2);
+    free_packet_dataset(dataset);
+}
+
+// ((b0 ^ b3) - b1) + 0x0B
+static uint64_t xor_sub_add0b(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)(((data[0] ^ data[3]) - data[1]) + 0x0B);
+}
+
+// The bit-sliced kernel must find exactly what the byte-wise one finds, over two full
+// groups of 64 packets and a partial one
+void test_bitsliced_kernel_equivalence(void) {
+    packet_dataset_t* dataset = create_random_dataset(4321, 6, 150, xor_sub_add0b, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t ops[] = {OP_ADD, OP_SUB, OP_XOR, OP_OR, OP_NOT, OP_NEGATE, OP_CONST_ADD, OP_TWOS_COMPLEMENT};
+    config_t runs[2];
+    runs[0] = runs[1] = create_equivalence_config(dataset, ops, 8, 16);
+    runs[0].kernel = KERNEL_BYTEWISE;
+    runs[1].kernel = KERNEL_BITSLICED;
+
+    search_results_t* results[2];
+    compare_runs(runs, 2, NULL, results);
+    TEST_ASSERT(results[0]->solution_count > 0);
+    TEST_ASSERT(results[0]->tests_performed == results[1]->tests_performed);
+
+    free_runs(results, 2);
+    free_packet_dataset(dataset);
+}
+
+// REVB(b1) ^ b4; REVB consumes a permutation slot
+static uint64_t reversed_xor(const uint8_t* data, size_t length) {
+    (void)length;
+    uint8_t reversed = 0;
+    for (int bit = 0; bit < 8; bit++) reversed |= ((data[1] >> bit) & 1) << (7 - bit);
+    return (uint8_t)(reversed ^ data[4]);
+}
+
+static bool without_rshift(const checksum_solution_t* solution) {
+    for (int o = 0; o < solution->operation_count; o++) {
+        if (solution->operations[o] == OP_RSHIFT) return false;
+    }
+    return true;
+}
+
+// Collapsing unary runs must not lose chains. Adding RSH turns the collapse off (its low
+// byte reads high bits), so the RSH-free solutions of that search are the reference.
+void test_unary_run_collapse_equivalence(void) {
+    packet_dataset_t* dataset = create_random_dataset(99, 6, 24, reversed_xor, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t ops[] = {OP_XOR, OP_ADD, OP_NOT, OP_NEGATE, OP_SWAP_NIBBLES, OP_REVERSE_BITS, OP_IDENTITY, OP_RSHIFT};
+    config_t runs[2];
+    runs[0] = create_equivalence_config(dataset, ops, 7, 4);
+    runs[1] = create_equivalence_config(dataset, ops, 8, 4);
+
+    search_results_t* results[2];
+    compare_runs(runs, 2, without_rshift, results);
+    TEST_ASSERT(results[0]->unary_runs_collapsed > 0);
+    TEST_ASSERT_EQUAL(0, results[1]->unary_runs_collapsed);
+    TEST_ASSERT(results[0]->solution_count > 0);
+
+    free_runs(results, 2);
+    free_packet_dataset(dataset);
+}
+
+// ~(b0 + 5)
+static uint64_t not_add5(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint8_t)~(data[0] + 5);
+}
+
+// Fields are chosen as the chain reads them, so a chain that stops reading early is still
+// reported once per ordering of the fields it left unread, and pruning credits every one
+void test_interleaved_field_orderings(void) {
+    packet_dataset_t* dataset = create_random_dataset(4242, 4, 16, not_add5, 1);
+    TEST_ASSERT_NOT_NULL(dataset);
+
+    operation_t ops[] = {OP_CONST_ADD, OP_ONES_COMPLEMENT, OP_XOR};
+    config_t runs[2];
+    runs[0] = runs[1] = create_equivalence_config(dataset, ops, 3, 8);
+    runs[0].threads = runs[1].threads = 1;
+    runs[1].state_cache_mb = 0;
+
+    search_results_t* results[2];
+    compare_runs(runs, 2, NULL, results);
+    search_results_t* cached = results[0];
+    TEST_ASSERT_EQUAL(cached->tests_performed, results[1]->tests_performed);
+
+    // C+ 1COMP 1COMP 1COMP reads only b0: both orderings of each of the three pairs of
+    // other bytes are solutions
+    const operation_t chain[] = {OP_CONST_ADD, OP_ONES_COMPLEMENT, OP_ONES_COMPLEMENT, OP_ONES_COMPLEMENT};
+    int orderings = 0;
+    for (size_t i = 0; i < cached->solution_count; i++) {
+        const checksum_solution_t* solution = &cached->solutions[i];
+        if (solution->field_count != 3 || solution->operation_count != 4 || solution->constant != 5) continue;
+        if (memcmp(solution->operations, chain, sizeof(chain)) != 0) continue;
+        TEST_ASSERT_EQUAL(0, solution->field_indices[0]);
+        TEST_ASSERT(solution->field_indices[1] != solution->field_indices[2]);
+        orderings++;
+    }
+    TEST_ASSERT_EQUAL(6, orderings);
+
+    free_runs(results, 2);
+    free_packet_dataset(dataset);
+}
+
+// AND and OR merge packets early; once two packets share the running value and every
+// unread byte but expect different checksums, the subtree is pruned without losing a chain
+void test_injectivity_conflict_pruning(void) {
+    // b0 ^ b1 over 4-byte frames of small values
+    packet_dataset_t* dataset = create_packet_dataset(32);
+    TEST_ASSERT_NOT_NULL(dataset);
+    uint32_t seed = 7;
+    for (int i = 0; i < 32; i++) {
+        uint8_t data[4];
+        for (int b = 0; b < 4; b++) data[b] = next_random_byte(&seed) & 3;
+        add_packet_from_bytes(dataset, data, 4, (uint8_t)(data[0] ^ data[1]), 1, "synthetic");
+    }
+
+    operation_t ops[] = {OP_AND, OP_OR, OP_XOR, OP_ADD};
+    config_t runs[3];
+    runs[0] = runs[1] = runs[2] = create_equivalence_config(dataset, ops, 4, 4);
+    runs[0].threads = runs[2].threads = 1;
+    runs[1].threads = 3;
+    runs[2].state_cache_mb = 0;
+
+    search_results_t* results[3];
+    compare_runs(runs, 3, NULL, results);
+    uint64_t pruned = 0;
+    for (int d = 0; d < CADS_MAX_SOLUTION_OPS; d++) pruned += results[0]->conflicts_pruned[d];
+    TEST_ASSERT(pruned > 0);
+    TEST_ASSERT_EQUAL(0, results[0]->conflicts_pruned[0]);
+    TEST_ASSERT(results[0]->solution_count > 0);
+    TEST_ASSERT_EQUAL(results[0]->tests_performed, results[1]->tests_performed);
+    TEST_ASSERT_EQUAL(results[0]->tests_performed, results[2]->tests_performed);
+
+    free_runs(results, 3);
+    free_packet_dataset(dataset);
+}
+
 int main(void) {
     TEST_SETUP();
     RUN_TEST(test_thread_equivalence_small_domain);
+    RUN_TEST(test_jit_equivalence);
+    RUN_TEST(test_bitsliced_kernel_equivalence);
+    RUN_TEST(test_unary_run_collapse_equivalence);
+    RUN_TEST(test_interleaved_field_orderings);
+    RUN_TEST(test_injectivity_conflict_pruning);
     return TEST_SUMMARY();
 }
@@ -0,0 +1,46 @@
+/* Deterministic random data shared by the tests: wide values, frame bytes and datasets of
+ * random frames */
+
+#ifndef TEST_DATA_H
+#define TEST_DATA_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "../src/core/packet_data.h"
+
+// xorshift64 for wide values; state must not be zero
+static inline uint64_t next_random(uint64_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+// Linear congruential generator for frame bytes
+static inline uint8_t next_random_byte(uint32_t* seed) {
+    *seed = *seed * 1103515245u + 12345u;
+    return (uint8_t)(*seed >> 16);
+}
+
+static inline void fill_random_bytes(uint32_t* seed, uint8_t* data, size_t length) {
+    for (size_t b = 0; b < length; b++) data[b] = next_random_byte(seed);
+}
+
+// Checksum of one frame; the dataset keeps its low checksum_size bytes
+typedef uint64_t (*frame_checksum_t)(const uint8_t* data, size_t length);
+
+// count frames of length random bytes drawn from seed, each checksummed by checksum
+static inline packet_dataset_t* create_random_dataset(uint32_t seed, size_t length, size_t count,
+                                                      frame_checksum_t checksum, size_t checksum_size) {
+    packet_dataset_t* dataset = create_packet_dataset(count);
+    if (!dataset || length > CADS_MAX_PACKET_SIZE) return dataset;
+    uint64_t mask = checksum_size >= 8 ? UINT64_MAX : ((1ULL << (checksum_size * 8)) - 1);
+    uint8_t data[CADS_MAX_PACKET_SIZE];
+    for (size_t i = 0; i < count; i++) {
+        fill_random_bytes(&seed, data, length);
+        add_packet_from_bytes(dataset, data, length, checksum(data, length) & mask, checksum_size, "synthetic");
+    }
+    return dataset;
+}
+
+#endif // TEST_DATA_H
@@ -2,6 +2,8 @@
 
 #include "../unity.h"
 #include "../../include/algorithm_registry.h"
+#include "../../src/algorithms/advanced_ops.h"
+#include "../../src/algorithms/width_ops.h"
 
 // Test setup - run before each test
 void setUp(void) {
@@ -106,7 +108,80 @@ void test_advanced_operations_wired(void) {
     tearDown();
 }
 
+// PCRC table bank must agree with the bit loop, including polynomials beyond the bank
+void test_poly_crc_bank_matches_bit_loop(void) {
+    setUp();
+    static uint8_t reference[256][256];
+    for (int poly = 0; poly < 256; poly++) {
+        for (int value = 0; value < 256; value++) {
+            reference[poly][value] = (uint8_t)execute_algorithm(OP_POLY_CRC, (uint64_t)value, 0x5A, (uint64_t)poly);
+        }
+    }
+    TEST_ASSERT_EQUAL(100, build_poly_crc_bank(100));
+    TEST_ASSERT_EQUAL(256, build_poly_crc_bank(300));
+    bool same = true;
+    for (int poly = 0; poly < 256; poly++) {
+        for (int value = 0; value < 256; value++) {
+            same &= reference[poly][value] ==
+                    (uint8_t)execute_algorithm(OP_POLY_CRC, (uint64_t)value, 0x5A, (uint64_t)poly);
+        }
+    }
+    TEST_ASSERT(same);
+    tearDown();
+}
+
 // Main test runner
+// Test that the 1-byte instantiations equal the registry ops, that wider ones rotate, swap
+// and reverse across the full width, and that every instantiation inverts itself
+void test_width_specialised_operations(void) {
+    setUp();
+    const operation_t ops[] = {OP_ROTLEFT, OP_ROTRIGHT, OP_SWAP_NIBBLES, OP_REVERSE_BITS};
+    algorithm_func_t func;
+    algorithm_inverse_func_t inverse;
+    bool same = true;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT(get_width_operation(ops[i], 1, &func, &inverse));
+        for (int a = 0; a < 256; a++) {
+            for (int b = 0; b < 70; b++) {
+                same &= func((uint64_t)a, (uint64_t)b, 0) == execute_algorithm(ops[i], (uint64_t)a, (uint64_t)b, 0);
+            }
+        }
+    }
+    TEST_ASSERT(same);
+    TEST_ASSERT(!get_width_operation(OP_ADD, 2, &func, &inverse));
+
+    TEST_ASSERT(get_width_operation(OP_ROTLEFT, 2, &func, &inverse));
+    TEST_ASSERT(func(0x8001, 1, 0) == 0x0003);
+    TEST_ASSERT(get_width_operation(OP_ROTRIGHT, 4, &func, &inverse));
+    TEST_ASSERT(func(0x00000001, 4, 0) == 0x10000000);
+    TEST_ASSERT(get_width_operation(OP_SWAP_NIBBLES, 2, &func, &inverse));
+    TEST_ASSERT(func(0x12AB, 0, 0) == 0xAB12);
+    TEST_ASSERT(get_width_operation(OP_REVERSE_BITS, 2, &func, &inverse));
+    TEST_ASSERT(func(0x0001, 0, 0) == 0x8000);
+    TEST_ASSERT(get_width_operation(OP_ROTLEFT, 3, &func, &inverse));
+    TEST_ASSERT(func(0x800000, 1, 0) == 0x000001);
+
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (size_t size = 1; size <= 8; size++) {
+        uint64_t mask = size == 8 ? UINT64_MAX : (1ULL << (size * 8)) - 1;
+        for (int i = 0; i < 4; i++) {
+            TEST_ASSERT(get_width_operation(ops[i], size, &func, &inverse));
+            for (int trial = 0; trial < 200; trial++) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                uint64_t a = state & mask, b = state >> 58, preimage;
+                uint64_t result = func(a, b, 0);
+                same &= result <= mask;
+                same &= inverse(result, b, 0, mask, &preimage) && preimage == a;
+            }
+            same &= !inverse(0, 0, 0, mask >> 1, &state);
+        }
+    }
+    TEST_ASSERT(same);
+    tearDown();
+}
+
 int main(void) {
     TEST_SETUP();
     
@@ -119,6 +194,8 @@ int main(void) {
     RUN_TEST(test_invalid_operation);
     RUN_TEST(test_operation_metadata);
     RUN_TEST(test_advanced_operations_wired);
+    RUN_TEST(test_poly_crc_bank_matches_bit_loop);
+    RUN_TEST(test_width_specialised_operations);
 
     // Advanced operation smoke tests (ensure function pointers wired)
     setUp();
@@ -0,0 +1,132 @@
+/* Unit tests for the bit-sliced chain-step kernel */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/algorithm_registry.h"
+#include "../../include/sequence_evaluator.h"
+#include "../../src/core/bitsliced_kernel.h"
+
+// Two full groups and a partial one
+#define PACKETS 150
+
+static const operation_t sliced_ops[] = {
+    OP_ADD, OP_SUB, OP_XOR, OP_AND, OP_OR, OP_IDENTITY, OP_NOT, OP_NEGATE,
+    OP_CONST_ADD, OP_CONST_XOR, OP_CONST_SUB, OP_ONES_COMPLEMENT, OP_TWOS_COMPLEMENT
+};
+#define SLICED_OP_COUNT ((int)(sizeof(sliced_ops) / sizeof(sliced_ops[0])))
+
+void setUp(void) {
+    initialize_algorithm_registry();
+}
+
+void tearDown(void) {
+    cleanup_algorithm_registry();
+}
+
+// Test that slicing and unslicing give back the low byte of every packet
+void test_slice_round_trip(void) {
+    uint64_t values[PACKETS], back[PACKETS];
+    uint64_t planes[3 * BITSLICED_PLANES];
+    TEST_ASSERT_EQUAL(3 * BITSLICED_PLANES, bitsliced_word_count(PACKETS));
+    uint64_t state = 0x853C49E6748FEA9BULL;
+    for (int p = 0; p < PACKETS; p++) values[p] = next_random(&state);
+    bitslice_values(values, PACKETS, planes);
+    unbitslice_values(planes, PACKETS, back);
+    bool same = true;
+    for (int p = 0; p < PACKETS; p++) same &= back[p] == (values[p] & 0xFF);
+    TEST_ASSERT(same);
+    TEST_ASSERT_EQUAL(0, planes[2 * BITSLICED_PLANES] >> (PACKETS - 128));
+}
+
+// Test every supported op against advance_chain_state on the low byte, including a field
+// op that halts the chain
+void test_steps_match_bytewise(void) {
+    setUp();
+    size_t words = bitsliced_word_count(PACKETS);
+    uint64_t fields[2 * PACKETS], out[PACKETS], sliced_out[PACKETS];
+    uint64_t field_planes[2 * 3 * BITSLICED_PLANES], state_planes[3 * BITSLICED_PLANES];
+    uint64_t next_planes[3 * BITSLICED_PLANES];
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    bool same = true;
+    for (int trial = 0; trial < 20; trial++) {
+        for (int p = 0; p < 2 * PACKETS; p++) fields[p] = next_random(&state) & 0xFF;
+        bitslice_values(fields, PACKETS, field_planes);
+        bitslice_values(&fields[PACKETS], PACKETS, &field_planes[words]);
+        uint64_t constant = next_random(&state) & 0xFF;
+        int field_count = 1 + trial % 2;
+
+        for (int i = 0; i < SLICED_OP_COUNT; i++) {
+            const algorithm_registry_entry_t* entry = get_algorithm_by_operation(sliced_ops[i]);
+            TEST_ASSERT_NOT_NULL(entry);
+            TEST_ASSERT(bitsliced_operation_supported(sliced_ops[i]));
+
+            chain_state_t from = {fields, 1, false}, to = {out, 0, false};
+            chain_state_t sliced_from = {state_planes, 1, false}, sliced_to = {next_planes, 0, false};
+            init_chain_state(&sliced_from, field_planes, words);
+            advance_chain_state(&from, &to, entry, fields, field_count, PACKETS, constant);
+            bitsliced_advance_chain_state(&sliced_from, &sliced_to, sliced_ops[i], field_planes, field_count,
+                                          PACKETS, constant);
+            unbitslice_values(next_planes, PACKETS, sliced_out);
+            for (int p = 0; p < PACKETS; p++) same &= sliced_out[p] == (out[p] & 0xFF);
+            same &= sliced_to.field_cursor == to.field_cursor && sliced_to.halted == to.halted;
+        }
+    }
+    TEST_ASSERT(same);
+    tearDown();
+}
+
+// Test that the leaf check agrees with chain_step_matches, including on the last packet
+// and with the unused lanes of a NOT
+void test_step_matches(void) {
+    setUp();
+    size_t words = bitsliced_word_count(PACKETS);
+    uint64_t fields[2 * PACKETS], expected[PACKETS];
+    uint64_t field_planes[2 * 3 * BITSLICED_PLANES], expected_planes[3 * BITSLICED_PLANES];
+    uint64_t state_planes[3 * BITSLICED_PLANES];
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    for (int p = 0; p < 2 * PACKETS; p++) fields[p] = next_random(&state) & 0xFF;
+    bitslice_values(fields, PACKETS, field_planes);
+    bitslice_values(&fields[PACKETS], PACKETS, &field_planes[words]);
+    chain_state_t from = {state_planes, 1, false};
+    init_chain_state(&from, field_planes, words);
+
+    const operation_t ops[] = {OP_SUB, OP_NOT, OP_CONST_ADD};
+    for (int i = 0; i < 3; i++) {
+        for (int p = 0; p < PACKETS; p++) {
+            expected[p] = execute_algorithm(ops[i], fields[p], fields[PACKETS + p], 0x3C) & 0xFF;
+        }
+        bitslice_values(expected, PACKETS, expected_planes);
+        TEST_ASSERT(bitsliced_chain_step_matches(&from, ops[i], field_planes, 2, PACKETS, 0x3C, expected_planes));
+
+        expected[PACKETS - 1] ^= 0x80;
+        bitslice_values(expected, PACKETS, expected_planes);
+        TEST_ASSERT(!bitsliced_chain_step_matches(&from, ops[i], field_planes, 2, PACKETS, 0x3C, expected_planes));
+    }
+    tearDown();
+}
+
+// Test that the tuner refuses op sets with a non-T-function op
+void test_tuner_requires_t_functions(void) {
+    setUp();
+    algorithm_registry_entry_t entries[2];
+    entries[0] = *get_algorithm_by_operation(OP_ADD);
+    entries[1] = *get_algorithm_by_operation(OP_MUL);
+    double bytewise, bitsliced;
+    TEST_ASSERT(!bitsliced_kernel_faster(entries, 2, 256, &bytewise, &bitsliced));
+    TEST_ASSERT(bitsliced == 0.0);
+
+    bitsliced_kernel_faster(entries, 1, 256, &bytewise, &bitsliced);
+    TEST_ASSERT(bytewise > 0.0 && bitsliced > 0.0);
+    tearDown();
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_slice_round_trip);
+    RUN_TEST(test_steps_match_bytewise);
+    RUN_TEST(test_step_matches);
+    RUN_TEST(test_tuner_requires_t_functions);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,168 @@
+/* Unit tests for the chain bytecode compiler, interpreter and text form */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/algorithm_registry.h"
+#include "../../include/checksum_engine.h"
+#include "../../include/sequence_evaluator.h"
+#include "../../src/core/chain_bytecode.h"
+#include "../../src/algorithms/width_ops.h"
+#include <string.h>
+
+#define PACKET_LENGTH 12
+
+void setUp(void) {
+    initialize_algorithm_registry();
+}
+
+void tearDown(void) {
+    cleanup_algorithm_registry();
+}
+
+// Registry op, or its instantiation for the checksum width
+static uint64_t reference_op(operation_t op, uint64_t a, uint64_t b, uint64_t constant, size_t checksum_size) {
+    algorithm_func_t func;
+    algorithm_inverse_func_t inverse;
+    if (get_width_operation(op, checksum_size, &func, &inverse)) return func(a, b, constant);
+    return execute_algorithm(op, a, b, constant);
+}
+
+// Per-op walk of the chain with the same slot rule as the compiler
+static uint64_t reference_chain(const uint8_t* data, const uint8_t* fields, int field_count,
+                                const operation_t* ops, int op_count,
+                                const uint64_t* constants, int constant_count, size_t checksum_size) {
+    uint64_t value = extract_packet_field_value(data, PACKET_LENGTH, fields[0], checksum_size);
+    int cursor = 1;
+    int constant_ops = 0;
+    for (int i = 0; i < op_count; i++) {
+        operand_kind_t kind = get_operation_operand_kind(ops[i]);
+        if (kind == OPERAND_NONE) {
+            value = reference_op(ops[i], value, 0, 0, checksum_size);
+        } else if (kind == OPERAND_CONSTANT) {
+            int slot = constant_ops < constant_count ? constant_ops : constant_count - 1;
+            constant_ops++;
+            value = reference_op(ops[i], value, 0, constants[slot], checksum_size);
+        } else if (cursor < field_count) {
+            uint64_t operand = extract_packet_field_value(data, PACKET_LENGTH, fields[cursor++], checksum_size);
+            value = reference_op(ops[i], value, operand, 0, checksum_size);
+        } else {
+            break;
+        }
+    }
+    return mask_checksum_to_size(value, checksum_size);
+}
+
+// Test random chains over every op, including ones that run out of fields, against the per-op walk
+void test_programs_match_reference(void) {
+    setUp();
+    uint64_t state = 0xD1B54A32D192ED03ULL;
+    uint8_t data[PACKET_LENGTH];
+    bool same = true;
+    for (int trial = 0; trial < 4000; trial++) {
+        size_t checksum_size = 1 + trial % 4;
+        int field_count = 1 + (int)(next_random(&state) % 5);
+        int op_count = (int)(next_random(&state) % 7);
+        int constant_count = 1 + (int)(next_random(&state) % CADS_MAX_CHAIN_CONSTANTS);
+        uint8_t fields[5];
+        operation_t ops[7];
+        uint64_t constants[CADS_MAX_CHAIN_CONSTANTS];
+        for (int f = 0; f < field_count; f++) fields[f] = (uint8_t)(next_random(&state) % PACKET_LENGTH);
+        for (int i = 0; i < op_count; i++) ops[i] = (operation_t)(next_random(&state) % NUM_OPS);
+        for (int k = 0; k < constant_count; k++) constants[k] = next_random(&state) & 0xFF;
+
+        chain_program_t program;
+        if (!compile_chain_program(&program, fields, field_count, ops, op_count,
+                                   constants, constant_count, checksum_size)) {
+            same = false;
+            continue;
+        }
+        for (int p = 0; p < 4; p++) {
+            for (int b = 0; b < PACKET_LENGTH; b++) data[b] = (uint8_t)next_random(&state);
+            uint64_t expected = reference_chain(data, fields, field_count, ops, op_count,
+                                                constants, constant_count, checksum_size);
+            same &= run_chain_program(&program, data, PACKET_LENGTH) == expected;
+        }
+    }
+    TEST_ASSERT(same);
+    tearDown();
+}
+
+// Test that field ADD / XOR and a trailing C+ compile to the fused instructions
+void test_superinstructions(void) {
+    setUp();
+    const uint8_t fields[] = {2, 4, 5};
+    const operation_t ops[] = {OP_ADD, OP_XOR, OP_CONST_ADD};
+    const uint64_t constant = 0x5A;
+    chain_program_t program;
+    TEST_ASSERT(compile_chain_program(&program, fields, 3, ops, 3, &constant, 1, 1));
+    const uint8_t expected[] = {BC_LOAD, 2, BC_FIELD_ADD, 4, BC_FIELD_XOR, 5, BC_CONST_ADD_RETURN, 0};
+    TEST_ASSERT_EQUAL(sizeof(expected), program.length);
+    TEST_ASSERT(memcmp(program.code, expected, sizeof(expected)) == 0);
+
+    // A C+ that is not last keeps the plain instruction and the chain ends in RETURN
+    const operation_t inner[] = {OP_CONST_ADD, OP_ADD};
+    TEST_ASSERT(compile_chain_program(&program, fields, 2, inner, 2, &constant, 1, 1));
+    TEST_ASSERT_EQUAL(BC_CONST_ADD, program.code[2]);
+    TEST_ASSERT_EQUAL(BC_RETURN, program.code[program.length - 1]);
+    tearDown();
+}
+
+// Test that a solution survives formatting and parsing, and that damaged text is rejected
+void test_text_round_trip(void) {
+    setUp();
+    checksum_solution_t solution = {0};
+    solution.field_indices[0] = 7;
+    solution.field_indices[1] = 1;
+    solution.field_indices[2] = 3;
+    solution.field_count = 3;
+    solution.operations[0] = OP_MUL;
+    solution.operations[1] = OP_CONST_XOR;
+    solution.operations[2] = OP_SUB;
+    solution.operations[3] = OP_POLY_CRC;
+    solution.operation_count = 4;
+    solution.constant = 0x31;
+    solution.extra_constants[0] = 0x07;
+    solution.extra_constant_count = 1;
+    solution.checksum_size = 2;
+
+    chain_program_t program, parsed;
+    char text[CHAIN_PROGRAM_TEXT_MAX];
+    TEST_ASSERT(compile_solution_program(&program, &solution));
+    TEST_ASSERT(format_chain_program(&program, text, sizeof(text)));
+    TEST_ASSERT(parse_chain_program(&parsed, text));
+    TEST_ASSERT_EQUAL(program.length, parsed.length);
+    TEST_ASSERT(memcmp(program.code, parsed.code, program.length) == 0);
+    TEST_ASSERT_EQUAL(program.field_limit, parsed.field_limit);
+
+    uint8_t data[PACKET_LENGTH];
+    uint64_t state = 0x2545F4914F6CDD1DULL;
+    bool same = true;
+    for (int p = 0; p < 64; p++) {
+        for (int b = 0; b < PACKET_LENGTH; b++) data[b] = (uint8_t)next_random(&state);
+        same &= run_chain_program(&program, data, PACKET_LENGTH) == run_chain_program(&parsed, data, PACKET_LENGTH);
+    }
+    TEST_ASSERT(same);
+
+    char damaged[CHAIN_PROGRAM_TEXT_MAX];
+    size_t length = strlen(text);
+    memcpy(damaged, text, length - 2);
+    damaged[length - 2] = '\0';                 // Return dropped
+    TEST_ASSERT(!parse_chain_program(&parsed, damaged));
+    memcpy(damaged, text, length + 1);
+    damaged[0] = 'Z';                           // Not hex
+    TEST_ASSERT(!parse_chain_program(&parsed, damaged));
+    memcpy(damaged, text, length + 1);
+    damaged[length - 1] = 'F';                  // Unknown opcode
+    TEST_ASSERT(!parse_chain_program(&parsed, damaged));
+    tearDown();
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_programs_match_reference);
+    RUN_TEST(test_superinstructions);
+    RUN_TEST(test_text_round_trip);
+
+    return TEST_SUMMARY();
+}
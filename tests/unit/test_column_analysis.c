@@ -0,0 +1,108 @@
+/* Unit tests for dataset column equivalence classes */
+
+#include "../unity.h"
+#include "../../src/core/column_analysis.h"
+#include "../../include/checksum_engine.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+#define FIELD(i) (1ULL << (i))
+
+// 5-byte frames: bytes 1 and 3 always zero, byte 2 copies byte 0. checksum = b0 ^ b4
+static packet_dataset_t* create_dataset(void) {
+    packet_dataset_t* dataset = create_packet_dataset(16);
+    for (int i = 0; i < 16; i++) {
+        uint8_t data[5] = {(uint8_t)(i * 37), 0, (uint8_t)(i * 37), 0, (uint8_t)(i * 11 + 5)};
+        add_packet_from_bytes(dataset, data, sizeof(data), (uint8_t)(data[0] ^ data[4]), 1, "col");
+    }
+    return dataset;
+}
+
+static void add_test_solution(search_results_t* results, uint8_t first, uint8_t second) {
+    checksum_solution_t solution = {0};
+    solution.field_indices[0] = first;
+    solution.field_indices[1] = second;
+    solution.field_count = 2;
+    solution.operations[0] = OP_IDENTITY;
+    solution.operations[1] = OP_XOR;
+    solution.operation_count = 2;
+    solution.checksum_size = 1;
+    add_solution(results, &solution);
+}
+
+// Test class detection for constant and duplicate columns
+void test_column_classes(void) {
+    packet_dataset_t* dataset = create_dataset();
+    column_analysis_t* analysis = analyze_dataset_columns(dataset, 1);
+    TEST_ASSERT_NOT_NULL(analysis);
+
+    TEST_ASSERT_EQUAL(5, (int)analysis->column_count);
+    TEST_ASSERT_EQUAL(3, (int)analysis->class_count);
+    TEST_ASSERT_EQUAL(2, (int)analysis->constant_columns);
+    TEST_ASSERT_EQUAL(2, (int)analysis->duplicate_columns);
+    TEST_ASSERT_EQUAL(0, analysis->representative[2]);
+    TEST_ASSERT_EQUAL(1, analysis->representative[3]);
+    TEST_ASSERT_EQUAL(4, analysis->representative[4]);
+    TEST_ASSERT(analysis->constant[1]);
+    TEST_ASSERT(!analysis->constant[0]);
+
+    free_column_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+// Test that only sets using the first members of each class are canonical
+void test_canonical_sets(void) {
+    packet_dataset_t* dataset = create_dataset();
+    column_analysis_t* analysis = analyze_dataset_columns(dataset, 1);
+    TEST_ASSERT_NOT_NULL(analysis);
+
+    TEST_ASSERT(column_fields_canonical(analysis, FIELD(0)));
+    TEST_ASSERT(!column_fields_canonical(analysis, FIELD(2)));
+    TEST_ASSERT(column_fields_canonical(analysis, FIELD(0) | FIELD(2)));
+    TEST_ASSERT(!column_fields_canonical(analysis, FIELD(3) | FIELD(4)));
+    TEST_ASSERT(column_fields_canonical(analysis, FIELD(1) | FIELD(3) | FIELD(4)));
+    TEST_ASSERT(column_fields_canonical(NULL, FIELD(3)));
+
+    free_column_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+// Test that solutions are expanded exactly once to the skipped equivalent fields
+void test_expand_solutions(void) {
+    packet_dataset_t* dataset = create_dataset();
+    column_analysis_t* analysis = analyze_dataset_columns(dataset, 1);
+    search_results_t* results = create_search_results(4);
+    TEST_ASSERT_NOT_NULL(analysis);
+
+    add_test_solution(results, 0, 4);
+    add_test_solution(results, 4, 0);
+    add_test_solution(results, 0, 2);     // Both orders of one class are found by the search
+    add_test_solution(results, 2, 0);
+
+    TEST_ASSERT_EQUAL(2, (int)expand_equivalent_solutions(analysis, results));
+    TEST_ASSERT_EQUAL(6, (int)results->solution_count);
+    TEST_ASSERT_EQUAL(2, results->solutions[4].field_indices[0]);
+    TEST_ASSERT_EQUAL(4, results->solutions[4].field_indices[1]);
+    TEST_ASSERT_EQUAL(4, results->solutions[5].field_indices[0]);
+    TEST_ASSERT_EQUAL(2, results->solutions[5].field_indices[1]);
+
+    free_search_results(results);
+    free_column_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_column_classes);
+    RUN_TEST(test_canonical_sets);
+    RUN_TEST(test_expand_solutions);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,103 @@
+/* Unit tests for differential packet-pair analysis */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../src/core/differential_analysis.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+// Pairs of 6-byte frames differing in a single byte. checksum = (b1 ^ b3) + b4 * b4
+static packet_dataset_t* create_pair_dataset(void) {
+    packet_dataset_t* dataset = create_packet_dataset(64);
+    uint32_t seed = 99;
+    for (int i = 0; i < 12; i++) {
+        uint8_t base[6];
+        fill_random_bytes(&seed, base, sizeof(base));
+        for (int variant = 0; variant < 5; variant++) {
+            uint8_t data[6];
+            memcpy(data, base, sizeof(data));
+            if (variant > 0) data[variant] ^= (uint8_t)(0x11 * (i + 1));   // Touch byte 1..4 alone
+            uint8_t checksum = (uint8_t)((data[1] ^ data[3]) + data[4] * data[4]);
+            add_packet_from_bytes(dataset, data, sizeof(data), checksum, 1, "pair");
+        }
+    }
+    return dataset;
+}
+
+// Test influence and response classification per byte
+void test_byte_responses(void) {
+    packet_dataset_t* dataset = create_pair_dataset();
+    differential_analysis_t* analysis = analyze_packet_differences(dataset, 1);
+    TEST_ASSERT_NOT_NULL(analysis);
+
+    TEST_ASSERT_EQUAL(6, (int)analysis->byte_count);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_UNOBSERVED, analysis->response[0]);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_NONLINEAR, analysis->response[1]);   // XOR feeding an ADD
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_NONE, analysis->response[2]);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_NONLINEAR, analysis->response[4]);
+    TEST_ASSERT(analysis->influential[1]);
+    TEST_ASSERT(analysis->influential[3]);
+    TEST_ASSERT(!analysis->influential[2]);
+    TEST_ASSERT_EQUAL(3, analysis->influential_count);
+    TEST_ASSERT_EQUAL(12, (int)analysis->pair_counts[3]);
+
+    // Never-changing bytes are enumerated last
+    TEST_ASSERT_EQUAL(2, analysis->field_order[5]);
+
+    free_differential_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+// Test that the XOR and additive responses are told apart
+void test_linear_responses(void) {
+    packet_dataset_t* dataset = create_packet_dataset(16);
+    // checksum = b1 ^ (b2 - b0), with b1 in the high nibble and b2 - b0 in the low nibble
+    const uint8_t frames[4][3] = {{1, 0x40, 9}, {1, 0xB0, 9}, {1, 0x40, 0x0C}, {5, 0x40, 9}};
+    for (int i = 0; i < 4; i++) {
+        uint8_t checksum = (uint8_t)(frames[i][1] ^ (uint8_t)(frames[i][2] - frames[i][0]));
+        add_packet_from_bytes(dataset, frames[i], 3, checksum, 1, "linear");
+    }
+    differential_analysis_t* analysis = analyze_packet_differences(dataset, 1);
+    TEST_ASSERT_NOT_NULL(analysis);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_SUB, analysis->response[0]);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_XOR, analysis->response[1]);
+    TEST_ASSERT_EQUAL(BYTE_RESPONSE_ADD, analysis->response[2]);
+    free_differential_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+// Test the field-set filter, including multi-byte field spans
+void test_fields_allowed(void) {
+    packet_dataset_t* dataset = create_pair_dataset();
+    differential_analysis_t* analysis = analyze_packet_differences(dataset, 1);
+    TEST_ASSERT_NOT_NULL(analysis);
+
+    const uint8_t all[] = {1, 3, 4};
+    const uint8_t missing[] = {1, 4};
+    TEST_ASSERT(differential_fields_allowed(analysis, all, 3, 1));
+    TEST_ASSERT(!differential_fields_allowed(analysis, missing, 2, 1));
+
+    // A 2-byte field at 3 spans bytes 3 and 4
+    const uint8_t spans[] = {0, 3};
+    TEST_ASSERT(differential_fields_allowed(analysis, spans, 2, 2));
+    TEST_ASSERT(differential_fields_allowed(NULL, missing, 2, 1));
+
+    free_differential_analysis(analysis);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_byte_responses);
+    RUN_TEST(test_linear_responses);
+    RUN_TEST(test_fields_allowed);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,78 @@
+/* Unit tests for the functional-dependency field-set filter */
+
+#include "../unity.h"
+#include "../../src/core/field_dependency.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+#define FIELD(i) (1ULL << (i))
+
+// 5-byte frames: byte 0 constant, byte 1 a sequence number, bytes 2 and 3 small, byte 4 = byte 2.
+// checksum = byte 2 + byte 3
+static packet_dataset_t* create_dataset(void) {
+    packet_dataset_t* dataset = create_packet_dataset(40);
+    for (int i = 0; i < 40; i++) {
+        uint8_t data[5] = {0xAA, (uint8_t)i, (uint8_t)(i % 4), (uint8_t)(i / 4 % 3), 0};
+        data[4] = data[2];
+        add_packet_from_bytes(dataset, data, sizeof(data), (uint8_t)(data[2] + data[3]), 1, "fd");
+    }
+    return dataset;
+}
+
+// Test that sets missing a determining byte are rejected and supersets of valid sets pass
+void test_rejects_non_determining_sets(void) {
+    packet_dataset_t* dataset = create_dataset();
+    fd_filter_t* filter = build_fd_filter(dataset, 1, 3);
+    TEST_ASSERT_NOT_NULL(filter);
+
+    TEST_ASSERT(!fd_filter_allows(filter, FIELD(0)));
+    TEST_ASSERT(!fd_filter_allows(filter, FIELD(2)));
+    TEST_ASSERT(!fd_filter_allows(filter, FIELD(0) | FIELD(3)));
+    TEST_ASSERT(fd_filter_allows(filter, FIELD(2) | FIELD(3)));
+    TEST_ASSERT(fd_filter_allows(filter, FIELD(3) | FIELD(4)));              // Byte 4 duplicates byte 2
+    TEST_ASSERT(fd_filter_allows(filter, FIELD(0) | FIELD(2) | FIELD(3)));
+    TEST_ASSERT(fd_filter_allows(filter, FIELD(1)));                         // Unique per packet
+
+    TEST_ASSERT(filter->rejected_count > 0);
+    TEST_ASSERT(filter->evaluated >= filter->rejected_count);
+
+    free_fd_filter(filter);
+    free_packet_dataset(dataset);
+}
+
+// Test that an exact duplicate frame with a different checksum rejects every set
+void test_conflicting_duplicates(void) {
+    packet_dataset_t* dataset = create_dataset();
+    const uint8_t data[5] = {0xAA, 0x10, 1, 1, 1};
+    add_packet_from_bytes(dataset, data, sizeof(data), 0x02, 1, "a");
+    add_packet_from_bytes(dataset, data, sizeof(data), 0x03, 1, "b");
+    fd_filter_t* filter = build_fd_filter(dataset, 1, 5);
+    TEST_ASSERT_NOT_NULL(filter);
+
+    TEST_ASSERT(!fd_filter_allows(filter, FIELD(0) | FIELD(1) | FIELD(2) | FIELD(3) | FIELD(4)));
+    TEST_ASSERT(!fd_filter_allows(filter, FIELD(1)));
+
+    free_fd_filter(filter);
+    free_packet_dataset(dataset);
+}
+
+// Test that a missing filter allows everything
+void test_null_filter(void) {
+    TEST_ASSERT(fd_filter_allows(NULL, FIELD(0)));
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_rejects_non_determining_sets);
+    RUN_TEST(test_conflicting_duplicates);
+    RUN_TEST(test_null_filter);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,131 @@
+/* Unit tests for the GF(2) affine checksum solver */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../src/core/gf2_affine_solver.h"
+
+typedef uint8_t (*checksum_fn_t)(const uint8_t* data, size_t length);
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+static uint8_t xor_fields(const uint8_t* data, size_t length) {
+    (void)length;
+    return data[2] ^ data[4] ^ data[5] ^ 0x5A;
+}
+
+static uint8_t crc8_init_ff(const uint8_t* data, size_t length) {
+    uint8_t crc = 0xFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; b++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static uint8_t byte_sum(const uint8_t* data, size_t length) {
+    uint8_t sum = 0;
+    for (size_t i = 0; i < length; i++) sum += data[i];
+    return sum;
+}
+
+// Frames of 7 bytes with a constant two-byte header
+static packet_dataset_t* create_dataset(int packets, checksum_fn_t checksum) {
+    packet_dataset_t* dataset = create_packet_dataset(packets);
+    uint32_t seed = 2024;
+    for (int i = 0; i < packets; i++) {
+        uint8_t data[7] = {0x9C, 0x30};
+        fill_random_bytes(&seed, data + 2, sizeof(data) - 2);
+        add_packet_from_bytes(dataset, data, sizeof(data), checksum(data, sizeof(data)), 1, "synthetic");
+    }
+    return dataset;
+}
+
+// Test recovery of an XOR-of-bytes checksum
+void test_xor_of_fields(void) {
+    packet_dataset_t* dataset = create_dataset(80, xor_fields);
+    gf2_affine_result_t* result = solve_gf2_affine(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT(!result->underdetermined);
+    TEST_ASSERT_EQUAL(GF2_BYTE_CONSTANT, result->byte_relevance[0]);
+    TEST_ASSERT_EQUAL(GF2_BYTE_RELEVANT, result->byte_relevance[2]);
+    TEST_ASSERT_EQUAL(GF2_BYTE_UNUSED, result->byte_relevance[3]);
+    TEST_ASSERT_EQUAL(GF2_BYTE_RELEVANT, result->byte_relevance[5]);
+
+    checksum_solution_t solution;
+    TEST_ASSERT(gf2_affine_to_solution(result, &solution));
+    TEST_ASSERT_EQUAL(3, solution.field_count);
+    TEST_ASSERT_EQUAL(2, solution.field_indices[0]);
+    TEST_ASSERT_EQUAL(4, solution.field_indices[1]);
+    TEST_ASSERT_EQUAL(5, solution.field_indices[2]);
+    TEST_ASSERT_EQUAL(OP_CONST_XOR, solution.operations[solution.operation_count - 1]);
+    TEST_ASSERT_EQUAL(0x5A, (int)solution.constant);
+
+    free_gf2_affine_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that a CRC with a non-zero init is recognised as affine
+void test_crc8_is_affine(void) {
+    packet_dataset_t* dataset = create_dataset(80, crc8_init_ff);
+    gf2_affine_result_t* result = solve_gf2_affine(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT(!result->underdetermined);
+    TEST_ASSERT(result->packets_used > (size_t)result->rank);
+    checksum_solution_t solution;
+    TEST_ASSERT(!gf2_affine_to_solution(result, &solution));  // Not a byte-aligned XOR
+
+    free_gf2_affine_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that an arithmetic sum is rejected except for its parity bit
+void test_sum_is_not_affine(void) {
+    packet_dataset_t* dataset = create_dataset(80, byte_sum);
+    gf2_affine_result_t* result = solve_gf2_affine(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(!result->consistent);
+    TEST_ASSERT_EQUAL(0, (int)(result->inconsistent_bits & 1));   // Bit 0 of a sum is XOR
+    TEST_ASSERT(result->inconsistent_bits & 0x80);
+
+    free_gf2_affine_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that too few packets are reported as underdetermined
+void test_underdetermined(void) {
+    packet_dataset_t* dataset = create_dataset(8, xor_fields);
+    gf2_affine_result_t* result = solve_gf2_affine(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT(result->underdetermined);
+    TEST_ASSERT(result->nullity > 0);
+    TEST_ASSERT_EQUAL(GF2_BYTE_AMBIGUOUS, result->byte_relevance[3]);
+
+    free_gf2_affine_result(result);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_xor_of_fields);
+    RUN_TEST(test_crc8_is_affine);
+    RUN_TEST(test_sum_is_not_affine);
+    RUN_TEST(test_underdetermined);
+
+    return TEST_SUMMARY();
+}
@@ -0,0 +1,76 @@
+/* Unit tests for injectivity-conflict detection */
+
+#include "../unity.h"
+#include "../../src/core/injectivity_conflicts.h"
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+#define PACKETS 4
+
+// Two fields per packet, one row each. Packets 0 and 1 share field 1 and expect different
+// checksums; packets 2 and 3 share both fields and expect the same checksum.
+static const uint64_t fields[2 * PACKETS] = {
+    1, 2, 7, 7,     // Field 0
+    9, 9, 5, 5      // Field 1
+};
+static const uint64_t expected[PACKETS] = {0x10, 0x20, 0x30, 0x30};
+
+// Test that a conflict needs the same value and the same unread fields
+void test_detects_colliding_states(void) {
+    conflict_detector_t* detector = create_conflict_detector(PACKETS, expected);
+    TEST_ASSERT_NOT_NULL(detector);
+    TEST_ASSERT(conflict_detector_set_fields(detector, fields, 2));
+
+    const uint64_t merged[PACKETS] = {4, 4, 6, 8};
+    const uint64_t distinct[PACKETS] = {4, 5, 6, 6};
+    TEST_ASSERT(chain_state_conflicts(detector, merged, UINT64_MAX, 0x2));
+    TEST_ASSERT(chain_state_conflicts(detector, merged, UINT64_MAX, 0x0));
+    TEST_ASSERT(!chain_state_conflicts(detector, merged, UINT64_MAX, 0x1));   // Field 0 still tells them apart
+    TEST_ASSERT(!chain_state_conflicts(detector, merged, UINT64_MAX, 0x3));
+    TEST_ASSERT(!chain_state_conflicts(detector, distinct, UINT64_MAX, 0x2)); // 2 and 3 agree on their checksum
+    free_conflict_detector(detector);
+}
+
+// Test that values are compared under the mask only
+void test_value_mask(void) {
+    conflict_detector_t* detector = create_conflict_detector(PACKETS, expected);
+    TEST_ASSERT_NOT_NULL(detector);
+    TEST_ASSERT(conflict_detector_set_fields(detector, fields, 2));
+
+    const uint64_t high_differs[PACKETS] = {0x104, 0x204, 1, 2};
+    TEST_ASSERT(!chain_state_conflicts(detector, high_differs, UINT64_MAX, 0x2));
+    TEST_ASSERT(chain_state_conflicts(detector, high_differs, 0xFF, 0x2));
+    free_conflict_detector(detector);
+}
+
+// Test that a new mask replaces the old fields and that too few packets give no detector
+void test_set_fields(void) {
+    TEST_ASSERT_NULL(create_conflict_detector(1, expected));
+    conflict_detector_t* detector = create_conflict_detector(PACKETS, expected);
+    TEST_ASSERT_NOT_NULL(detector);
+    TEST_ASSERT(conflict_detector_set_fields(detector, fields, 1));
+    const uint64_t merged[PACKETS] = {4, 4, 6, 8};
+    TEST_ASSERT(!chain_state_conflicts(detector, merged, UINT64_MAX, 0x1));
+    TEST_ASSERT(!chain_state_conflicts(detector, merged, UINT64_MAX, 0x2));  // Not a field of this mask
+
+    // Field 1 alone is the first row now
+    TEST_ASSERT(conflict_detector_set_fields(detector, &fields[PACKETS], 1));
+    TEST_ASSERT(chain_state_conflicts(detector, merged, UINT64_MAX, 0x1));
+    free_conflict_detector(detector);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_detects_colliding_states);
+    RUN_TEST(test_value_mask);
+    RUN_TEST(test_set_fields);
+
+    return TEST_SUMMARY();
+}
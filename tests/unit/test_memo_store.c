@@ -0,0 +1,190 @@
+/* Unit tests for the on-disk memo store */
+
+#include "../unity.h"
+#include "../../src/core/memo_store.h"
+#include "../../src/core/packet_data.h"
+#include "../../src/utils/config.h"
+#include <unistd.h>
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+static char memo_path[64];
+
+// Point memo_path at a store file no earlier test has written
+static void reset_memo_path(void) {
+    snprintf(memo_path, sizeof(memo_path), "/tmp/cads_test_memo_%ld.bin", (long)getpid());
+    remove(memo_path);
+}
+
+// Prefix keys of one-packet datasets, dataset_keys[k] for dataset k
+static const uint64_t dataset_keys[5][2] = {{0, 0}, {0, 101}, {0, 102}, {0, 103}, {0, 104}};
+
+static checksum_solution_t make_solution(uint8_t field, operation_t op, uint64_t constant) {
+    checksum_solution_t solution;
+    memset(&solution, 0, sizeof(solution));
+    solution.field_indices[0] = field;
+    solution.field_count = 1;
+    solution.operations[0] = op;
+    solution.operation_count = 1;
+    solution.constant = constant;
+    solution.checksum_size = 1;
+    solution.validated = true;
+    return solution;
+}
+
+// Test that regions and their solutions survive a save and reload
+void test_round_trip(void) {
+    reset_memo_path();
+    memo_store_t* store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL(0, store->region_count);
+    checksum_solution_t solutions[2] = {make_solution(3, OP_XOR, 7), make_solution(5, OP_ADD, 0)};
+    solutions[1].extra_constants[0] = 9;
+    solutions[1].extra_constant_count = 1;
+    TEST_ASSERT(record_memo_region(store, dataset_keys[4], 1, 0x3F, 2, 16, solutions, 2));
+    TEST_ASSERT(save_memo_store(store));
+    free_memo_store(store);
+
+    store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL(1, store->region_count);
+    const memo_region_t* region = find_memo_region(store, dataset_keys[4], 1, 0x3F, 2, 16);
+    TEST_ASSERT_NOT_NULL(region);
+    TEST_ASSERT_EQUAL(2, region->solution_count);
+    TEST_ASSERT_EQUAL(3, region->solutions[0].field_indices[0]);
+    TEST_ASSERT_EQUAL(OP_XOR, region->solutions[0].operations[0]);
+    TEST_ASSERT_EQUAL(7, region->solutions[0].constant);
+    TEST_ASSERT_EQUAL(1, region->solutions[1].extra_constant_count);
+    TEST_ASSERT_EQUAL(9, region->solutions[1].extra_constants[0]);
+    free_memo_store(store);
+}
+
+// Test that lookups need the same key, enough fields and constants, and prefer the most shared ops
+void test_find_region(void) {
+    reset_memo_path();
+    memo_store_t* store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x03, 3, 16, NULL, 0));
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x0E, 2, 16, NULL, 0));
+    TEST_ASSERT_NULL(find_memo_region(store, dataset_keys[2], 1, 0x0F, 1, 16));
+    TEST_ASSERT_NULL(find_memo_region(store, dataset_keys[1], 1, 0x0F, 1, 32));
+    TEST_ASSERT_NULL(find_memo_region(store, dataset_keys[1], 1, 0x0F, 4, 16));
+    TEST_ASSERT_EQUAL(0x0E, find_memo_region(store, dataset_keys[1], 1, 0x0F, 2, 16)->operations);
+    TEST_ASSERT_EQUAL(0x03, find_memo_region(store, dataset_keys[1], 1, 0x0F, 3, 16)->operations);
+    TEST_ASSERT_EQUAL(0x03, find_memo_region(store, dataset_keys[1], 1, 0x03, 1, 8)->operations);
+    free_memo_store(store);
+}
+
+// Test that a region replaces the regions it covers and keeps the others
+void test_dominated_regions_dropped(void) {
+    reset_memo_path();
+    memo_store_t* store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x03, 2, 16, NULL, 0));
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x30, 2, 16, NULL, 0));
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x07, 3, 256, NULL, 0));  // Covers 0x03 only
+    TEST_ASSERT_EQUAL(2, store->region_count);
+    TEST_ASSERT(record_memo_region(store, dataset_keys[2], 1, 0x3F, 4, 256, NULL, 0));  // Other dataset
+    TEST_ASSERT_EQUAL(3, store->region_count);
+    free_memo_store(store);
+}
+
+// Test that saving evicts the least recently used regions beyond the budget, and that a
+// region larger than the budget is refused
+void test_lru_eviction(void) {
+    reset_memo_path();
+    checksum_solution_t solutions[8];
+    for (int i = 0; i < 8; i++) solutions[i] = make_solution((uint8_t)i, OP_ADD, 0);
+    // Room for two regions of eight solutions, not three
+    memo_store_t* store = open_memo_store(memo_path, 1024);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT(record_memo_region(store, dataset_keys[1], 1, 0x01, 1, 16, solutions, 8));
+    TEST_ASSERT(record_memo_region(store, dataset_keys[2], 1, 0x01, 1, 16, solutions, 8));
+    TEST_ASSERT(record_memo_region(store, dataset_keys[3], 1, 0x01, 1, 16, solutions, 8));
+    TEST_ASSERT_NOT_NULL(find_memo_region(store, dataset_keys[1], 1, 0x01, 1, 16));  // Dataset 2 is now the oldest
+    TEST_ASSERT(save_memo_store(store));
+    free_memo_store(store);
+
+    store = open_memo_store(memo_path, 1024);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL(2, store->region_count);
+    TEST_ASSERT_NULL(find_memo_region(store, dataset_keys[2], 1, 0x01, 1, 16));
+    TEST_ASSERT_NOT_NULL(find_memo_region(store, dataset_keys[1], 1, 0x01, 1, 16));
+    TEST_ASSERT_NOT_NULL(find_memo_region(store, dataset_keys[3], 1, 0x01, 1, 16));
+    free_memo_store(store);
+
+    store = open_memo_store(memo_path, 64);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT(!record_memo_region(store, dataset_keys[1], 1, 0x3F, 4, 256, solutions, 8));
+    TEST_ASSERT_EQUAL(2, store->region_count);
+    free_memo_store(store);
+}
+
+// Test that a damaged file opens as an empty store
+void test_damaged_file(void) {
+    reset_memo_path();
+    FILE* file = fopen(memo_path, "wb");
+    TEST_ASSERT_NOT_NULL(file);
+    fputs("CADSMEMO but not really", file);
+    fclose(file);
+    memo_store_t* store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT_EQUAL(0, store->region_count);
+    free_memo_store(store);
+}
+
+// Test that a region searched over some packets serves the dataset with packets appended,
+// and is replaced by a region over the longer dataset
+void test_appended_packets(void) {
+    reset_memo_path();
+    packet_dataset_t* dataset = create_packet_dataset(4);
+    TEST_ASSERT_NOT_NULL(dataset);
+    const uint8_t frames[3][4] = {{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}};
+    for (int i = 0; i < 3; i++) TEST_ASSERT(add_packet_from_bytes(dataset, frames[i], 4, frames[i][0], 1, "memo"));
+    config_t config = create_default_search_config();
+    config.dataset = dataset;
+    uint64_t keys[4];
+    memo_prefix_keys(&config, keys);
+    dataset->count = 2;
+    uint64_t shorter[3];
+    memo_prefix_keys(&config, shorter);
+    dataset->count = 3;
+    TEST_ASSERT(memcmp(keys, shorter, sizeof(shorter)) == 0);
+    config.chain_constants = 2;
+    memo_prefix_keys(&config, shorter);
+    TEST_ASSERT(shorter[2] != keys[2]);
+
+    memo_store_t* store = open_memo_store(memo_path, MEMO_STORE_BUDGET_BYTES);
+    TEST_ASSERT_NOT_NULL(store);
+    TEST_ASSERT(record_memo_region(store, keys, 2, 0x3F, 2, 16, NULL, 0));
+    const memo_region_t* region = find_memo_region(store, keys, 3, 0x3F, 2, 16);
+    TEST_ASSERT_NOT_NULL(region);
+    TEST_ASSERT_EQUAL(2, region->packet_count);
+    TEST_ASSERT_NULL(find_memo_region(store, keys, 1, 0x3F, 2, 16));    // Fewer packets than searched
+    TEST_ASSERT_NULL(find_memo_region(store, shorter, 3, 0x3F, 2, 16)); // Other settings
+    TEST_ASSERT(record_memo_region(store, keys, 3, 0x3F, 2, 16, NULL, 0));
+    TEST_ASSERT_EQUAL(1, store->region_count);
+    TEST_ASSERT_EQUAL(3, find_memo_region(store, keys, 3, 0x3F, 2, 16)->packet_count);
+    free_memo_store(store);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_find_region);
+    RUN_TEST(test_dominated_regions_dropped);
+    RUN_TEST(test_lru_eviction);
+    RUN_TEST(test_appended_packets);
+    RUN_TEST(test_damaged_file);
+    remove(memo_path);
+
+    return TEST_SUMMARY();
+}
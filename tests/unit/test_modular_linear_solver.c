@@ -0,0 +1,166 @@
+/* Unit tests for the Z/2^N weighted-sum checksum solver */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../src/core/modular_linear_solver.h"
+
+typedef uint64_t (*checksum_fn_t)(const uint8_t* data, size_t length);
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+static uint64_t byte_sum(const uint8_t* data, size_t length) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < length; i++) sum += data[i];
+    return sum;
+}
+
+static uint64_t add_sub_fields(const uint8_t* data, size_t length) {
+    (void)length;
+    return (uint64_t)(data[2] + data[5] - data[3] + 0x11);
+}
+
+static uint64_t position_weighted(const uint8_t* data, size_t length) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < length; i++) sum += (i + 1) * data[i];
+    return sum;
+}
+
+static uint64_t xor_fields(const uint8_t* data, size_t length) {
+    (void)length;
+    return data[2] ^ data[4];
+}
+
+// Frames of 7 bytes with a constant two-byte header; even_byte3 clears bit 0 of byte 3
+static packet_dataset_t* create_dataset(int packets, checksum_fn_t checksum, size_t checksum_size,
+                                        bool even_byte3) {
+    packet_dataset_t* dataset = create_packet_dataset(packets);
+    uint64_t mask = checksum_size == 8 ? UINT64_MAX : ((1ULL << (checksum_size * 8)) - 1);
+    uint32_t seed = 77;
+    for (int i = 0; i < packets; i++) {
+        uint8_t data[7] = {0x9C, 0x30};
+        fill_random_bytes(&seed, data + 2, sizeof(data) - 2);
+        if (even_byte3) data[3] &= 0xFE;
+        add_packet_from_bytes(dataset, data, sizeof(data), checksum(data, sizeof(data)) & mask,
+                              checksum_size, "synthetic");
+    }
+    return dataset;
+}
+
+// Test recovery of a plain byte sum and its mapping onto an ADD chain
+void test_byte_sum(void) {
+    packet_dataset_t* dataset = create_dataset(80, byte_sum, 1, false);
+    modular_linear_result_t* result = solve_modular_linear(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT_EQUAL(0, result->solution_log2);
+    TEST_ASSERT(result->constant_bytes[0]);
+    TEST_ASSERT_EQUAL(0, (int)result->weights[0]);
+    TEST_ASSERT_EQUAL(1, (int)result->weights[4]);
+    TEST_ASSERT_EQUAL(0xCC, (int)result->offset);
+
+    checksum_solution_t solution;
+    TEST_ASSERT(modular_linear_to_solution(result, &solution));
+    TEST_ASSERT_EQUAL(5, solution.field_count);
+    TEST_ASSERT_EQUAL(OP_ADD, solution.operations[0]);
+    TEST_ASSERT_EQUAL(OP_CONST_ADD, solution.operations[solution.operation_count - 1]);
+    TEST_ASSERT_EQUAL(0xCC, (int)solution.constant);
+
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that negative weights become SUB operations after the positive fields
+void test_add_sub_chain(void) {
+    packet_dataset_t* dataset = create_dataset(80, add_sub_fields, 1, false);
+    modular_linear_result_t* result = solve_modular_linear(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT_EQUAL(0xFF, (int)result->weights[3]);
+
+    checksum_solution_t solution;
+    TEST_ASSERT(modular_linear_to_solution(result, &solution));
+    TEST_ASSERT_EQUAL(3, solution.field_count);
+    TEST_ASSERT_EQUAL(2, solution.field_indices[0]);
+    TEST_ASSERT_EQUAL(5, solution.field_indices[1]);
+    TEST_ASSERT_EQUAL(3, solution.field_indices[2]);
+    TEST_ASSERT_EQUAL(OP_ADD, solution.operations[0]);
+    TEST_ASSERT_EQUAL(OP_SUB, solution.operations[1]);
+    TEST_ASSERT_EQUAL(0x11, (int)solution.constant);
+
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test position weights over a 16-bit modulus, including even weights
+void test_position_weighted_16bit(void) {
+    packet_dataset_t* dataset = create_dataset(80, position_weighted, 2, false);
+    modular_linear_result_t* result = solve_modular_linear(dataset, 2);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT_EQUAL(16, result->modulus_bits);
+    TEST_ASSERT_EQUAL(0, result->solution_log2);
+    for (size_t i = 2; i < 7; i++) TEST_ASSERT_EQUAL((int)(i + 1), (int)result->weights[i]);
+    TEST_ASSERT_EQUAL(0x9C + 2 * 0x30, (int)result->offset);
+
+    checksum_solution_t solution;
+    TEST_ASSERT(!modular_linear_to_solution(result, &solution));   // Weights are not +/-1
+
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that a byte with a stuck low bit leaves its weight fixed only modulo 2^7
+void test_partial_lattice(void) {
+    packet_dataset_t* dataset = create_dataset(80, byte_sum, 1, true);
+    modular_linear_result_t* result = solve_modular_linear(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT_EQUAL(1, result->solution_log2);
+    TEST_ASSERT_EQUAL(1, result->generator_count);
+    TEST_ASSERT_EQUAL(7, result->determined_bits[3]);
+    TEST_ASSERT_EQUAL(8, result->determined_bits[4]);
+    TEST_ASSERT_EQUAL(1, (int)(result->weights[3] & 0x7F));
+
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+}
+
+// Test that XOR checksums and tiny datasets are recognised for what they are
+void test_inconsistent_and_underdetermined(void) {
+    packet_dataset_t* dataset = create_dataset(80, xor_fields, 1, false);
+    modular_linear_result_t* result = solve_modular_linear(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT(!result->consistent);
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+
+    dataset = create_dataset(3, byte_sum, 1, false);
+    result = solve_modular_linear(dataset, 1);
+    TEST_ASSERT_NOT_NULL(result);
+    TEST_ASSERT(result->consistent);
+    TEST_ASSERT(result->solution_log2 >= 8 * 3);
+    TEST_ASSERT(result->generator_count >= 3);
+    free_modular_linear_result(result);
+    free_packet_dataset(dataset);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_byte_sum);
+    RUN_TEST(test_add_sub_chain);
+    RUN_TEST(test_position_weighted_16bit);
+    RUN_TEST(test_partial_lattice);
+    RUN_TEST(test_inconsistent_and_underdetermined);
+
+    return TEST_SUMMARY();
+}
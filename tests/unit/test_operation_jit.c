@@ -0,0 +1,95 @@
+/* Unit tests for the native operation kernels (--jit) against the interpreter */
+
+#include "../unity.h"
+#include "../test_data.h"
+#include "../../include/algorithm_registry.h"
+#include "../../include/sequence_evaluator.h"
+#include "../../src/core/operation_jit.h"
+
+#define MAX_PACKETS 37
+
+static algorithm_registry_entry_t entries[32];
+static int entry_count;
+
+void setUp(void) {
+    initialize_algorithm_registry();
+    int count;
+    const algorithm_registry_entry_t* all = get_all_algorithms(&count);
+    entry_count = count < 32 ? count : 32;
+    for (int i = 0; i < entry_count; i++) entries[i] = all[i];
+}
+
+void tearDown(void) {
+    cleanup_algorithm_registry();
+}
+
+// Test that the common ops get kernels and the rest stay on the interpreter
+void test_kernel_coverage(void) {
+    setUp();
+    jit_summary_t summary;
+    bool compiled = compile_operation_kernels(entries, entry_count, &summary);
+    TEST_ASSERT(compiled == operation_jit_available());
+    for (int i = 0; compiled && i < entry_count; i++) {
+        bool native = entries[i].op <= OP_TWOS_COMPLEMENT && entries[i].op != OP_DIV && entries[i].op != OP_MOD;
+        TEST_ASSERT((entries[i].jit_advance != NULL) == native);
+        TEST_ASSERT((entries[i].jit_match != NULL) == native);
+    }
+    TEST_ASSERT(!compiled || summary.code_bytes > 0);
+    tearDown();
+}
+
+// Test every kernel against func on random values, odd and even packet counts, and
+// shift counts and multipliers that hit the special cases
+void test_kernels_match_interpreter(void) {
+    setUp();
+    if (!compile_operation_kernels(entries, entry_count, NULL)) {
+        tearDown();
+        return;
+    }
+    uint64_t state = 0x9E3779B97F4A7C15ULL;
+    uint64_t in[MAX_PACKETS], operand[MAX_PACKETS], out[MAX_PACKETS], expected[MAX_PACKETS];
+    const size_t counts[] = {0, 1, 2, 3, 8, 17, MAX_PACKETS};
+    bool same = true;
+    for (int i = 0; i < entry_count; i++) {
+        const algorithm_registry_entry_t* entry = &entries[i];
+        if (!entry->jit_advance) continue;
+        for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++) {
+            size_t n = counts[c];
+            uint64_t constant = next_random(&state) & 0xFF;
+            for (size_t p = 0; p < n; p++) {
+                in[p] = next_random(&state);
+                operand[p] = (p % 5 == 0) ? 0 : (p % 5 == 1) ? 64 + p : next_random(&state);
+                out[p] = 0;
+            }
+            entry->jit_advance(out, in, operand, n, constant);
+            // Ops without a field operand are always called with b = 0
+            bool reads_field = get_operation_operand_kind(entry->op) == OPERAND_FIELD;
+            for (size_t p = 0; p < n; p++) {
+                expected[p] = entry->func(in[p], reads_field ? operand[p] : 0, constant);
+                same &= out[p] == expected[p];
+            }
+
+            // The match kernel accepts the interpreter's values and rejects any single
+            // packet that differs inside the mask, wherever it sits
+            uint64_t mask = (c & 1) ? 0xFF : UINT64_MAX;
+            for (size_t p = 0; p < n; p++) expected[p] &= mask;
+            same &= entry->jit_match(expected, in, operand, n, constant, mask);
+            for (size_t p = 0; p < n; p++) {
+                expected[p] ^= 1;
+                same &= !entry->jit_match(expected, in, operand, n, constant, mask);
+                expected[p] ^= 1;
+            }
+        }
+    }
+    TEST_ASSERT(same);
+    tearDown();
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_kernel_coverage);
+    RUN_TEST(test_kernels_match_interpreter);
+
+    return TEST_SUMMARY();
+}
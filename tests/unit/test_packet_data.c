@@ -2,6 +2,7 @@
 
 #include "../unity.h"
 #include "../../src/core/packet_data.h"
+#include <unistd.h>
 
 void setUp(void) {
     // No setup needed for packet data tests
@@ -98,6 +99,50 @@ void test_dataset_size(void) {
     free_packet_dataset(dataset);
 }
 
+// Test duplicate removal and conflict detection
+void test_remove_duplicate_packets(void) {
+    packet_dataset_t* dataset = create_packet_dataset(8);
+    const uint8_t a[] = {0x01, 0x02, 0x03};
+    const uint8_t b[] = {0x01, 0x02, 0x04};
+    add_packet_from_bytes(dataset, a, sizeof(a), 0x10, 1, "a");
+    add_packet_from_bytes(dataset, b, sizeof(b), 0x11, 1, "b");
+    add_packet_from_bytes(dataset, a, sizeof(a), 0x10, 1, "a again");
+    add_packet_from_bytes(dataset, b, sizeof(b), 0x12, 1, "b conflicting");
+    add_packet_from_bytes(dataset, a, 2, 0x10, 1, "a truncated");
+
+    size_t conflicting = 0;
+    TEST_ASSERT_EQUAL(1, (int)remove_duplicate_packets(dataset, &conflicting));
+    TEST_ASSERT_EQUAL(4, (int)dataset->count);
+    TEST_ASSERT_EQUAL(2, (int)conflicting);
+    TEST_ASSERT_EQUAL_STRING("b", dataset->packets[1].description);
+    TEST_ASSERT_EQUAL_STRING("b conflicting", dataset->packets[2].description);
+    TEST_ASSERT_EQUAL(2, (int)dataset->packets[3].packet_length);
+
+    free_packet_dataset(dataset);
+}
+
+// Test that a JSON line holding a frame of CADS_MAX_PACKET_SIZE bytes loads whole
+void test_load_full_size_json_frame(void) {
+    char path[64];
+    snprintf(path, sizeof(path), "/tmp/cads_test_packets_%ld.jsonl", (long)getpid());
+    FILE* file = fopen(path, "w");
+    TEST_ASSERT_NOT_NULL(file);
+    fprintf(file, "{\"packet\": \"");
+    for (int i = 0; i < CADS_MAX_PACKET_SIZE; i++) fprintf(file, "%02x", (unsigned)(i * 7) & 0xFF);
+    fprintf(file, "\", \"checksum\": \"5a\", \"description\": \"full size\"}\n");
+    fclose(file);
+
+    packet_dataset_t* dataset = create_packet_dataset(2);
+    TEST_ASSERT(load_packets_from_json(dataset, path));
+    TEST_ASSERT_EQUAL(1, (int)dataset->count);
+    TEST_ASSERT_EQUAL(CADS_MAX_PACKET_SIZE, (int)dataset->packets[0].packet_length);
+    TEST_ASSERT_EQUAL(0xF9, dataset->packets[0].packet_data[CADS_MAX_PACKET_SIZE - 1]);
+    TEST_ASSERT_EQUAL_STRING("full size", dataset->packets[0].description);
+
+    free_packet_dataset(dataset);
+    remove(path);
+}
+
 int main(void) {
     TEST_SETUP();
     
@@ -106,6 +151,8 @@ int main(void) {
     RUN_TEST(test_packet_validation);
     RUN_TEST(test_dataset_cleanup);
     RUN_TEST(test_dataset_size);
+    RUN_TEST(test_remove_duplicate_packets);
+    RUN_TEST(test_load_full_size_json_frame);
     
     return TEST_SUMMARY();
 }
\ No newline at end of file
@@ -0,0 +1,97 @@
+/* Unit tests for prefix-state dedup cache */
+
+#include "../unity.h"
+#include "../../src/core/prefix_state_cache.h"
+
+#define PACKETS 4
+
+void setUp(void) {
+    // No setup needed
+}
+
+void tearDown(void) {
+    // No teardown needed
+}
+
+// Test cache creation and the minimum-size guard
+void test_cache_creation(void) {
+    prefix_state_cache_t* cache = create_prefix_state_cache(1 << 20, PACKETS);
+    TEST_ASSERT_NOT_NULL(cache);
+    TEST_ASSERT(prefix_state_cache_memory(cache) <= (1 << 20));
+    TEST_ASSERT_EQUAL(0, (int)(cache->capacity & (cache->capacity - 1)));  // Power of two
+    free_prefix_state_cache(cache);
+
+    // Too small to be useful
+    TEST_ASSERT_NULL(create_prefix_state_cache(64, PACKETS));
+    TEST_ASSERT_NULL(create_prefix_state_cache(1 << 20, 0));
+}
+
+// Test that an identical state is reported as seen and a different one is not
+void test_visit_dedup(void) {
+    prefix_state_cache_t* cache = create_prefix_state_cache(1 << 16, PACKETS);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    uint64_t a_values[PACKETS] = {1, 2, 3, 4};
+    uint64_t b_values[PACKETS] = {1, 2, 3, 5};
+    chain_state_t a = {a_values, 1, false};
+    chain_state_t b = {b_values, 1, false};
+    size_t slot;
+
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &a, 1, 0x1, &slot));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_SEEN, prefix_state_cache_visit(cache, &a, 1, 0x1, &slot));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &b, 1, 0x1, &slot));
+
+    // Same values at another depth, cursor or set of fields read are a different subtree
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &a, 2, 0x1, &slot));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &a, 1, 0x2, &slot));
+    a.field_cursor = 2;
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &a, 1, 0x1, &slot));
+    TEST_ASSERT_EQUAL(1, (int)cache->hits);
+
+    free_prefix_state_cache(cache);
+}
+
+// Test that states whose subtree had solutions are re-explored
+void test_mark_solutions(void) {
+    prefix_state_cache_t* cache = create_prefix_state_cache(1 << 16, PACKETS);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    uint64_t values[PACKETS] = {9, 8, 7, 6};
+    chain_state_t state = {values, 2, false};
+    size_t slot;
+
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &state, 2, 0x1, &slot));
+    prefix_state_cache_mark_solutions(cache, slot, &state, 2, 0x1);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_SEEN_WITH_SOLUTIONS, prefix_state_cache_visit(cache, &state, 2, 0x1, &slot));
+    TEST_ASSERT_EQUAL(1, (int)cache->equivalent_hits);
+
+    free_prefix_state_cache(cache);
+}
+
+// Test that a new context forgets earlier states
+void test_new_context(void) {
+    prefix_state_cache_t* cache = create_prefix_state_cache(1 << 16, PACKETS);
+    TEST_ASSERT_NOT_NULL(cache);
+
+    uint64_t values[PACKETS] = {0x10, 0x20, 0x30, 0x40};
+    chain_state_t state = {values, 1, true};
+    size_t slot;
+
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &state, 1, 0x1, &slot));
+    prefix_state_cache_new_context(cache);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, prefix_state_cache_visit(cache, &state, 1, 0x1, &slot));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_SEEN, prefix_state_cache_visit(cache, &state, 1, 0x1, &slot));
+
+    free_prefix_state_cache(cache);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_cache_creation);
+    RUN_TEST(test_visit_dedup);
+    RUN_TEST(test_mark_solutions);
+    RUN_TEST(test_new_context);
+
+    return TEST_SUMMARY();
+}
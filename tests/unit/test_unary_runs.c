@@ -0,0 +1,96 @@
+/* Unit tests for unary run composition and the explored-run set */
+
+#include "../unity.h"
+#include "../../include/algorithm_registry.h"
+#include "../../src/core/unary_runs.h"
+
+void setUp(void) {
+    initialize_algorithm_registry();
+}
+
+void tearDown(void) {
+    cleanup_algorithm_registry();
+}
+
+static int select_ops(const operation_t* ops, int count, algorithm_registry_entry_t* entries) {
+    for (int i = 0; i < count; i++) entries[i] = *get_algorithm_by_operation(ops[i]);
+    return count;
+}
+
+// Test that involutions return to the identity and that order matters for NOT and NEG
+void test_run_mappings(void) {
+    setUp();
+    const operation_t ops[] = {OP_ADD, OP_NOT, OP_NEGATE, OP_SWAP_NIBBLES, OP_REVERSE_BITS};
+    algorithm_registry_entry_t entries[5];
+    unary_run_table_t* table = build_unary_run_table(entries, select_ops(ops, 5, entries), 1, 3);
+    TEST_ASSERT_NOT_NULL(table);
+    TEST_ASSERT_EQUAL(4, table->unary_count);
+    TEST_ASSERT_EQUAL(-1, table->unary_index[OP_ADD]);
+
+    uint16_t id = UNARY_RUN_IDENTITY;
+    TEST_ASSERT_EQUAL(id, unary_run_step(table, unary_run_step(table, id, OP_NOT), OP_NOT));
+    TEST_ASSERT_EQUAL(id, unary_run_step(table, unary_run_step(table, id, OP_SWAP_NIBBLES), OP_SWAP_NIBBLES));
+    TEST_ASSERT_EQUAL(id, unary_run_step(table, unary_run_step(table, id, OP_NEGATE), OP_NEGATE));
+    uint16_t not_neg = unary_run_step(table, unary_run_step(table, id, OP_NOT), OP_NEGATE);  // x + 1
+    uint16_t neg_not = unary_run_step(table, unary_run_step(table, id, OP_NEGATE), OP_NOT);  // x - 1
+    TEST_ASSERT(not_neg != neg_not);
+    TEST_ASSERT(not_neg != id && neg_not != id);
+
+    // REVB and SWAP commute
+    uint16_t rs = unary_run_step(table, unary_run_step(table, id, OP_REVERSE_BITS), OP_SWAP_NIBBLES);
+    uint16_t sr = unary_run_step(table, unary_run_step(table, id, OP_SWAP_NIBBLES), OP_REVERSE_BITS);
+    TEST_ASSERT_EQUAL(rs, sr);
+    free_unary_run_table(table);
+    tearDown();
+}
+
+// Test that runs are only collapsed for 1-byte checksums, byte-closed op sets and at
+// least two unary ops
+void test_table_eligibility(void) {
+    setUp();
+    algorithm_registry_entry_t entries[4];
+    const operation_t unary[] = {OP_NOT, OP_LOOKUP_TABLE, OP_XOR};
+    const operation_t shifts[] = {OP_NOT, OP_LOOKUP_TABLE, OP_RSHIFT};
+    const operation_t single[] = {OP_NOT, OP_XOR, OP_MUL};
+
+    unary_run_table_t* table = build_unary_run_table(entries, select_ops(unary, 3, entries), 1, 4);
+    TEST_ASSERT_NOT_NULL(table);
+    free_unary_run_table(table);
+    TEST_ASSERT_NULL(build_unary_run_table(entries, select_ops(unary, 3, entries), 2, 4));
+    TEST_ASSERT_NULL(build_unary_run_table(entries, select_ops(shifts, 3, entries), 1, 4));
+    TEST_ASSERT_NULL(build_unary_run_table(entries, select_ops(single, 3, entries), 1, 4));
+    tearDown();
+}
+
+// Test the explored-run set: a second visit is pruned until solutions are marked, and a
+// reset forgets every run
+void test_run_set(void) {
+    static unary_run_set_t set;
+    size_t slot, again;
+    uint64_t key = unary_run_key(7, 3, 2, false, 0x3);
+    unary_run_set_reset(&set);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, unary_run_set_visit(&set, key, &slot));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_SEEN, unary_run_set_visit(&set, key, &again));
+    TEST_ASSERT_EQUAL(slot, again);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, unary_run_set_visit(&set, unary_run_key(7, 3, 2, true, 0x3), &again));
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, unary_run_set_visit(&set, unary_run_key(7, 3, 2, false, 0x5), &again));
+    unary_run_set_mark_solutions(&set, slot);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_SEEN_WITH_SOLUTIONS, unary_run_set_visit(&set, key, &again));
+    unary_run_set_reset(&set);
+    TEST_ASSERT_EQUAL(PREFIX_STATE_NEW, unary_run_set_visit(&set, key, &slot));
+
+    // Once three quarters full, new runs are no longer stored
+    unary_run_set_reset(&set);
+    for (uint64_t k = 0; k < UNARY_RUN_SET_CAPACITY; k++) unary_run_set_visit(&set, k, &slot);
+    TEST_ASSERT(slot == SIZE_MAX);
+}
+
+int main(void) {
+    TEST_SETUP();
+
+    RUN_TEST(test_run_mappings);
+    RUN_TEST(test_table_eligibility);
+    RUN_TEST(test_run_set);
+
+    return TEST_SUMMARY();
+}